@@ -0,0 +1,149 @@
+/***********************************************************************
+* chart.cpp - Plots streaming measured values with FChart              *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+#include <final/final.h>
+
+using finalcut::ChartStyle;
+using finalcut::FColor;
+using finalcut::FPoint;
+using finalcut::FSize;
+
+//----------------------------------------------------------------------
+// class ChartDialog
+//----------------------------------------------------------------------
+
+class ChartDialog final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit ChartDialog (finalcut::FWidget* = nullptr);
+
+  private:
+    // Constants
+    static constexpr int SAMPLE_RATE = 500;  // Samples per second
+
+    // Methods
+    void initLayout() override;
+    void adjustSize() override;
+
+    // Event handlers
+    void onTimer (finalcut::FTimerEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+    // Data members
+    finalcut::FLabel  signal_label{"Signal (Braille, 2 series)", this};
+    finalcut::FChart  signal_chart{this};
+    finalcut::FLabel  load_label{"Load (half blocks, 0..100)", this};
+    finalcut::FChart  load_chart{this};
+    std::mt19937      random{1};
+    std::normal_distribution<double> noise{0.0, 0.15};
+    std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+    long              samples{0};
+    double            load{50.0};
+};
+
+//----------------------------------------------------------------------
+ChartDialog::ChartDialog (finalcut::FWidget* parent)
+  : finalcut::FDialog{parent}
+{
+  setText ("Streaming chart");
+  signal_chart.addSeries (FColor::Blue);
+  signal_chart.addSeries (FColor::Red);
+  signal_chart.setCapacity (4000);  // 8 seconds
+  load_chart.setChartStyle (ChartStyle::HalfBlock);
+  load_chart.addSeries (FColor::Green);
+  load_chart.setRange (0.0, 100.0);
+  load_chart.setCapacity (400);  // 4 seconds
+  addTimer(10);  // New samples
+}
+
+//----------------------------------------------------------------------
+void ChartDialog::initLayout()
+{
+  FDialog::setGeometry (FPoint{1, 1}, FSize{80, 24});
+  FDialog::setResizeable();
+  adjustSize();
+  FDialog::initLayout();
+}
+
+//----------------------------------------------------------------------
+void ChartDialog::adjustSize()
+{
+  FDialog::adjustSize();
+  const auto width = getClientWidth() - 2;
+  const auto height = getClientHeight() - 4;
+  const auto signal_height = height - height / 3;
+  signal_label.setGeometry (FPoint{2, 1}, FSize{width, 1});
+  signal_chart.setGeometry (FPoint{2, 2}, FSize{width, signal_height});
+  load_label.setGeometry (FPoint{2, int(signal_height) + 3}, FSize{width, 1});
+  load_chart.setGeometry ( FPoint{2, int(signal_height) + 4}
+                         , FSize{width, height - signal_height} );
+}
+
+//----------------------------------------------------------------------
+void ChartDialog::onTimer (finalcut::FTimerEvent*)
+{
+  // Appends all samples measured since the last timer event.
+  // Appending is cheap, the charts are drawn once per frame.
+
+  using namespace std::chrono;
+  const auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+  const auto due = long(elapsed.count()) * SAMPLE_RATE / 1000;
+
+  for (; samples < due; samples++)
+  {
+    const double time = double(samples) / SAMPLE_RATE;
+    signal_chart.append (0, std::sin(time * 3.0) + noise(random));
+    signal_chart.append (1, 0.5 * std::sin(time * 11.0));
+
+    if ( samples % 5 == 0 )
+    {
+      load += std::uniform_real_distribution<double>{-4.0, 4.0}(random);
+      load = std::max(0.0, std::min(100.0, load));
+      load_chart.append (0, load);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void ChartDialog::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  finalcut::FApplication app{argc, argv};
+  ChartDialog dialog{&app};
+  finalcut::FWidget::setMainWidget(&dialog);
+  dialog.show();
+  return app.exec();
+}
@@ -0,0 +1,277 @@
+/***********************************************************************
+* compositor.cpp - Thread scaling benchmark of the window compositing  *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <vector>
+
+#include <final/final.h>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+using finalcut::FPoint;
+using finalcut::FRect;
+using finalcut::FSize;
+
+//----------------------------------------------------------------------
+// class StackWindow
+//----------------------------------------------------------------------
+
+class StackWindow final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit StackWindow (finalcut::FWidget* = nullptr, int = 0);
+
+  private:
+    // Method
+    void draw() override;
+
+    // Data member
+    int number{0};
+};
+
+//----------------------------------------------------------------------
+StackWindow::StackWindow (finalcut::FWidget* parent, int num)
+  : finalcut::FDialog{parent}
+  , number{num}
+{
+  FDialog::setText ("Window " + finalcut::FString().setNumber(num));
+  FDialog::setResizeable();
+
+  // Every third window gets a transparent shadow
+  if ( num % 3 == 0 )
+    setTransparentShadow();
+  else
+    setShadow();
+}
+
+//----------------------------------------------------------------------
+void StackWindow::draw()
+{
+  finalcut::FDialog::draw();
+  const auto fill = wchar_t(L'A' + number % 26);
+  const finalcut::FString line{getClientWidth(), fill};
+
+  for (auto n{1}; n <= int(getClientHeight()); n++)
+    print() << FPoint{2, 2 + n} << line;
+}
+
+
+//----------------------------------------------------------------------
+// class Compositor
+//----------------------------------------------------------------------
+
+class Compositor final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit Compositor (finalcut::FWidget* = nullptr, std::size_t = 0, int = 200);
+
+    // Accessor
+    auto getReport() const -> finalcut::FString;
+
+    // Event handlers
+    void onShow (finalcut::FShowEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+  private:
+    // Methods
+    void createWindowStack();
+    auto measure (std::size_t) const -> double;
+    void generateReport (const std::vector<double>&);
+
+    // Data members
+    std::vector<StackWindow*> windows{};
+    std::size_t               max_threads{0};
+    int                       loops{0};
+    finalcut::FString         report{};
+};
+
+
+//----------------------------------------------------------------------
+Compositor::Compositor ( finalcut::FWidget* parent
+                       , std::size_t threads
+                       , int num_loops )
+  : finalcut::FDialog{parent}
+  , max_threads{threads}
+  , loops{num_loops}
+{
+  FDialog::setText ("Compositor benchmark");
+
+  if ( max_threads == 0 )
+    max_threads = finalcut::FWorkerPool::getHardwareConcurrency();
+}
+
+//----------------------------------------------------------------------
+inline auto Compositor::getReport() const -> finalcut::FString
+{
+  return report;
+}
+
+//----------------------------------------------------------------------
+void Compositor::onShow (finalcut::FShowEvent*)
+{
+  createWindowStack();
+  std::vector<double> times{};
+
+  for (std::size_t threads{1}; threads <= max_threads; threads++)
+    times.push_back(measure(threads));
+
+  finalcut::FVTerm::setCompositingThreads(1);  // Back to serial mode
+  generateReport(times);
+  close();
+}
+
+//----------------------------------------------------------------------
+void Compositor::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+//----------------------------------------------------------------------
+void Compositor::createWindowStack()
+{
+  // Synthetic stack of overlapping windows with shadows
+
+  const auto width = int(getDesktopWidth());
+  const auto height = int(getDesktopHeight());
+  const int count = 12;
+
+  for (int n{0}; n < count; n++)
+  {
+    auto win = new StackWindow(this, n);
+    const auto w = std::max(width * 2 / 3, 10);
+    const auto h = std::max(height * 2 / 3, 5);
+    const auto x = 1 + (n * (width - w)) / count;
+    const auto y = 1 + (n * (height - h)) / count;
+    win->setGeometry (FPoint{x, y}, FSize{std::size_t(w), std::size_t(h)});
+    win->show();
+    windows.push_back(win);
+  }
+}
+
+//----------------------------------------------------------------------
+auto Compositor::measure (std::size_t threads) const -> double
+{
+  // Composes the complete window stack into the virtual terminal
+  // and returns the average time per frame in milliseconds
+
+  finalcut::FVTerm::setCompositingThreads(threads);
+  const FRect full{FPoint{1, 1}, FSize{getDesktopWidth(), getDesktopHeight()}};
+  restoreVTerm(full);  // Warm-up
+  const auto start = steady_clock::now();
+
+  for (int i{0}; i < loops; i++)
+    restoreVTerm(full);
+
+  const auto end = steady_clock::now();
+  const auto elapsed_us = duration_cast<microseconds>(end - start).count();
+  return double(elapsed_us) / 1000.0 / double(loops);
+}
+
+//----------------------------------------------------------------------
+void Compositor::generateReport (const std::vector<double>& times)
+{
+  finalcut::FString dimension_str{};
+  finalcut::FStringStream rep;
+  dimension_str << getDesktopWidth()
+                << "x" << getDesktopHeight();
+  rep << "Terminal size: " << dimension_str
+      << ", windows: " << windows.size()
+      << ", loops: " << loops << "\n"
+      << finalcut::FString{40, '-'} << "\n"
+      << "Threads  Time/frame  Speedup\n"
+      << finalcut::FString{40, '-'} << "\n";
+
+  for (std::size_t n{0}; n < times.size(); n++)
+  {
+    finalcut::FString time_str{};
+    finalcut::FString speedup_str{};
+    time_str << times[n] << "ms";
+    speedup_str << ( times[n] > 0.0 ? times[0] / times[n] : 1.0 );
+    rep << std::left << std::setw(9) << n + 1
+        << std::setw(12) << time_str
+        << speedup_str.left(5) << "x\n";
+  }
+
+  report << rep.str();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  std::size_t threads{0};
+  int loops{200};
+  finalcut::FString report{};
+
+  for (int n{1}; n < argc; n++)
+  {
+    if ( std::strcmp(argv[n], "--help") == 0
+      || std::strcmp(argv[n], "-h") == 0 )
+    {
+      std::cout << "Compositor options:\n"
+                << "  -t, --threads <n>             "
+                << "Maximum number of compositing threads\n"
+                << "  -l, --loops <n>               "
+                << "Number of frames per measurement\n\n";
+      return 0;
+    }
+
+    if ( n + 1 < argc
+      && ( std::strcmp(argv[n], "--threads") == 0
+        || std::strcmp(argv[n], "-t") == 0 ) )
+    {
+      threads = std::size_t(std::max(std::atoi(argv[++n]), 0));
+    }
+    else if ( n + 1 < argc
+           && ( std::strcmp(argv[n], "--loops") == 0
+             || std::strcmp(argv[n], "-l") == 0 ) )
+    {
+      loops = std::max(std::atoi(argv[++n]), 1);
+    }
+  }
+
+  // Disable terminal data requests
+  auto& start_options = finalcut::FStartOptions::getInstance();
+  start_options.terminal_data_request = false;
+
+  {  // Create the application object in this scope
+    finalcut::FApplication app{argc, argv};
+    Compositor compositor{&app, threads, loops};
+    compositor.setGeometry ( FPoint{1, 1}
+                           , FSize{app.getDesktopWidth(), app.getDesktopHeight()} );
+    finalcut::FWidget::setMainWidget(&compositor);
+    compositor.show();
+    app.exec();
+    report = compositor.getReport();
+  }  // Hide and destroy the application object
+
+  std::cout << "Compositor benchmark:\n" << report;
+  return 0;
+}
@@ -0,0 +1,251 @@
+/***********************************************************************
+* datagrid.cpp - Shows a large table with live values in FDataGrid     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <random>
+#include <unordered_map>
+
+#include <final/final.h>
+
+using finalcut::Align;
+using finalcut::FPoint;
+using finalcut::FSize;
+using finalcut::FString;
+using finalcut::SortOrder;
+
+//----------------------------------------------------------------------
+// class SensorModel
+//----------------------------------------------------------------------
+
+// One million sensors with 80 measured values each. The values are
+// computed on request, only the changed values are stored.
+
+class SensorModel final : public finalcut::FDataGridModel
+{
+  public:
+    // Constants
+    static constexpr std::size_t ROWS = 1000000;
+    static constexpr std::size_t COLUMNS = 80;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getRowCount() const -> std::size_t override;
+    auto getColumnCount() const -> std::size_t override;
+    auto getData (std::size_t, std::size_t) const -> FString override;
+    auto getColumnText (std::size_t) const -> FString override;
+    auto getColumnAlignment (std::size_t) const -> Align override;
+
+    // Inquiry
+    auto isSortable (std::size_t) const -> bool override;
+
+    // Methods
+    void sort (std::size_t, SortOrder) override;
+    auto changeValue (std::size_t, std::size_t) -> bool;
+
+  private:
+    // Methods
+    auto getSensor (std::size_t) const -> std::size_t;
+    static auto getKey (std::size_t, std::size_t) -> uInt64;
+
+    // Data members
+    std::unordered_map<uInt64, int> values{};
+    std::mt19937                    random{42};
+    bool                            descending{false};
+};
+
+//----------------------------------------------------------------------
+inline auto SensorModel::getClassName() const -> FString
+{
+  return "SensorModel";
+}
+
+//----------------------------------------------------------------------
+inline auto SensorModel::getRowCount() const -> std::size_t
+{
+  return ROWS;
+}
+
+//----------------------------------------------------------------------
+inline auto SensorModel::getColumnCount() const -> std::size_t
+{
+  return COLUMNS;
+}
+
+//----------------------------------------------------------------------
+auto SensorModel::getData (std::size_t row, std::size_t column) const -> FString
+{
+  const auto sensor = getSensor(row);
+
+  if ( column == 0 )
+    return FString{"sensor-"} << sensor;
+
+  const auto iter = values.find(getKey(sensor, column));
+  const int value = ( iter != values.end() )
+                  ? iter->second
+                  : int((sensor * 7919 + column * 104729) % 1000);
+  return FString{} << value / 10 << '.' << value % 10;
+}
+
+//----------------------------------------------------------------------
+auto SensorModel::getColumnText (std::size_t column) const -> FString
+{
+  if ( column == 0 )
+    return "Sensor";
+
+  return FString{"Value "} << column;
+}
+
+//----------------------------------------------------------------------
+auto SensorModel::getColumnAlignment (std::size_t column) const -> Align
+{
+  return ( column == 0 ) ? Align::Left : Align::Right;
+}
+
+//----------------------------------------------------------------------
+inline auto SensorModel::isSortable (std::size_t column) const -> bool
+{
+  return column == 0;
+}
+
+//----------------------------------------------------------------------
+void SensorModel::sort (std::size_t, SortOrder order)
+{
+  descending = ( order == SortOrder::Descending );
+}
+
+//----------------------------------------------------------------------
+auto SensorModel::changeValue (std::size_t row, std::size_t column) -> bool
+{
+  // Changes a value of the given row. Returns false if the new
+  // value is equal to the old value.
+
+  const auto key = getKey(getSensor(row), column);
+  const auto value = int(random() % 1000);
+  auto& entry = values[key];
+
+  if ( entry == value )
+    return false;
+
+  entry = value;
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline auto SensorModel::getSensor (std::size_t row) const -> std::size_t
+{
+  return descending ? ROWS - row : row + 1;
+}
+
+//----------------------------------------------------------------------
+inline auto SensorModel::getKey (std::size_t sensor, std::size_t column) -> uInt64
+{
+  return (uInt64(sensor) << 8) | uInt64(column);
+}
+
+
+//----------------------------------------------------------------------
+// class SensorView
+//----------------------------------------------------------------------
+
+class SensorView final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit SensorView (finalcut::FWidget* = nullptr);
+
+  private:
+    // Methods
+    void initLayout() override;
+    void adjustSize() override;
+
+    // Event handlers
+    void onTimer (finalcut::FTimerEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+    // Data members
+    SensorModel          model{};
+    finalcut::FDataGrid  grid{this};
+    std::mt19937         random{7};
+};
+
+//----------------------------------------------------------------------
+SensorView::SensorView (finalcut::FWidget* parent)
+  : finalcut::FDialog{parent}
+{
+  setText ("Sensors");
+  grid.setModel (&model);
+  grid.setFrozenColumns (1);  // The sensor name stays visible
+  grid.setColumnWidth (0, 14);
+  addTimer(100);  // Value changes
+}
+
+//----------------------------------------------------------------------
+void SensorView::initLayout()
+{
+  FDialog::setGeometry (FPoint{1, 1}, FSize{80, 24});
+  FDialog::setResizeable();
+  FDialog::setMinimizable();
+  adjustSize();
+  FDialog::initLayout();
+}
+
+//----------------------------------------------------------------------
+void SensorView::adjustSize()
+{
+  FDialog::adjustSize();
+  grid.setGeometry (FPoint{1, 1}, FSize{getClientWidth(), getClientHeight()});
+}
+
+//----------------------------------------------------------------------
+void SensorView::onTimer (finalcut::FTimerEvent*)
+{
+  // Changes some values around the current row
+
+  const auto first_row = grid.getCurrentRow() > 10 ? grid.getCurrentRow() - 10 : 0;
+
+  for (int i{0}; i < 20; i++)
+  {
+    const auto row = first_row + random() % 30;
+    const auto column = 1 + random() % (SensorModel::COLUMNS - 1);
+
+    if ( model.changeValue(row, column) )
+      grid.updateCell (row, column);  // Draws only this cell again
+  }
+}
+
+//----------------------------------------------------------------------
+void SensorView::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  finalcut::FApplication app{argc, argv};
+  SensorView view{&app};
+  finalcut::FWidget::setMainWidget(&view);
+  view.show();
+  return app.exec();
+}
@@ -272,6 +272,8 @@ EventLog::EventLog (finalcut::FWidget* parent)
   setMinimumSize (FSize{75, 5});
   setShadow();
   scrolltext.ignorePadding();
+  scrolltext.setMaxLines(10000);
+  scrolltext.setFollowMode();
   event_dialog->setFocus();
   addTimer(250);  // Starts the timer every 250 milliseconds
 }
@@ -285,10 +287,8 @@ void EventLog::onTimer (finalcut::FTimerEvent*)
   if ( str().empty() )
     return;
 
-  scrolltext.append(str());
+  scrolltext.append(str());  // Follow mode scrolls to the end
   str("");
-  scrolltext.scrollToEnd();
-  redraw();
 }
 
 //----------------------------------------------------------------------
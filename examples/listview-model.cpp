@@ -0,0 +1,323 @@
+/***********************************************************************
+* listview-model.cpp - A virtual FListView with a large data model     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <final/final.h>
+
+using finalcut::FColor;
+using finalcut::FColorPair;
+using finalcut::FPoint;
+using finalcut::FSize;
+using finalcut::FString;
+
+//----------------------------------------------------------------------
+// class NumberModel
+//----------------------------------------------------------------------
+
+// Groups of 1000 numbers that are computed on demand.
+// Only the expanded groups show their numbers.
+
+class NumberModel final : public finalcut::FListViewModel
+{
+  public:
+    // Constructor
+    explicit NumberModel (std::size_t);
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getRowCount() const -> std::size_t override;
+    auto getText (std::size_t, int) const -> FString override;
+    auto getColorPair (std::size_t, int) const -> FColorPair override;
+    auto getChildCount (std::size_t) const -> std::size_t override;
+    auto getDepth (std::size_t) const -> uInt override;
+
+    // Inquiry
+    auto isExpand (std::size_t) const -> bool override;
+
+    // Methods
+    void expand (std::size_t) override;
+    void collapse (std::size_t) override;
+    void sort (int, finalcut::SortOrder) override;
+
+  private:
+    // Using-declaration
+    using Entry = std::pair<std::size_t, std::size_t>;  // group, child
+
+    // Constant
+    static constexpr std::size_t group_size = 1000;
+
+    // Methods
+    auto getEntry (std::size_t) const -> Entry;
+    auto getNumber (std::size_t) const -> std::size_t;
+
+    // Data members
+    std::vector<bool>  expanded{};
+    std::size_t        expanded_count{0};
+    bool               descending{false};
+};
+
+//----------------------------------------------------------------------
+NumberModel::NumberModel (std::size_t groups)
+  : expanded(groups, false)
+{ }
+
+//----------------------------------------------------------------------
+inline auto NumberModel::getClassName() const -> FString
+{
+  return "NumberModel";
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getRowCount() const -> std::size_t
+{
+  return expanded.size() + expanded_count * group_size;
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getText (std::size_t row, int column) const -> FString
+{
+  const auto entry = getEntry(row);
+
+  if ( entry.second == 0 )  // Group row
+  {
+    if ( column != 1 )
+      return {};
+
+    return FString{"Group "} << getNumber(entry.first * group_size);
+  }
+
+  const auto number = getNumber(entry.first * group_size + entry.second - 1);
+
+  if ( column == 1 )
+    return FString{} << number;
+
+  if ( column == 2 )
+    return FString{}.setFormatedNumber(uInt64(number) * uInt64(number));
+
+  return FString{"0x"} + FString{}.sprintf("%08zx", number);
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getColorPair (std::size_t row, int column) const -> FColorPair
+{
+  const auto entry = getEntry(row);
+
+  if ( entry.second == 0 )
+    return FColorPair{FColor::Blue};
+
+  if ( column == 3 )
+    return FColorPair{FColor::DarkGray};
+
+  return FColorPair{};
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getChildCount (std::size_t row) const -> std::size_t
+{
+  return getEntry(row).second == 0 ? group_size : 0;
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getDepth (std::size_t row) const -> uInt
+{
+  return getEntry(row).second == 0 ? 0 : 1;
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::isExpand (std::size_t row) const -> bool
+{
+  const auto entry = getEntry(row);
+  return entry.second == 0 && expanded[entry.first];
+}
+
+//----------------------------------------------------------------------
+void NumberModel::expand (std::size_t row)
+{
+  const auto entry = getEntry(row);
+
+  if ( entry.second != 0 || expanded[entry.first] )
+    return;
+
+  expanded[entry.first] = true;
+  expanded_count++;
+}
+
+//----------------------------------------------------------------------
+void NumberModel::collapse (std::size_t row)
+{
+  const auto entry = getEntry(row);
+
+  if ( entry.second != 0 || ! expanded[entry.first] )
+    return;
+
+  expanded[entry.first] = false;
+  expanded_count--;
+}
+
+//----------------------------------------------------------------------
+void NumberModel::sort (int, finalcut::SortOrder order)
+{
+  // Reversing the numbers is sufficient for every column
+
+  const bool desc = order == finalcut::SortOrder::Descending;
+
+  if ( desc == descending )
+    return;
+
+  descending = desc;
+  expanded = std::vector<bool>(expanded.rbegin(), expanded.rend());
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getEntry (std::size_t row) const -> Entry
+{
+  // Maps a row to its group and child (0 = group row).
+  // Linear in the number of groups, which is small.
+
+  for (std::size_t group{0}; group < expanded.size(); group++)
+  {
+    const std::size_t lines = expanded[group] ? group_size + 1 : 1;
+
+    if ( row < lines )
+      return {group, row};
+
+    row -= lines;
+  }
+
+  return {0, 0};
+}
+
+//----------------------------------------------------------------------
+auto NumberModel::getNumber (std::size_t index) const -> std::size_t
+{
+  const auto count = expanded.size() * group_size;
+  return descending ? count - 1 - index : index;
+}
+
+
+//----------------------------------------------------------------------
+// class ListViewModel
+//----------------------------------------------------------------------
+
+class ListViewModel final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit ListViewModel (finalcut::FWidget* = nullptr, std::size_t = 1000);
+
+  private:
+    // Method
+    void initLayout() override;
+    void adjustSize() override;
+
+    // Event handler
+    void onClose (finalcut::FCloseEvent*) override;
+
+    // Data members
+    NumberModel            model;
+    finalcut::FListView    listview{this};
+    finalcut::FButton      quit{"&Quit", this};
+};
+
+//----------------------------------------------------------------------
+ListViewModel::ListViewModel (finalcut::FWidget* parent, std::size_t groups)
+  : finalcut::FDialog{parent}
+  , model{groups}
+{
+  listview.addColumn ("Number", 14);
+  listview.addColumn ("Square", 16);
+  listview.addColumn ("Hex", 10);
+  listview.setColumnAlignment (2, finalcut::Align::Right);
+  listview.setColumnSort (1, finalcut::SortOrder::Ascending);
+  listview.setTreeView();
+  listview.setModel (&model);
+  listview.setFocus();
+
+  quit.addCallback
+  (
+    "clicked",
+    finalcut::getFApplication(),
+    &finalcut::FApplication::cb_exitApp,
+    this
+  );
+}
+
+//----------------------------------------------------------------------
+void ListViewModel::initLayout()
+{
+  FDialog::setText ("Virtual list view");
+  FDialog::setGeometry (FPoint{8, 2}, FSize{48, 20});
+  FDialog::setShadow();
+  quit.setGeometry (FPoint{34, 16}, FSize{10, 1});
+  adjustSize();
+  FDialog::initLayout();
+}
+
+//----------------------------------------------------------------------
+void ListViewModel::adjustSize()
+{
+  FDialog::adjustSize();
+  listview.setGeometry (FPoint{2, 1}, FSize{getClientWidth() - 2, 14});
+}
+
+//----------------------------------------------------------------------
+void ListViewModel::onClose (finalcut::FCloseEvent* ev)
+{
+  finalcut::FApplication::closeConfirmationDialog (this, ev);
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  std::size_t groups{1000};
+
+  for (int n{1}; n < argc; n++)
+  {
+    if ( std::strcmp(argv[n], "--help") == 0
+      || std::strcmp(argv[n], "-h") == 0 )
+    {
+      std::cout << "ListView model options:\n"
+                << "  -g, --groups <n>              "
+                << "Number of groups with 1000 numbers\n\n";
+      return 0;
+    }
+
+    if ( n + 1 < argc
+      && ( std::strcmp(argv[n], "--groups") == 0
+        || std::strcmp(argv[n], "-g") == 0 ) )
+    {
+      groups = std::size_t(std::max(std::atoi(argv[++n]), 1));
+    }
+  }
+
+  finalcut::FApplication app{argc, argv};
+  ListViewModel dialog{&app, groups};
+  finalcut::FWidget::setMainWidget(&dialog);
+  dialog.show();
+  return app.exec();
+}
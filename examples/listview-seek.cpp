@@ -0,0 +1,258 @@
+/***********************************************************************
+* listview-seek.cpp - Random access benchmark of a large FListView     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <final/final.h>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+using finalcut::FPoint;
+using finalcut::FSize;
+
+//----------------------------------------------------------------------
+// class ListViewSeek
+//----------------------------------------------------------------------
+
+class ListViewSeek final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit ListViewSeek (finalcut::FWidget* = nullptr, int = 1000000, int = 100000);
+
+    // Accessor
+    auto getReport() const -> finalcut::FString;
+
+    // Event handlers
+    void onShow (finalcut::FShowEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+  private:
+    // Using-declaration
+    using Positions = std::vector<int>;
+
+    // Methods
+    void initLayout() override;
+    void createTree();
+    auto measureSeek (const Positions&) -> double;
+    auto measureSteps (const Positions&) -> double;
+
+    // Data members
+    finalcut::FListView          listview{this};
+    finalcut::FObject::iterator  root{};
+    int                          items{0};
+    int                          seeks{0};
+    double                       build_time{0.0};
+    finalcut::FString            report{};
+};
+
+//----------------------------------------------------------------------
+ListViewSeek::ListViewSeek ( finalcut::FWidget* parent
+                           , int num_items
+                           , int num_seeks )
+  : finalcut::FDialog{parent}
+  , items{num_items}
+  , seeks{num_seeks}
+{
+  listview.addColumn ("Name");
+  listview.setTreeView();
+}
+
+//----------------------------------------------------------------------
+inline auto ListViewSeek::getReport() const -> finalcut::FString
+{
+  return report;
+}
+
+//----------------------------------------------------------------------
+void ListViewSeek::onShow (finalcut::FShowEvent*)
+{
+  createTree();
+  const auto count = int(listview.getCount());
+  std::mt19937 generator{4711};
+  std::uniform_int_distribution<int> distribution{0, count - 1};
+  Positions positions(static_cast<std::size_t>(seeks));
+
+  for (auto&& pos : positions)
+    pos = distribution(generator);
+
+  const double seek_time = measureSeek(positions);
+
+  // Stepping line by line is only measured for a few positions
+  positions.resize(std::min(positions.size(), std::size_t(20)));
+  const double step_time = measureSteps(positions);
+
+  finalcut::FStringStream rep;
+  rep << "Lines: " << count << ", random jumps: " << seeks << "\n"
+      << "Build time:         " << build_time << "ms\n"
+      << "Seek time/jump:     " << seek_time << "us\n"
+      << "Stepping time/jump: " << step_time << "us\n";
+  report << rep.str();
+  close();
+}
+
+//----------------------------------------------------------------------
+void ListViewSeek::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+//----------------------------------------------------------------------
+void ListViewSeek::initLayout()
+{
+  FDialog::setText ("FListView seek benchmark");
+  listview.setGeometry (FPoint{2, 1}, FSize{getClientWidth(), getClientHeight()});
+  FDialog::initLayout();
+}
+
+//----------------------------------------------------------------------
+void ListViewSeek::createTree()
+{
+  // A root item with groups of 1000 items,
+  // all expanded (depth 3)
+
+  const auto start = steady_clock::now();
+  const int group_size = std::min(items, 1000);
+  const int groups = std::max(items / group_size, 1);
+  root = listview.insert ({"Root"});
+
+  for (int g{0}; g < groups; g++)
+  {
+    const auto group_name = finalcut::FString("Group ").setNumber(g);
+    auto group = listview.insert ({group_name}, root);
+
+    for (int n{0}; n < group_size; n++)
+      listview.insert ({finalcut::FString().setNumber(n)}, group);
+
+    static_cast<finalcut::FListViewItem*>(*group)->expand();
+  }
+
+  static_cast<finalcut::FListViewItem*>(*root)->expand();
+  const auto end = steady_clock::now();
+  build_time = double(duration_cast<microseconds>(end - start).count()) / 1000.0;
+}
+
+//----------------------------------------------------------------------
+auto ListViewSeek::measureSeek (const Positions& positions) -> double
+{
+  // Average time of a random jump in microseconds
+
+  finalcut::FListViewIterator iter{root};
+  const auto start = steady_clock::now();
+
+  for (auto&& pos : positions)
+  {
+    const int distance = pos - iter.getPosition();
+
+    if ( distance > 0 )
+      iter += distance;
+    else
+      iter -= -distance;
+  }
+
+  const auto end = steady_clock::now();
+  const auto elapsed_us = duration_cast<microseconds>(end - start).count();
+  return double(elapsed_us) / double(positions.size());
+}
+
+//----------------------------------------------------------------------
+auto ListViewSeek::measureSteps (const Positions& positions) -> double
+{
+  // Average time to reach a random position line by line
+
+  finalcut::FListViewIterator iter{root};
+  const auto start = steady_clock::now();
+
+  for (auto&& pos : positions)
+  {
+    while ( iter.getPosition() < pos )
+      ++iter;
+
+    while ( iter.getPosition() > pos )
+      --iter;
+  }
+
+  const auto end = steady_clock::now();
+  const auto elapsed_us = duration_cast<microseconds>(end - start).count();
+  return double(elapsed_us) / double(positions.size());
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  int items{1000000};
+  int seeks{100000};
+  finalcut::FString report{};
+
+  for (int n{1}; n < argc; n++)
+  {
+    if ( std::strcmp(argv[n], "--help") == 0
+      || std::strcmp(argv[n], "-h") == 0 )
+    {
+      std::cout << "ListView seek options:\n"
+                << "  -i, --items <n>               "
+                << "Number of list items\n"
+                << "  -s, --seeks <n>               "
+                << "Number of random jumps\n\n";
+      return 0;
+    }
+
+    if ( n + 1 < argc
+      && ( std::strcmp(argv[n], "--items") == 0
+        || std::strcmp(argv[n], "-i") == 0 ) )
+    {
+      items = std::max(std::atoi(argv[++n]), 1);
+    }
+    else if ( n + 1 < argc
+           && ( std::strcmp(argv[n], "--seeks") == 0
+             || std::strcmp(argv[n], "-s") == 0 ) )
+    {
+      seeks = std::max(std::atoi(argv[++n]), 1);
+    }
+  }
+
+  // Disable terminal data requests
+  auto& start_options = finalcut::FStartOptions::getInstance();
+  start_options.terminal_data_request = false;
+
+  {  // Create the application object in this scope
+    finalcut::FApplication app{argc, argv};
+    ListViewSeek benchmark{&app, items, seeks};
+    benchmark.setGeometry ( FPoint{1, 1}
+                          , FSize{app.getDesktopWidth(), app.getDesktopHeight()} );
+    finalcut::FWidget::setMainWidget(&benchmark);
+    benchmark.show();
+    app.exec();
+    report = benchmark.getReport();
+  }  // Hide and destroy the application object
+
+  std::cout << "FListView seek benchmark:\n" << report;
+  return 0;
+}
@@ -0,0 +1,213 @@
+/***********************************************************************
+* logview.cpp - Shows a large text file with a memory-mapped model     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include <final/final.h>
+
+using finalcut::FColor;
+using finalcut::FPoint;
+using finalcut::FSize;
+using finalcut::FString;
+
+//----------------------------------------------------------------------
+// class LogHighlighter
+//----------------------------------------------------------------------
+
+// Highlights the log levels. Only the drawn lines are highlighted.
+
+class LogHighlighter final : public finalcut::FTextViewHighlighter
+{
+  public:
+    // Accessor
+    auto getClassName() const -> FString override;
+
+    // Method
+    auto highlight (std::size_t, const FString&) -> FTextHighlightList override;
+};
+
+//----------------------------------------------------------------------
+inline auto LogHighlighter::getClassName() const -> FString
+{
+  return "LogHighlighter";
+}
+
+//----------------------------------------------------------------------
+auto LogHighlighter::highlight (std::size_t, const FString& line) -> FTextHighlightList
+{
+  static const std::array<std::pair<FString, FColor>, 4> levels
+  {{
+    { "ERROR", FColor::Red },
+    { "WARN", FColor::Brown },
+    { "INFO", FColor::Blue },
+    { "DEBUG", FColor::DarkGray }
+  }};
+
+  const auto text = line.toWString();
+  FTextHighlightList result{};
+
+  for (const auto& level : levels)
+  {
+    const auto pos = text.find(level.first.toWString());
+
+    if ( pos != std::wstring::npos )
+    {
+      result.emplace_back(pos, level.first.getLength(), level.second);
+      break;
+    }
+  }
+
+  return result;
+}
+
+
+//----------------------------------------------------------------------
+// class LogView
+//----------------------------------------------------------------------
+
+class LogView final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit LogView (finalcut::FWidget* = nullptr);
+
+    // Method
+    auto open (const FString&) -> bool;
+
+  private:
+    // Methods
+    void initLayout() override;
+    void adjustSize() override;
+    void updateTitle();
+
+    // Event handlers
+    void onTimer (finalcut::FTimerEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+    // Data members
+    finalcut::FMappedTextFile  file{};
+    LogHighlighter             highlighter{};
+    finalcut::FTextView        textview{this};
+};
+
+//----------------------------------------------------------------------
+LogView::LogView (finalcut::FWidget* parent)
+  : finalcut::FDialog{parent}
+{
+  textview.ignorePadding();
+  textview.setSelectable();
+  textview.setHighlighter (&highlighter);
+}
+
+//----------------------------------------------------------------------
+auto LogView::open (const FString& filename) -> bool
+{
+  textview.unsetModel();
+
+  if ( ! file.open(filename) )
+    return false;
+
+  textview.setModel (&file);
+  updateTitle();
+  delOwnTimers();
+  addTimer(250);  // Shows the indexing progress
+  return true;
+}
+
+//----------------------------------------------------------------------
+void LogView::initLayout()
+{
+  FDialog::setGeometry (FPoint{1, 1}, FSize{80, 24});
+  FDialog::setResizeable();
+  FDialog::setMinimizable();
+  adjustSize();
+  FDialog::initLayout();
+}
+
+//----------------------------------------------------------------------
+void LogView::adjustSize()
+{
+  FDialog::adjustSize();
+  textview.setGeometry (FPoint{1, 2}, FSize{getWidth(), getHeight() - 1});
+}
+
+//----------------------------------------------------------------------
+void LogView::updateTitle()
+{
+  FString title{file.getFileName()};
+  title << " - " << textview.getRows() << " lines";
+
+  if ( file.isLoading() )
+    title << " (" << file.getProgress() << "% indexed)";
+
+  setText (title);
+
+  if ( isShown() )
+    redraw();
+}
+
+//----------------------------------------------------------------------
+void LogView::onTimer (finalcut::FTimerEvent*)
+{
+  updateTitle();
+
+  if ( ! file.isLoading() )
+    delOwnTimers();
+}
+
+//----------------------------------------------------------------------
+void LogView::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  if ( argc < 2
+    || std::strcmp(argv[1], "--help") == 0
+    || std::strcmp(argv[1], "-h") == 0 )
+  {
+    std::cout << "Usage: logview <file>\n\n";
+    return 0;
+  }
+
+  const FString filename{argv[1]};
+  finalcut::FApplication app{argc, argv};
+  LogView logview{&app};
+
+  if ( ! logview.open(filename) )
+  {
+    std::cerr << "Cannot open " << filename << "\n";
+    return 1;
+  }
+
+  finalcut::FWidget::setMainWidget(&logview);
+  logview.show();
+  return app.exec();
+}
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2017-2023 Markus Gans                                      *
+* Copyright 2017-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -505,12 +505,7 @@ void MouseDraw::drawCanvas()
                 , &canvaschar
                 , sizeof(finalcut::FChar) * unsigned(x_end) );
     auto& line_changes = printarea->changes[unsigned(ay + y)];
-
-    if ( int(line_changes.xmin) > ax )
-      line_changes.xmin = uInt(ax);
-
-    if ( int(line_changes.xmax) < ax + x_end - 1 )
-      line_changes.xmax = uInt(ax + x_end - 1);
+    line_changes.add (uInt(ax), uInt(ax + x_end - 1));
   }
 
   printarea->has_changes = true;
@@ -0,0 +1,225 @@
+/***********************************************************************
+* print-benchmark.cpp - Micro-benchmark of the FVTerm print path       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <string>
+
+#include <final/final.h>
+
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using finalcut::FPoint;
+using finalcut::FSize;
+
+//----------------------------------------------------------------------
+// class PrintBenchmark
+//----------------------------------------------------------------------
+
+class PrintBenchmark final : public finalcut::FDialog
+{
+  public:
+    // Constructor
+    explicit PrintBenchmark (finalcut::FWidget* = nullptr, int = 2000);
+
+    // Accessor
+    auto getReport() const -> finalcut::FString;
+
+    // Event handlers
+    void onShow (finalcut::FShowEvent*) override;
+    void onClose (finalcut::FCloseEvent*) override;
+
+  private:
+    // Using-declarations
+    using FTextPair = std::array<finalcut::FString, 2>;
+    using FPrintFunction = std::function<void(const finalcut::FString&)>;
+
+    // Methods
+    auto makeText (const std::wstring&, std::size_t) const -> FTextPair;
+    auto measure (const FTextPair&, const FPrintFunction&) -> double;
+    void addResult (const finalcut::FString&, double);
+
+    // Data members
+    int                loops{0};
+    finalcut::FString  report{};
+};
+
+
+//----------------------------------------------------------------------
+PrintBenchmark::PrintBenchmark (finalcut::FWidget* parent, int num_loops)
+  : finalcut::FDialog{parent}
+  , loops{num_loops}
+{
+  FDialog::setText ("Print benchmark");
+}
+
+//----------------------------------------------------------------------
+inline auto PrintBenchmark::getReport() const -> finalcut::FString
+{
+  return report;
+}
+
+//----------------------------------------------------------------------
+void PrintBenchmark::onShow (finalcut::FShowEvent*)
+{
+  const auto width = getClientWidth();
+  const auto ascii = makeText (L"The quick brown fox jumps over the lazy dog. ", width);
+  const auto unicode = makeText (L"Größe: 21,5 °C – ", width);
+  const auto full_width = makeText (L"漢字テキスト", width / 2);
+  finalcut::FStringStream rep;
+  rep << "Client size: " << width << "x" << getClientHeight()
+      << ", loops: " << loops << "\n"
+      << finalcut::FString{40, '-'} << "\n"
+      << "Text                        ns/char\n"
+      << finalcut::FString{40, '-'} << "\n";
+  report << rep.str();
+
+  const auto print_string = [this] (const finalcut::FString& text)
+  {
+    print (text);
+  };
+
+  const auto print_buffer = [this] (const finalcut::FString& text)
+  {
+    // The general path: conversion of every character into FChar
+    finalcut::FVTermBuffer vterm_buffer{};
+    vterm_buffer.print(text);
+    print (vterm_buffer);
+  };
+
+  addResult ("ASCII (FString)", measure(ascii, print_string));
+  addResult ("ASCII (FVTermBuffer)", measure(ascii, print_buffer));
+  addResult ("Unicode (FString)", measure(unicode, print_string));
+  addResult ("Full-width (FString)", measure(full_width, print_string));
+  close();
+}
+
+//----------------------------------------------------------------------
+void PrintBenchmark::onClose (finalcut::FCloseEvent* ev)
+{
+  ev->accept();
+}
+
+//----------------------------------------------------------------------
+auto PrintBenchmark::makeText ( const std::wstring& pattern
+                              , std::size_t length ) const -> FTextPair
+{
+  // Returns two texts with a different character in each column,
+  // so that every print changes the area
+
+  std::wstring text{};
+
+  while ( text.length() < length + 1 )
+    text += pattern;
+
+  return {{ text.substr(0, length), text.substr(1, length) }};
+}
+
+//----------------------------------------------------------------------
+auto PrintBenchmark::measure ( const FTextPair& text
+                             , const FPrintFunction& print_text ) -> double
+{
+  // Prints the texts alternately into all client lines
+  // and returns the average time per character in nanoseconds
+
+  const auto height = int(getClientHeight());
+  std::size_t chars{0};
+  const auto start = steady_clock::now();
+
+  for (int i{0}; i < loops; i++)
+  {
+    const auto& line = text[std::size_t(i) & 1];
+
+    for (int y{1}; y <= height; y++)
+    {
+      setPrintPos (FPoint{2, 1 + y});
+      print_text (line);
+      chars += line.getLength();
+    }
+  }
+
+  const auto end = steady_clock::now();
+  const auto elapsed_ns = duration_cast<nanoseconds>(end - start).count();
+  return ( chars > 0 ) ? double(elapsed_ns) / double(chars) : 0.0;
+}
+
+//----------------------------------------------------------------------
+void PrintBenchmark::addResult (const finalcut::FString& name, double time)
+{
+  finalcut::FStringStream rep;
+  finalcut::FString time_str{};
+  time_str << time;
+  rep << std::left << std::setw(28) << name << time_str.left(6) << "\n";
+  report << rep.str();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+auto main (int argc, char* argv[]) -> int
+{
+  int loops{2000};
+  finalcut::FString report{};
+
+  for (int n{1}; n < argc; n++)
+  {
+    if ( std::strcmp(argv[n], "--help") == 0
+      || std::strcmp(argv[n], "-h") == 0 )
+    {
+      std::cout << "Print benchmark options:\n"
+                << "  -l, --loops <n>               "
+                << "Number of screens per measurement\n\n";
+      return 0;
+    }
+
+    if ( n + 1 < argc
+      && ( std::strcmp(argv[n], "--loops") == 0
+        || std::strcmp(argv[n], "-l") == 0 ) )
+    {
+      loops = std::max(std::atoi(argv[++n]), 1);
+    }
+  }
+
+  // Disable terminal data requests
+  auto& start_options = finalcut::FStartOptions::getInstance();
+  start_options.terminal_data_request = false;
+
+  {  // Create the application object in this scope
+    finalcut::FApplication app{argc, argv};
+    PrintBenchmark benchmark{&app, loops};
+    benchmark.setGeometry ( FPoint{1, 1}
+                          , FSize{app.getDesktopWidth(), app.getDesktopHeight()} );
+    finalcut::FWidget::setMainWidget(&benchmark);
+    benchmark.show();
+    app.exec();
+    report = benchmark.getReport();
+  }  // Hide and destroy the application object
+
+  std::cout << "Print benchmark:\n" << report;
+  return 0;
+}
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2020-2023 Markus Gans                                      *
+* Copyright 2020-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -25,6 +25,7 @@
 #include <array>
 #include <chrono>
 #include <iomanip>
+#include <memory>
 #include <string>
 
 #include <final/final.h>
@@ -51,7 +52,8 @@ class RotoZoomer final : public finalcut::FDialog
 {
   public:
     // Constructor
-    explicit RotoZoomer (finalcut::FWidget* = nullptr, bool = false, int = 314);
+    explicit RotoZoomer ( finalcut::FWidget* = nullptr, bool = false
+                        , int = 314, bool = false );
 
     // Accessors
     auto getReport() const -> finalcut::FString;
@@ -65,7 +67,9 @@ class RotoZoomer final : public finalcut::FDialog
   private:
     // Methods
     void draw() override;
+    void drawEffect();
     void rotozoomer (double, double, double, double);
+    void rotozoomerCanvas (double, double, double, double);
     void generateReport();
     void adjustSize() override;
 
@@ -74,6 +78,8 @@ class RotoZoomer final : public finalcut::FDialog
     int                      loops{0};
     int                      path{0};
     std::wstring             data{std::wstring(256, L'\0')};
+    std::array<FColor, 256>  texture{};
+    std::unique_ptr<finalcut::FCanvas> canvas{};
     finalcut::FString        report{};
     time_point<system_clock> start{};
     time_point<system_clock> end{};
@@ -81,12 +87,17 @@ class RotoZoomer final : public finalcut::FDialog
 
 
 //----------------------------------------------------------------------
-RotoZoomer::RotoZoomer (finalcut::FWidget* parent, bool is_benchmark, int num_loops)
+RotoZoomer::RotoZoomer ( finalcut::FWidget* parent, bool is_benchmark
+                       , int num_loops, bool use_canvas )
   : finalcut::FDialog{parent}
   , benchmark{is_benchmark}
   , loops{num_loops}
 {
   FDialog::setText ("Rotozoomer effect");
+
+  if ( use_canvas )  // Half-block pixels instead of characters
+    canvas = std::make_unique<finalcut::FCanvas>(this);
+
   const std::array<wchar_t, 4> init_val{{L' ', L'+', L'x', L' '}};
   std::size_t h{0};
 
@@ -107,6 +118,16 @@ RotoZoomer::RotoZoomer (finalcut::FWidget* parent, bool is_benchmark, int num_lo
       }
     }
   }
+
+  for (std::size_t i{0}; i < data.size(); i++)
+  {
+    if ( data[i] == L'+' )
+      texture[i] = FColor::Red;
+    else if ( data[i] == L'x' )
+      texture[i] = FColor::Cyan;
+    else
+      texture[i] = FColor::White;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -116,11 +137,21 @@ void RotoZoomer::draw()
     start = system_clock::now();
 
   finalcut::FDialog::draw();
+  drawEffect();
+}
+
+//----------------------------------------------------------------------
+void RotoZoomer::drawEffect()
+{
   auto a  = double(path) / 50.0;
   auto r  = double(128.0 + 96.0 * std::cos(double(path) / 10.0));
   auto cx = double(80.0 / 2.0 + (80.0 / 2.0 * std::sin(a)));
   auto cy = double(23.0 + (23.0 * std::cos(a)));
-  rotozoomer (cx, cy, r, a);
+
+  if ( canvas )
+    rotozoomerCanvas (cx, cy, r, a);
+  else
+    rotozoomer (cx, cy, r, a);
 }
 
 //----------------------------------------------------------------------
@@ -166,6 +197,42 @@ inline void RotoZoomer::rotozoomer (double cx, double cy, double r, double a)
   }
 }
 
+//----------------------------------------------------------------------
+void RotoZoomer::rotozoomerCanvas (double cx, double cy, double r, double a)
+{
+  // Renders two pixels per character cell into the canvas tiles
+  // and writes the cells directly into the window area
+
+  const auto Ax   = int(4096.0 * (cx + r * std::cos(a)));
+  const auto Ay   = int(4096.0 * (cy + r * std::sin(a)));
+  const auto Bx   = int(4096.0 * (cx + r * std::cos(a + 2.02358)));
+  const auto By   = int(4096.0 * (cy + r * std::sin(a + 2.02358)));
+  const auto Cx   = int(4096.0 * (cx + r * std::cos(a - 1.11701)));
+  const auto Cy   = int(4096.0 * (cy + r * std::sin(a - 1.11701)));
+  const int  dxdx = (Bx - Ax) / 80;
+  const int  dydx = (By - Ay) / 80;
+  const int  dxdy = (Cx - Ax) / 46;  // Two pixel rows per line
+  const int  dydy = (Cy - Ay) / 46;
+  auto& pixels = *canvas;
+
+  canvas->render ([&] (const finalcut::FRect& tile)
+  {
+    for (auto y = tile.getY1(); y <= tile.getY2(); y++)
+    {
+      auto* line = pixels.getPixelLine(std::size_t(y));
+      auto x_pos = Ax + y * dxdy + tile.getX1() * dxdx;
+      auto y_pos = Ay + y * dydy + tile.getX1() * dydx;
+
+      for (auto x = tile.getX1(); x <= tile.getX2(); x++)
+      {
+        line[x] = texture[std::size_t(((y_pos >> 14) & 0xf) + ((x_pos >> 10) & 0xf0))];
+        x_pos += dxdx;
+        y_pos += dydx;
+      }
+    }
+  });
+}
+
 //----------------------------------------------------------------------
 void RotoZoomer::generateReport()
 {
@@ -206,7 +273,11 @@ void RotoZoomer::onShow (finalcut::FShowEvent*)
   {
     for (path = 1; path < loops; path++)
     {
-      redraw();
+      if ( canvas )
+        drawEffect();  // Only the canvas changes
+      else
+        redraw();
+
       forceTerminalUpdate();
     }
 
@@ -225,7 +296,11 @@ void RotoZoomer::onTimer (finalcut::FTimerEvent*)
   else
     path++;
 
-  redraw();
+  if ( canvas )
+    drawEffect();
+  else
+    redraw();
+
   forceTerminalUpdate();
 }
 
@@ -271,6 +346,9 @@ void RotoZoomer::adjustSize()
   }
 
   finalcut::FDialog::adjustSize();
+
+  if ( canvas )
+    canvas->setGeometry (FPoint{1, 1}, FSize{getClientWidth(), getClientHeight()});
 }
 
 //----------------------------------------------------------------------
@@ -279,6 +357,7 @@ void RotoZoomer::adjustSize()
 auto main (int argc, char* argv[]) -> int
 {
   bool benchmark{false};
+  bool use_canvas{false};
   finalcut::FString report{};
   int quit_code{0};
 
@@ -287,12 +366,18 @@ auto main (int argc, char* argv[]) -> int
   {
     std::cout << "RotoZoomer options:\n"
               << "  -b, --benchmark               "
-              << "Starting a benchmark run\n\n";
+              << "Starting a benchmark run\n"
+              << "  -c, --canvas-benchmark        "
+              << "Starting a benchmark run with FCanvas\n\n";
   }
   else if ( argv[1] && ( strcmp(argv[1], "--benchmark") == 0
-                      || strcmp(argv[1], "-b") == 0 ) )
+                      || strcmp(argv[1], "-b") == 0
+                      || strcmp(argv[1], "--canvas-benchmark") == 0
+                      || strcmp(argv[1], "-c") == 0 ) )
   {
     benchmark = true;
+    use_canvas = ( strcmp(argv[1], "--canvas-benchmark") == 0
+                || strcmp(argv[1], "-c") == 0 );
     // Disable terminal data requests
     auto& start_options = finalcut::FStartOptions::getInstance();
     start_options.terminal_data_request = false;
@@ -304,7 +389,7 @@ auto main (int argc, char* argv[]) -> int
 
     // Create a simple dialog box
     constexpr int iterations = 314;
-    RotoZoomer roto{&app, benchmark, iterations};
+    RotoZoomer roto{&app, benchmark, iterations, use_canvas};
 
     if ( benchmark )
       roto.setGeometry (FPoint{1, 1}, FSize{80, 24});
@@ -324,7 +409,8 @@ auto main (int argc, char* argv[]) -> int
 
   if ( benchmark )
   {
-    std::cout << "Benchmark:\n" << report;
+    std::cout << ( use_canvas ? "Benchmark (FCanvas):\n" : "Benchmark:\n" )
+              << report;
   }
 
   return quit_code;
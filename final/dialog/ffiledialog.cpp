@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -20,7 +20,26 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#if defined(__linux__)
+  #include <sys/inotify.h>
+#endif
+
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cwctype>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -30,7 +49,9 @@
 
 #include "final/dialog/ffiledialog.h"
 #include "final/fevent.h"
+#include "final/util/flrucache.h"
 #include "final/util/fsystem.h"
+#include "final/util/futf8.h"
 
 #if defined(__GNU__)
   #define MAXPATHLEN 4096  // Necessity at GNU Hurd
@@ -39,20 +60,76 @@
 namespace finalcut
 {
 
-// non-member functions
+// Function prototypes
+auto getFoldedChar (const std::string&, std::size_t&) -> uInt32;
+auto compareNames (const std::string&, const std::string&) -> int;
+
+// Functions
+//----------------------------------------------------------------------
+inline auto getFoldedChar (const std::string& str, std::size_t& pos) -> uInt32
+{
+  // Reads the UTF-8 character at pos and returns it in lower case.
+  // A byte of an ill-formed sequence is mapped to U+DC80..U+DCFF.
+
+  const auto byte = uChar(str[pos]);
+
+  if ( byte < 0x80 )  // ASCII
+  {
+    pos++;
+    return uInt32(std::tolower(byte));
+  }
+
+  uInt32 code{};
+  const auto length = decodeUTF8Char(str.data() + pos, str.length() - pos, code);
+
+  if ( length == 0 )
+  {
+    pos++;
+    return 0xdc00 + byte;
+  }
+
+  pos += length;
+  return uInt32(std::towlower(wint_t(code)));
+}
+
 //----------------------------------------------------------------------
-auto sortByName ( const FFileDialog::FDirEntry& lhs
-                , const FFileDialog::FDirEntry& rhs ) -> bool
+inline auto compareNames (const std::string& lhs, const std::string& rhs) -> int
 {
-  // lhs < rhs
-  return FStringCaseCompare(lhs.name, rhs.name) < 0;
+  // Case-insensitive comparison after the wide character case folding
+
+  std::size_t lpos{0};
+  std::size_t rpos{0};
+
+  while ( lpos < lhs.length() && rpos < rhs.length() )
+  {
+    const auto lchar = getFoldedChar(lhs, lpos);
+    const auto rchar = getFoldedChar(rhs, rpos);
+
+    if ( lchar != rchar )
+      return ( lchar < rchar ) ? -1 : 1;
+  }
+
+  return int(lpos < lhs.length()) - int(rpos < rhs.length());
 }
 
+
+// non-member functions
 //----------------------------------------------------------------------
-auto sortDirFirst (const FFileDialog::FDirEntry& entry) -> bool
+auto sortDirEntries ( const FFileDialog::FDirEntry& lhs
+                    , const FFileDialog::FDirEntry& rhs ) -> bool
 {
-  // sort directories first
-  return entry.directory;
+  // lhs < rhs: ".." first, then the directories, then the files
+
+  const bool lhs_parent = lhs.name == "..";
+  const bool rhs_parent = rhs.name == "..";
+
+  if ( lhs_parent || rhs_parent )
+    return lhs_parent && ! rhs_parent;
+
+  if ( lhs.directory != rhs.directory )
+    return lhs.directory;
+
+  return compareNames(lhs.name, rhs.name) < 0;
 }
 
 //----------------------------------------------------------------------
@@ -90,6 +167,415 @@ auto fileChooser ( FWidget* parent
 }
 
 
+//----------------------------------------------------------------------
+// class FFileDialog::FDirReader
+//----------------------------------------------------------------------
+
+// Reads a directory stream in a detached thread. The thread owns a
+// reference to the reader, so a canceled reader never blocks the dialog
+// (e.g. on a slow network file system).
+
+class FFileDialog::FDirReader
+{
+  public:
+    // Constructor
+    explicit FDirReader (DIR*);
+
+    // Accessors
+    auto getEntryCount() -> std::size_t;
+    auto takeEntries (DirEntries&) -> ReadStatus;
+
+    // Inquiry
+    auto isFinished() -> bool;
+
+    // Methods
+    static void run (const FDirReaderPtr&);
+    auto wait (int) -> bool;
+    void cancel();
+
+  private:
+    // Constant
+    static constexpr std::size_t BATCH_SIZE = 1024;
+
+    // Methods
+    void read();
+    void publish (DirEntries&);
+    static void setEntryType (int, const struct dirent*, FDirEntry&);
+
+    // Data members
+    DIR*                    directory_stream{nullptr};
+    DirEntries              entries{};
+    ReadStatus              status{ReadStatus::reading};
+    std::atomic<bool>       canceled{false};
+    std::mutex              mutex{};
+    std::condition_variable finished{};
+};
+
+//----------------------------------------------------------------------
+FFileDialog::FDirReader::FDirReader (DIR* stream)
+  : directory_stream{stream}
+{ }
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirReader::getEntryCount() -> std::size_t
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return entries.size();
+}
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirReader::takeEntries (DirEntries& result) -> ReadStatus
+{
+  // Moves the entries read so far into result
+
+  std::lock_guard<std::mutex> lock(mutex);
+  result.swap(entries);
+  entries.clear();
+  return status;
+}
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirReader::isFinished() -> bool
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return status != ReadStatus::reading;
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirReader::run (const FDirReaderPtr& reader)
+{
+  reader->read();
+}
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirReader::wait (int ms) -> bool
+{
+  // Waits until the reading is finished or the time has expired
+
+  std::unique_lock<std::mutex> lock(mutex);
+  return finished.wait_for ( lock
+                           , std::chrono::milliseconds(ms)
+                           , [this] ()
+                             {
+                               return status != ReadStatus::reading;
+                             } );
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirReader::cancel()
+{
+  canceled = true;
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirReader::read()
+{
+  const int fd = dirfd(directory_stream);
+  auto result = ReadStatus::success;
+  DirEntries batch{};
+  batch.reserve(BATCH_SIZE);
+
+  while ( ! canceled )
+  {
+    errno = 0;
+    const struct dirent* next = readdir(directory_stream);
+
+    if ( ! next )
+    {
+      if ( errno != 0 )
+        result = ReadStatus::read_error;
+
+      break;
+    }
+
+    if ( next->d_name[0] == '.' && next->d_name[1] == '\0' )
+      continue;  // Skip name = "."
+
+    FDirEntry entry{};
+    entry.name = next->d_name;
+    setEntryType (fd, next, entry);
+    batch.push_back(std::move(entry));
+
+    if ( batch.size() >= BATCH_SIZE )
+      publish (batch);
+  }
+
+  if ( closedir(directory_stream) != 0 && result == ReadStatus::success )
+    result = ReadStatus::close_error;
+
+  publish (batch);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    status = result;
+  }
+
+  finished.notify_all();
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirReader::publish (DirEntries& batch)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if ( entries.empty() )
+    entries.swap(batch);
+  else
+    entries.insert ( entries.end()
+                   , std::make_move_iterator(batch.begin())
+                   , std::make_move_iterator(batch.end()) );
+
+  batch.clear();
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirReader::setEntryType ( int fd
+                                           , const struct dirent* d_entry
+                                           , FDirEntry& entry )
+{
+  struct stat sb{};
+
+#if defined _DIRENT_HAVE_D_TYPE || defined HAVE_STRUCT_DIRENT_D_TYPE
+  if ( d_entry->d_type != DT_UNKNOWN )
+  {
+    entry.fifo             = d_entry->d_type == DT_FIFO;
+    entry.character_device = d_entry->d_type == DT_CHR;
+    entry.directory        = d_entry->d_type == DT_DIR;
+    entry.block_device     = d_entry->d_type == DT_BLK;
+    entry.regular_file     = d_entry->d_type == DT_REG;
+    entry.symbolic_link    = d_entry->d_type == DT_LNK;
+    entry.socket           = d_entry->d_type == DT_SOCK;
+
+    // Only a symbolic link needs a stat call for the type of its target
+    if ( entry.symbolic_link && fstatat(fd, d_entry->d_name, &sb, 0) == 0 )
+      entry.directory = S_ISDIR(sb.st_mode);
+
+    return;
+  }
+#endif
+
+  if ( fstatat(fd, d_entry->d_name, &sb, AT_SYMLINK_NOFOLLOW) != 0 )
+    return;  // Cannot get file status
+
+  entry.fifo             = S_ISFIFO (sb.st_mode);
+  entry.character_device = S_ISCHR (sb.st_mode);
+  entry.directory        = S_ISDIR (sb.st_mode);
+  entry.block_device     = S_ISBLK (sb.st_mode);
+  entry.regular_file     = S_ISREG (sb.st_mode);
+  entry.symbolic_link    = S_ISLNK (sb.st_mode);
+  entry.socket           = S_ISSOCK (sb.st_mode);
+
+  if ( entry.symbolic_link && fstatat(fd, d_entry->d_name, &sb, 0) == 0 )
+    entry.directory = S_ISDIR(sb.st_mode);
+}
+
+
+//----------------------------------------------------------------------
+// class FFileDialog::FDirCache
+//----------------------------------------------------------------------
+
+// Keeps the sorted entries of the recently read directories. On Linux,
+// inotify discards a cached directory as soon as its content changes.
+// Without change notification nothing is cached.
+
+class FFileDialog::FDirCache
+{
+  public:
+    // Constructor
+    FDirCache() = default;
+
+    // Disable copy constructor
+    FDirCache (const FDirCache&) = delete;
+
+    // Destructor
+    ~FDirCache() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FDirCache&) -> FDirCache& = delete;
+
+    // Methods
+    void watch (const std::string&);
+    auto find (const std::string&) -> const DirEntries*;
+    void insert (const std::string&, DirEntries&&);
+
+  private:
+    // Constant
+    static constexpr std::size_t CACHE_SIZE = 8;
+
+    // Methods
+    void processEvents();
+    auto isWatched (const std::string&) const -> bool;
+    void removeUnusedWatches();
+
+    // Data members
+    FLruCache<std::string, DirEntries>   cache{CACHE_SIZE};
+#if defined(__linux__)
+    int                                  inotify_fd{-1};
+    std::unordered_map<int, std::string> watches{};
+    std::unordered_set<std::string>      changed{};
+#endif
+};
+
+//----------------------------------------------------------------------
+FFileDialog::FDirCache::~FDirCache() noexcept  // destructor
+{
+#if defined(__linux__)
+  if ( inotify_fd >= 0 )
+    ::close(inotify_fd);
+#endif
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirCache::watch (const std::string& path)
+{
+  // Watches the directory before reading it,
+  // so that no change can be missed
+
+#if defined(__linux__)
+  if ( inotify_fd < 0 )
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+  if ( inotify_fd < 0 )
+    return;
+
+  processEvents();
+  const uInt32 mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO
+                    | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+  const int wd = inotify_add_watch(inotify_fd, path.c_str(), mask);
+
+  if ( wd < 0 )
+    return;
+
+  watches[wd] = path;
+  changed.erase(path);
+#else
+  static_cast<void>(path);
+#endif
+}
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirCache::find (const std::string& path) -> const DirEntries*
+{
+#if defined(__linux__)
+  if ( inotify_fd < 0 )
+    return nullptr;
+
+  processEvents();
+  return cache.find(path);
+#else
+  static_cast<void>(path);
+  return nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirCache::insert (const std::string& path, DirEntries&& entries)
+{
+#if defined(__linux__)
+  if ( inotify_fd < 0 )
+    return;
+
+  processEvents();
+
+  // Do not cache a directory that has changed during reading
+  if ( changed.find(path) != changed.end() || ! isWatched(path) )
+    return;
+
+  std::sort (entries.begin(), entries.end(), sortDirEntries);
+  cache.insert (path, std::move(entries));
+  removeUnusedWatches();
+#else
+  static_cast<void>(path);
+  static_cast<void>(entries);
+#endif
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirCache::processEvents()
+{
+  // Discards the cache entries of changed directories
+
+#if defined(__linux__)
+  alignas(struct inotify_event) std::array<char, 4096> buffer{};
+
+  while ( true )
+  {
+    const auto length = ::read(inotify_fd, buffer.data(), buffer.size());
+
+    if ( length <= 0 )
+      break;
+
+    const char* ptr = buffer.data();
+    const char* const end = buffer.data() + length;
+
+    while ( ptr < end )
+    {
+      const auto event = reinterpret_cast<const struct inotify_event*>(ptr);
+      ptr += sizeof(struct inotify_event) + event->len;
+
+      if ( event->mask & IN_Q_OVERFLOW )
+      {
+        // Events were lost
+        for (const auto& w : watches)
+          changed.insert(w.second);
+
+        cache.clear();
+        continue;
+      }
+
+      const auto iter = watches.find(event->wd);
+
+      if ( iter == watches.end() )
+        continue;
+
+      cache.erase(iter->second);
+      changed.insert(iter->second);
+
+      if ( event->mask & IN_IGNORED )  // Watch was removed
+        watches.erase(iter);
+    }
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+auto FFileDialog::FDirCache::isWatched (const std::string& path) const -> bool
+{
+#if defined(__linux__)
+  return std::any_of ( watches.cbegin()
+                     , watches.cend()
+                     , [&path] (const auto& w)
+                       {
+                         return w.second == path;
+                       } );
+#else
+  static_cast<void>(path);
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::FDirCache::removeUnusedWatches()
+{
+#if defined(__linux__)
+  auto iter = watches.begin();
+
+  while ( iter != watches.end() )
+  {
+    if ( cache.contains(iter->second) )
+    {
+      ++iter;
+      continue;
+    }
+
+    inotify_rm_watch (inotify_fd, iter->first);
+    changed.erase(iter->second);
+    iter = watches.erase(iter);
+  }
+#endif
+}
+
+
 //----------------------------------------------------------------------
 // class FFileDialog
 //----------------------------------------------------------------------
@@ -118,13 +604,19 @@ FFileDialog::FFileDialog ( const FString& dirname
 }
 
 //----------------------------------------------------------------------
-FFileDialog::~FFileDialog() noexcept = default;  // destructor
+FFileDialog::~FFileDialog() noexcept  // destructor
+{
+  cancelReading();
+}
 
 
 // public methods of FFileDialog
 //----------------------------------------------------------------------
 auto FFileDialog::getSelectedFile() const -> FString
 {
+  if ( filebrowser.currentItem() == 0 )
+    return {""};
+
   const auto n = uLong(filebrowser.currentItem() - 1);
 
   if ( dir_entries[n].directory )
@@ -210,6 +702,31 @@ void FFileDialog::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FFileDialog::onTimer (FTimerEvent* ev)
+{
+  if ( ev->getTimerId() != load_timer || ! reader )
+    return;
+
+  // The list is only extended after a noticeable growth,
+  // so that it is not redrawn for every few entries
+  if ( ! reader->isFinished()
+    && reader->getEntryCount() < std::max(read_entries.size() / 4, std::size_t(1)) )
+    return;
+
+  const auto count = dir_entries.size();
+
+  if ( processEntries() == ReadStatus::reading
+    && count == dir_entries.size() )
+    return;  // Nothing new
+
+  if ( isShown() )
+  {
+    filename.redraw();
+    filebrowser.redraw();
+  }
+}
+
 //----------------------------------------------------------------------
 auto FFileDialog::fileOpenChooser ( FWidget* parent
                                   , const FString& dirname
@@ -352,9 +869,21 @@ inline auto FFileDialog::patternMatch ( const std::string& pattern
   return ( fnmatch(search.data(), fname.data(), FNM_PERIOD) == 0 );
 }
 
+//----------------------------------------------------------------------
+auto FFileDialog::getDirCache() -> FDirCache&
+{
+  static FDirCache dir_cache{};
+  return dir_cache;
+}
+
 //----------------------------------------------------------------------
 void FFileDialog::clear()
 {
+  select_name.clear();
+  select_first = false;
+  unsorted_entries = false;
+  read_entries.clear();
+
   if ( dir_entries.empty() )
     return;
 
@@ -363,118 +892,39 @@ void FFileDialog::clear()
 }
 
 //----------------------------------------------------------------------
-auto FFileDialog::numOfDirs() -> sInt64
+auto FFileDialog::readDir() -> int
 {
-  if ( dir_entries.empty() )
-    return 0;
+  cancelReading();
 
-  const sInt64 n = std::count_if ( std::begin(dir_entries)
-                                 , std::end(dir_entries)
-                                 , [] (const auto& entry)
-                                   {
-                                     return entry.directory
-                                         && entry.name != ".";
-                                   }
-                                 );
-  return n;
-}
-
-//----------------------------------------------------------------------
-void FFileDialog::sortDir()
-{
-  const sInt64 start = dir_entries.cbegin()->name == ".." ? 1 : 0;
-  const sInt64 dir_num = numOfDirs();
-  // directories first
-  std::partition ( dir_entries.begin() + start
-                 , dir_entries.end()
-                 , sortDirFirst );
-  // sort directories by name
-  std::sort ( dir_entries.begin() + start
-            , dir_entries.begin() + dir_num
-            , sortByName );
-  // sort files by name
-  std::sort ( dir_entries.begin() + dir_num
-            , dir_entries.end()
-            , sortByName );
-}
+  if ( readCachedDir() )
+    return 0;
 
-//----------------------------------------------------------------------
-auto FFileDialog::readDir() -> int
-{
   auto directory_stream = openDirectory();
 
   if ( ! directory_stream )
     return -1;
 
   clear();
-  readDirEntries (directory_stream);
+  filebrowser.clear();
 
-  if ( closeDirectory (directory_stream) == CloseDir::error )
+  if ( startReading(directory_stream) == ReadStatus::close_error )
     return -2;
 
-  sortDir();
-
-  // Insert directory entries into the list
-  dirEntriesToList();
   return 0;
 }
 
 //----------------------------------------------------------------------
-void FFileDialog::getEntry (const char* const dir, const struct dirent* d_entry)
+auto FFileDialog::readCachedDir() -> bool
 {
-  const auto& filter = filter_pattern.toString();
-  FDirEntry entry{};
-
-  entry.name = d_entry->d_name;
+  const auto entries = getDirCache().find(directory.toString());
 
-#if defined _DIRENT_HAVE_D_TYPE || defined HAVE_STRUCT_DIRENT_D_TYPE
-  entry.fifo             = (d_entry->d_type & DT_FIFO) == DT_FIFO;
-  entry.character_device = (d_entry->d_type & DT_CHR ) == DT_CHR;
-  entry.directory        = (d_entry->d_type & DT_DIR ) == DT_DIR;
-  entry.block_device     = (d_entry->d_type & DT_BLK ) == DT_BLK;
-  entry.regular_file     = (d_entry->d_type & DT_REG ) == DT_REG;
-  entry.symbolic_link    = (d_entry->d_type & DT_LNK ) == DT_LNK;
-  entry.socket           = (d_entry->d_type & DT_SOCK) == DT_SOCK;
-#else
-  struct stat s{};
-  stat (entry.name.c_str(), &s);
-  entry.fifo             = S_ISFIFO (s.st_mode);
-  entry.character_device = S_ISCHR (s.st_mode);
-  entry.directory        = S_ISDIR (s.st_mode);
-  entry.block_device     = S_ISBLK (s.st_mode);
-  entry.regular_file     = S_ISREG (s.st_mode);
-  entry.symbolic_link    = S_ISLNK (s.st_mode);
-  entry.socket           = S_ISSOCK (s.st_mode);
-#endif
+  if ( ! entries )
+    return false;
 
-  followSymLink (dir, entry);
-
-  if ( entry.directory || patternMatch(filter, entry.name) )
-    dir_entries.push_back (entry);
-  else
-    entry.name.clear();
-}
-
-//----------------------------------------------------------------------
-void FFileDialog::followSymLink (const char* const dir, FDirEntry& entry) const
-{
-  if ( ! entry.symbolic_link )
-    return;  // No symbolic link
-
-  std::array<char, MAXPATHLEN> resolved_path{};
-  std::string symLink{};
-  symLink.reserve(MAXPATHLEN);
-  struct stat sb{};
-  const auto& fsystem = FSystem::getInstance();
-  symLink = dir + entry.name;
-
-  if ( fsystem->realpath(symLink.data(), resolved_path.data()) == nullptr )
-    return;  // Cannot follow the symlink
-
-  if ( lstat(resolved_path.data(), &sb) == -1 )
-    return;  // Cannot get file status
-
-  entry.directory = S_ISDIR(sb.st_mode);
+  clear();
+  filebrowser.clear();
+  addEntries (*entries);
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -492,76 +942,157 @@ auto FFileDialog::openDirectory() -> DIR*
 }
 
 //----------------------------------------------------------------------
-auto FFileDialog::closeDirectory (DIR* directory_stream) -> CloseDir
+auto FFileDialog::startReading (DIR* directory_stream) -> ReadStatus
 {
-  auto ret = closedir(directory_stream);
+  // Small directories are listed immediately, large ones
+  // are delivered in portions by the load timer
 
-  if ( ret )
+  getDirCache().watch(directory.toString());
+  reader = std::make_shared<FDirReader>(directory_stream);
+
+  try
   {
-    FMessageBox::error (this, "Closing directory\n" + directory);
-    return CloseDir::error;
+    std::thread{&FDirReader::run, reader}.detach();
   }
+  catch (const std::system_error&)
+  {
+    FDirReader::run(reader);  // No thread available
+  }
+
+  reader->wait(LOAD_WAIT_TIME);
+  const auto status = processEntries();
 
-  return CloseDir::success;
+  if ( status == ReadStatus::reading )
+    load_timer = addTimer(LOAD_INTERVAL);
+
+  return status;
 }
 
 //----------------------------------------------------------------------
-void FFileDialog::readDirEntries (DIR* directory_stream)
+void FFileDialog::cancelReading()
 {
-  const auto& dir = directory.c_str();
-
-  while ( true )
+  if ( load_timer )
   {
-    errno = 0;
-    const struct dirent* next = readdir(directory_stream);
-
-    if ( next )
-    {
-      if ( isCurrentDirectory(next) )
-        continue;  // Skip name = "."
+    delTimer (load_timer);
+    load_timer = 0;
+  }
 
-      if ( ! show_hidden && isHiddenEntry(next) )
-        continue;  // Skip hidden entries
+  if ( ! reader )
+    return;
 
-      if ( isRootDirectory(dir) && isParentDirectory(next) )
-        continue;  // Skip ".." for the root directory
+  reader->cancel();
+  reader.reset();  // The reader thread releases the last reference
+}
 
-      getEntry(dir, next);
-    }
-    else
-    {
-      if ( errno != 0 )
-        FMessageBox::error (this, "Reading directory\n" + directory);
+//----------------------------------------------------------------------
+auto FFileDialog::processEntries() -> ReadStatus
+{
+  DirEntries entries{};
+  const auto status = reader->takeEntries(entries);
+  addEntries (entries);
+  read_entries.insert ( read_entries.end()
+                      , std::make_move_iterator(entries.begin())
+                      , std::make_move_iterator(entries.end()) );
+
+  if ( status != ReadStatus::reading )
+  {
+    sortEntries();
+    finishReading (status);
+  }
 
-      break;
-    }
-  }  // end while
+  selectPendingEntry();
+  return status;
 }
 
 //----------------------------------------------------------------------
-auto FFileDialog::isCurrentDirectory (const struct dirent* entry) const -> bool
+void FFileDialog::finishReading (ReadStatus status)
 {
-  // name = "." (current directory)
-  return entry->d_name[0] == '.'
-      && entry->d_name[1] == '\0';
+  cancelReading();
+
+  if ( status == ReadStatus::success )
+  {
+    getDirCache().insert (directory.toString(), std::move(read_entries));
+    read_entries.clear();
+    return;
+  }
+
+  read_entries.clear();
+
+  if ( status == ReadStatus::read_error )
+    FMessageBox::error (this, "Reading directory\n" + directory);
+  else
+    FMessageBox::error (this, "Closing directory\n" + directory);
 }
 
 //----------------------------------------------------------------------
-auto FFileDialog::isParentDirectory (const struct dirent* entry) const -> bool
+void FFileDialog::addEntries (const DirEntries& entries)
 {
-  // name = ".." (parent directory)
-  return entry->d_name[0] == '.'
-      && entry->d_name[1] == '.'
-      && entry->d_name[3] == '\0';
+  // Appends the visible entries to the list. Each batch is sorted
+  // by itself, the whole list is sorted once after reading.
+
+  const auto& filter = filter_pattern.toString();
+  const bool root = isRootDirectory(directory.c_str());
+  const auto old_size = dir_entries.size();
+
+  std::copy_if ( entries.cbegin()
+               , entries.cend()
+               , std::back_inserter(dir_entries)
+               , [this, &filter, root] (const auto& entry)
+                 {
+                   if ( entry.name == ".." )
+                     return ! root;  // Skip ".." for the root directory
+
+                   if ( ! show_hidden && entry.name[0] == '.' )
+                     return false;  // Skip hidden entries
+
+                   return entry.directory || patternMatch(filter, entry.name);
+                 }
+               );
+
+  if ( dir_entries.size() == old_size )
+    return;
+
+  const auto middle = dir_entries.begin() + std::ptrdiff_t(old_size);
+  std::sort (middle, dir_entries.end(), sortDirEntries);
+
+  if ( old_size > 0 )
+    unsorted_entries = true;
+
+  dirEntriesToList (old_size);
 }
 
 //----------------------------------------------------------------------
-auto FFileDialog::isHiddenEntry (const struct dirent* entry) const -> bool
+void FFileDialog::sortEntries()
 {
-  // name = "." + one or more character
-  return entry->d_name[0] == '.'
-      && entry->d_name[1] != '\0'
-      && entry->d_name[1] != '.';
+  // Merges the sorted batches and refills the list
+
+  if ( ! unsorted_entries )
+    return;
+
+  unsorted_entries = false;
+
+  // Keep the current entry (except the first) after sorting
+  const auto current = filebrowser.currentItem();
+  std::string current_name{};
+
+  if ( current > 1 && current <= dir_entries.size() )
+    current_name = dir_entries[current - 1].name;
+
+  std::sort (dir_entries.begin(), dir_entries.end(), sortDirEntries);
+  filebrowser.clear();
+  dirEntriesToList();
+
+  if ( current_name.empty() )
+    return;
+
+  const auto iter = std::find_if ( dir_entries.cbegin()
+                                 , dir_entries.cend()
+                                 , [&current_name] (const auto& entry)
+                                   {
+                                     return entry.name == current_name;
+                                   }
+                                 );
+  filebrowser.setCurrentItem(std::size_t(iter - dir_entries.cbegin()) + 1);
 }
 
 //----------------------------------------------------------------------
@@ -572,16 +1103,17 @@ auto FFileDialog::isRootDirectory (const char* const dir) const -> bool
 }
 
 //----------------------------------------------------------------------
-void FFileDialog::dirEntriesToList()
+void FFileDialog::dirEntriesToList (std::size_t first)
 {
-  // Fill list with directory entries
+  // Appends the directory entries from position first to the list
 
-  filebrowser.clear();
-
-  if ( dir_entries.empty() )
+  if ( first >= dir_entries.size() )
     return;
 
-  std::for_each ( dir_entries.cbegin()
+  if ( first == 0 )
+    filebrowser.reserve(dir_entries.size());
+
+  std::for_each ( dir_entries.cbegin() + std::ptrdiff_t(first)
                 , dir_entries.cend()
                 , [this] (const auto& entry)
                   {
@@ -596,9 +1128,6 @@ void FFileDialog::dirEntriesToList()
 //----------------------------------------------------------------------
 void FFileDialog::selectDirectoryEntry (const std::string& name)
 {
-  if ( dir_entries.empty() )
-    return;
-
   std::size_t i{1};
 
   for (const auto& entry : dir_entries)
@@ -607,11 +1136,48 @@ void FFileDialog::selectDirectoryEntry (const std::string& name)
     {
       filebrowser.setCurrentItem(i);
       filename.setText(name + '/');
-      break;
+      return;
     }
 
     i++;
   }
+
+  if ( reader )
+    select_name = name;  // Select after loading
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::selectFirstEntry()
+{
+  if ( dir_entries.empty() )
+  {
+    select_first = bool(reader);  // Select after loading
+    return;
+  }
+
+  FString firstname{dir_entries[0].name};
+
+  if ( dir_entries[0].directory )
+    filename.setText(firstname + '/');
+  else
+    filename.setText(firstname);
+}
+
+//----------------------------------------------------------------------
+void FFileDialog::selectPendingEntry()
+{
+  if ( ! select_name.empty() )
+  {
+    const auto name = std::move(select_name);
+    select_name.clear();
+    selectDirectoryEntry (name);
+  }
+
+  if ( select_first && ! dir_entries.empty() )
+  {
+    select_first = false;
+    selectFirstEntry();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -651,14 +1217,7 @@ auto FFileDialog::changeDir (const FString& dirname) -> int
         }
       }
       else
-      {
-        FString firstname{dir_entries[0].name};
-
-        if ( dir_entries[0].directory )
-          filename.setText(firstname + '/');
-        else
-          filename.setText(firstname);
-      }
+        selectFirstEntry();
 
       printPath(directory);
       filename.redraw();
@@ -831,6 +1390,9 @@ void FFileDialog::cb_processRowChanged()
 //----------------------------------------------------------------------
 void FFileDialog::cb_processClicked()
 {
+  if ( filebrowser.currentItem() == 0 )
+    return;
+
   const auto n = uLong(filebrowser.currentItem() - 1);
 
   if ( dir_entries[n].directory )
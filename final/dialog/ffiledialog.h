@@ -65,6 +65,7 @@
 #include <libgen.h>
 #include <unistd.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -118,8 +119,9 @@ class FFileDialog : public FDialog
     void setShowHiddenFiles (bool = true);
     void unsetShowHiddenFiles();
 
-    // Event handler
+    // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onTimer (FTimerEvent*) override;
 
     // Methods
     static auto fileOpenChooser ( FWidget*
@@ -134,8 +136,16 @@ class FFileDialog : public FDialog
     void adjustSize() override;
 
   private:
+    // Class forward declarations
+    class FDirReader;
+    class FDirCache;
+
     // Enumeration
-    enum class CloseDir { success, error };
+    enum class ReadStatus { reading, success, read_error, close_error };
+
+    // Constants
+    static constexpr int LOAD_INTERVAL = 50;  // Entry delivery (ms)
+    static constexpr int LOAD_WAIT_TIME = 100;  // Synchronous wait (ms)
 
     struct FDirEntry
     {
@@ -164,6 +174,7 @@ class FFileDialog : public FDialog
     };
 
     using DirEntries = std::vector<FDirEntry>;
+    using FDirReaderPtr = std::shared_ptr<FDirReader>;
 
     // Methods
     void init();
@@ -171,21 +182,22 @@ class FFileDialog : public FDialog
     void initCallbacks();
     auto patternMatch ( const std::string&
                       , const std::string& ) const -> bool;
+    static auto getDirCache() -> FDirCache&;
     void clear();
-    auto numOfDirs() -> sInt64;
-    void sortDir();
     auto readDir() -> int;
-    void getEntry (const char* const, const struct dirent*);
-    void followSymLink (const char* const, FDirEntry&) const;
+    auto readCachedDir() -> bool;
     auto openDirectory() -> DIR*;
-    auto closeDirectory (DIR*) -> CloseDir;
-    void readDirEntries (DIR*);
-    auto isCurrentDirectory (const struct dirent*) const -> bool;
-    auto isParentDirectory (const struct dirent*) const -> bool;
-    auto isHiddenEntry (const struct dirent*) const -> bool;
+    auto startReading (DIR*) -> ReadStatus;
+    void cancelReading();
+    auto processEntries() -> ReadStatus;
+    void finishReading (ReadStatus);
+    void addEntries (const DirEntries&);
+    void sortEntries();
     auto isRootDirectory (const char* const) const -> bool;
-    void dirEntriesToList();
+    void dirEntriesToList (std::size_t = 0);
     void selectDirectoryEntry (const std::string&);
+    void selectFirstEntry();
+    void selectPendingEntry();
     auto changeDir (const FString&) -> int;
     void printPath (const FString&);
     void setTitelbarText();
@@ -206,21 +218,26 @@ class FFileDialog : public FDialog
     void cb_processShowHidden();
 
     // Data members
-    DirEntries  dir_entries{};
-    FString     directory{};
-    FString     filter_pattern{};
-    FLineEdit   filename{this};
-    FListBox    filebrowser{this};
-    FCheckBox   hidden_check{this};
-    FButton     cancel_btn{this};
-    FButton     open_btn{this};
-    DialogType  dlg_type{DialogType::Open};
-    bool        show_hidden{false};
+    DirEntries    dir_entries{};  // Visible entries in list order
+    DirEntries    read_entries{};  // All entries read so far
+    FDirReaderPtr reader{};
+    std::string   select_name{};  // Entry to select after loading
+    FString       directory{};
+    FString       filter_pattern{};
+    FLineEdit     filename{this};
+    FListBox      filebrowser{this};
+    FCheckBox     hidden_check{this};
+    FButton       cancel_btn{this};
+    FButton       open_btn{this};
+    DialogType    dlg_type{DialogType::Open};
+    bool          show_hidden{false};
+    bool          select_first{false};
+    bool          unsorted_entries{false};  // Sorted batches only
+    int           load_timer{0};
 
     // Friend functions
-    friend auto sortByName ( const FFileDialog::FDirEntry&
-                           , const FFileDialog::FDirEntry& ) -> bool;
-    friend auto sortDirFirst (const FFileDialog::FDirEntry&) -> bool;
+    friend auto sortDirEntries ( const FFileDialog::FDirEntry&
+                               , const FFileDialog::FDirEntry& ) -> bool;
     friend auto fileChooser ( FWidget*
                             , const FString&
                             , const FString&
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2015-2024 Markus Gans                                      *
+* Copyright 2015-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -1486,6 +1486,39 @@ enum class SortOrder
   Unsorted
 };
 
+enum class ChartStyle
+{
+  Braille,    // 2×4 dots per character
+  HalfBlock   // 1×2 blocks per character
+};
+
+enum class CanvasStyle
+{
+  HalfBlock,  // 1×2 pixels per character
+  Quadrant,   // 2×2 pixels per character
+  Braille     // 2×4 pixels per character
+};
+
+// Grapheme cluster break property (Unicode Standard Annex #29)
+enum class GraphemeBreak : uInt8
+{
+  Other                = 0,
+  CR                   = 1,
+  LF                   = 2,
+  Control              = 3,
+  Extend               = 4,
+  ZWJ                  = 5,   // Zero width joiner
+  RegionalIndicator    = 6,
+  Prepend              = 7,
+  SpacingMark          = 8,
+  L                    = 9,   // Hangul leading consonant
+  V                    = 10,  // Hangul vowel
+  T                    = 11,  // Hangul trailing consonant
+  LV                   = 12,  // Hangul syllable
+  LVT                  = 13,  // Hangul syllable
+  ExtendedPictographic = 14
+};
+
 enum class BracketType
 {
   None        = 0,
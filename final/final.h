@@ -57,6 +57,7 @@
 #include <final/output/fcolorpalette.h>
 #include <final/output/foutput.h>
 #include <final/output/tty/fcharmap.h>
+#include <final/output/tty/fcharwidth.h>
 #include <final/output/tty/foptiattr.h>
 #include <final/output/tty/foptimove.h>
 #include <final/output/tty/ftermcap.h>
@@ -74,11 +75,14 @@
 #include <final/util/fdata.h>
 #include <final/util/flogger.h>
 #include <final/util/flog.h>
+#include <final/util/flrucache.h>
 #include <final/util/fpoint.h>
 #include <final/util/frect.h>
 #include <final/util/fsize.h>
 #include <final/util/fstring.h>
 #include <final/util/fsystem.h>
+#include <final/util/futf8.h>
+#include <final/util/fworkerpool.h>
 #include <final/vterm/fcolorpair.h>
 #include <final/vterm/fstyle.h>
 #include <final/vterm/fvtermbuffer.h>
@@ -86,12 +90,16 @@
 #include <final/widget/fbusyindicator.h>
 #include <final/widget/fbuttongroup.h>
 #include <final/widget/fbutton.h>
+#include <final/widget/fcanvas.h>
+#include <final/widget/fchart.h>
 #include <final/widget/fcheckbox.h>
 #include <final/widget/fcombobox.h>
+#include <final/widget/fdatagrid.h>
 #include <final/widget/flabel.h>
 #include <final/widget/flineedit.h>
 #include <final/widget/flistbox.h>
 #include <final/widget/flistview.h>
+#include <final/widget/fmappedtextfile.h>
 #include <final/widget/fprogressbar.h>
 #include <final/widget/fradiobutton.h>
 #include <final/widget/fscrollbar.h>
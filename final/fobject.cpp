@@ -51,6 +51,8 @@ FObject::~FObject()  // destructor
   // Delete children objects
   if ( hasChildren() )
   {
+    // Every child is deleted while it is still linked to its
+    // parent, so that its destructor can reach its window
     auto delete_list = children_list;
 
     for (auto&& obj : delete_list)
@@ -132,11 +134,41 @@ void FObject::delChild (FObject* obj) &
   if ( ! (obj && hasChildren()) )
     return;
 
+  auto iter = std::find (children_list.begin(), children_list.end(), obj);
+
+  if ( iter == children_list.end() )
+    return;
+
   obj->parent_obj = nullptr;
   obj->has_parent = false;
-  auto list_end = children_list.end();
-  auto last = std::remove (children_list.begin(), list_end, obj);
-  children_list.erase(last, list_end);
+  children_list.erase(iter);
+}
+
+//----------------------------------------------------------------------
+void FObject::delChildren (const FObjectList& objects) &
+{
+  // Deletes several child objects from the children list
+  // with a single pass over the list
+
+  if ( objects.empty() || ! hasChildren() )
+    return;
+
+  for (auto&& obj : objects)
+  {
+    if ( obj && obj->parent_obj == this )
+    {
+      obj->parent_obj = nullptr;
+      obj->has_parent = false;
+    }
+  }
+
+  auto last = std::remove_if ( children_list.begin()
+                             , children_list.end()
+                             , [this] (const FObject* obj)
+                               {
+                                 return obj->parent_obj != this;
+                               } );
+  children_list.erase(last, children_list.end());
 }
 
 //----------------------------------------------------------------------
@@ -50,6 +50,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "final/ftimer.h"
@@ -145,11 +146,14 @@ class FObject : public FObjectTimer
     auto  isDirectChild (const FObject*) const & -> bool;
     auto  isWidget() const noexcept -> bool;
     auto  isInstanceOf (const FString&) const -> bool;
+    template <typename T>
+    auto  isInstanceOf() const noexcept -> bool;
 
     // Methods
     void  removeParent() &;
     void  addChild (FObject*) &;
     void  delChild (FObject*) &;
+    void  delChildren (const FObjectList&) &;
     void  setParent (FObject*) &;
 
     // Event handler
@@ -285,6 +289,17 @@ inline auto FObject::isWidget() const noexcept -> bool
 inline auto FObject::isInstanceOf (const FString& classname) const -> bool
 { return classname == getClassName(); }
 
+//----------------------------------------------------------------------
+template <typename T>
+inline auto FObject::isInstanceOf() const noexcept -> bool
+{
+  // Type check without building the class name string.
+  // Unlike isInstanceOf(classname), derived classes also match.
+  static_assert ( std::is_base_of<FObject, T>::value
+                , "T must be derived from FObject" );
+  return dynamic_cast<const T*>(this) != nullptr;
+}
+
 //----------------------------------------------------------------------
 inline void FObject::setWidgetProperty (bool is_widget)
 { widget_object = is_widget; }
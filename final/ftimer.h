@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2022-2023 Markus Gans                                      *
+* Copyright 2022-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -268,8 +268,12 @@ auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
 
   const auto& currentTime = getCurrentTime();
 
-  for (auto&& timer : *timer_list)
+  // The callback can add or delete timers, so that the list
+  // is accessed by index and not by a reference or iterator
+  for (std::size_t i{0}; i < timer_list->size(); i++)
   {
+    auto& timer = (*timer_list)[i];
+
     if ( ! timer.id
       || ! timer.object
       || currentTime < timer.timeout )  // Timer not expired
@@ -283,9 +287,11 @@ auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
     if ( timer.interval > microseconds(0) )
       ++activated;
 
+    const auto id = timer.id;
+    auto object = timer.object;
     lock.unlock();
-    FTimerEvent t_ev(Event::Timer, timer.id);
-    callback (timer.object, &t_ev);
+    FTimerEvent t_ev(Event::Timer, id);
+    callback (object, &t_ev);
     lock.lock();
   }
 
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2015-2024 Markus Gans                                      *
+* Copyright 2015-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -1305,11 +1305,7 @@ void FWidget::hideArea (const FSize& size)
   if ( size.getWidth() == 0 )
     return;
 
-  for (auto y{0}; y < int(size.getHeight()); y++)
-  {
-    print() << FPoint{1, 1 + y} << FString{size.getWidth(), L' '};
-  }
-
+  fillRect (FRect{FPoint{1, 1}, size});
   flush();
 }
 
@@ -1688,7 +1684,6 @@ void FWidget::initRootWidget()
 
   // Root widget basic initialization
   internal::var::root_widget = this;
-  finalcut::initByte1PrintTransMask();  // FWidget helper functions
   first_shown_widget = nullptr;
   redraw_root_widget = nullptr;
   modal_dialog_counter = 0;
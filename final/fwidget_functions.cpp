@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2019-2024 Markus Gans                                      *
+* Copyright 2019-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -37,56 +37,7 @@
 namespace finalcut
 {
 
-namespace internal
-{
-
-struct var
-{
-  static uInt8 b1_print_trans_mask;
-};
-
-uInt8 var::b1_print_trans_mask{};
-
-}  // namespace internal
-
-//----------------------------------------------------------------------
-struct TransparentShadowData
-{
-  // Using-declaration
-  using FTermArea = FVTerm::FTermArea;
-
-  // Data members
-  FTermArea& area;
-  uInt       width{};
-  uInt       height{};
-  uInt       shadow_width{};
-  uInt       shadow_height{};
-  FChar      transparent_char{};
-  FChar      color_overlay_char{};
-  FChar*     area_pos{};
-};
-
-
-// Function forward declarations
-//----------------------------------------------------------------------
-void drawRightShadow (TransparentShadowData&);
-void drawBottomShadow (TransparentShadowData&);
-
-
 // FWidget non-member functions
-//----------------------------------------------------------------------
-void initByte1PrintTransMask()
-{
-  // Set bits that must not be reset
-  FCharAttribute mask{};
-  mask.transparent = true;
-  mask.color_overlay = true;
-  mask.inherit_background = true;
-  mask.no_changes = true;
-  mask.printed = true;
-  internal::var::b1_print_trans_mask = getFAttributeByte(mask, 1);
-}
-
 //----------------------------------------------------------------------
 auto isFocusNextKey (const FKey key) -> bool
 {
@@ -392,77 +343,44 @@ void drawTransparentShadow (FWidget* w)
   if ( ! w || ! w->getPrintArea() )
     return;
 
-  auto& area = *w->getPrintArea();
+  auto area = w->getPrintArea();
   const auto& wc = FWidget::getColorTheme();
-
-  TransparentShadowData data
+  const FChar transparent_char
   {
-    area,
-    uInt(area.size.width),
-    uInt(area.size.height),
-    uInt(area.shadow.width),
-    uInt(area.shadow.height),
-    {
-      { { L'\0',  L'\0', L'\0', L'\0', L'\0' } },
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
-      FColor::Default,
-      FColor::Default,
-      { { 0x00, 0x20, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x32 = transparent)
-    },
-    {
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
-      wc->shadow.fg,
-      wc->shadow.bg,
-      { { 0x00, 0x40, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x64 = color_overlay)
-    },
-    &area.getFChar(area.size.width, 0)
+    { { L'\0',  L'\0', L'\0', L'\0', L'\0' } },
+    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
+    FColor::Default,
+    FColor::Default,
+    { { 0x00, 0x20, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x32 = transparent)
   };
-
-  drawRightShadow(data);
-  drawBottomShadow(data);
-  area.has_changes = true;
-
-  if ( FVTerm::getFOutput()->isMonochron() )
-    w->setReverse(false);
-}
-
-//----------------------------------------------------------------------
-inline void drawRightShadow (TransparentShadowData& d)
-{
-  if ( d.shadow_width > 0 )  // Draw right shadow
+  const FChar color_overlay_char
   {
-    std::fill (d.area_pos, d.area_pos + d.shadow_width, d.transparent_char);
-    d.area.changes[0].xmin = std::min(d.area.changes[0].xmin, d.width);
-    d.area.changes[0].xmax = d.width + d.shadow_width - 1;
-    d.area.changes[0].trans_count += d.shadow_width;
+    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
+    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
+    wc->shadow.fg,
+    wc->shadow.bg,
+    { { 0x00, 0x40, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x64 = color_overlay)
+  };
+  const auto width = std::size_t(area->size.width);
+  const auto height = std::size_t(area->size.height);
+  const auto shadow_width = std::size_t(area->shadow.width);
+  const auto shadow_height = std::size_t(area->shadow.height);
 
-    for (std::size_t y{1}; y < d.height; y++)
-    {
-      d.area_pos += d.shadow_width + d.width;
-      d.area.changes[y].xmin = std::min(d.area.changes[y].xmin, d.width);
-      d.area.changes[y].xmax = d.width + d.shadow_width - 1;
-      d.area.changes[y].trans_count += d.shadow_width;
-      std::fill (d.area_pos, d.area_pos + d.shadow_width, d.color_overlay_char);
-    }
+  // Draw right shadow
+  w->fillRect (area, FRect{int(width), 0, shadow_width, 1}, transparent_char);
 
-    d.area_pos += d.shadow_width;
-  }
-}
+  if ( height > 1 )
+    w->fillRect ( area, FRect{int(width), 1, shadow_width, height - 1}
+                , color_overlay_char );
 
-//----------------------------------------------------------------------
-inline void drawBottomShadow (TransparentShadowData& d)
-{
-  for (std::size_t y{d.height}; y < d.height + d.shadow_height; y++)  // Draw bottom shadow
-  {
-    d.area.changes[y].xmin = 0;
-    d.area.changes[y].xmax = d.width + d.shadow_width - 1;
-    d.area.changes[y].trans_count += d.width + d.shadow_width;
-    std::fill (d.area_pos, d.area_pos + d.shadow_width, d.transparent_char);
-    d.area_pos += d.shadow_width;
-    std::fill (d.area_pos, d.area_pos + d.width, d.color_overlay_char);
-    d.area_pos += d.width;
-  }
+  // Draw bottom shadow
+  w->fillRect ( area, FRect{0, int(height), shadow_width, shadow_height}
+              , transparent_char );
+  w->fillRect ( area, FRect{int(shadow_width), int(height), width, shadow_height}
+              , color_overlay_char );
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    w->setReverse(false);
 }
 
 //----------------------------------------------------------------------
@@ -562,42 +480,23 @@ void drawGenericBlockShadow ( FWidget* w
     || ! FVTerm::getFOutput()->hasShadowCharacter() )
     return;
 
-  auto& area = *w->getPrintArea();
+  auto area = w->getPrintArea();
   const bool is_window = w->isWindowWidget();
-  const auto width = is_window ? uInt(area.size.width) : uInt(w->getWidth());
-  const auto height = is_window ? uInt(area.size.height) : uInt(w->getHeight());
-  const auto shadow_width = uInt(area.shadow.width);
-  const auto shadow_height = uInt(area.shadow.height);
-  const auto x_offset = uInt(w->woffset.getX1() + w->getX() - area.position.x - 1);
-  const auto y_offset = uInt(w->woffset.getY1() + w->getY() - area.position.y - 1);
-
-  if ( is_window && (shadow_width < 1 || shadow_height < 1) )
+  const auto width = is_window ? std::size_t(area->size.width) : w->getWidth();
+  const auto height = is_window ? std::size_t(area->size.height) : w->getHeight();
+  const int x = w->woffset.getX1() + w->getX() - area->position.x - 1;
+  const int y = w->woffset.getY1() + w->getY() - area->position.y - 1;
+
+  if ( is_window && (area->shadow.width < 1 || area->shadow.height < 1) )
     return;
 
-  auto y = y_offset;
-  auto& area_changes = area.changes;
-  auto* area_pos = &area.getFChar(int(x_offset + width), int(y_offset));
-  *area_pos = shadow_char[0];  // ▄
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
-  area_changes[y].trans_count++;
+  w->fillRect (area, FRect{x + int(width), y, 1, 1}, shadow_char[0]);  // ▄
 
-  for (y = y_offset + 1; y < y_offset + height; y++)
-  {
-    area_pos = &area.getFChar(int(x_offset + width), int(y));
-    *area_pos = shadow_char[1];  // █
-    area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + width);
-    area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
-    area_changes[y].trans_count++;
-  }
+  if ( height > 1 )
+    w->fillRect (area, FRect{x + int(width), y + 1, 1, height - 1}, shadow_char[1]);  // █
 
-  area_pos = &area.getFChar(int(x_offset), int(y_offset + height));
-  *area_pos = shadow_char[2];  // ' '
-  ++area_pos;
-  std::fill (area_pos, area_pos + width, shadow_char[3]);  // ▀
-  area_changes[y].xmin = std::min(area_changes[y].xmin, uInt(x_offset));
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
-  area_changes[y].trans_count += width + 1;
+  w->fillRect (area, FRect{x, y + int(height), 1, 1}, shadow_char[2]);  // ' '
+  w->fillRect (area, FRect{x + 1, y + int(height), width, 1}, shadow_char[3]);  // ▀
 }
 
 //----------------------------------------------------------------------
@@ -848,79 +747,15 @@ void drawGenericBox ( FWidget* w, const FRect& r
   if ( ! w || ! w->getPrintArea() || r.getWidth() < 3 )
     return;
 
-  // Get references to frequently accessed variables
-  auto& area = *w->getPrintArea();
-  auto& area_changes = area.changes;
+  auto area = w->getPrintArea();
   auto fchar = FVTermAttribute::getAttribute();
-
-  // Prepare the first character to draw the box
   fchar.attr.bit.char_width = 1;
-  fchar.ch[0] = box_char[0];
-  fchar.ch[1] = L'\0';
-  const auto is_transparent = (fchar.attr.byte[1] & internal::var::b1_print_trans_mask) != 0;
 
   // Adjust box position to match print area
   auto box = r;
-  box.move (-1, -1);
-  const auto x_offset = uInt(w->woffset.getX1() + w->getX() - area.position.x - 1);
-  const auto y_offset = uInt(w->woffset.getY1() + w->getY() - area.position.y - 1);
-
-  // Draw the top line of the box
-  auto* area_pos = &area.getFChar(int(x_offset) + box.getX1(), int(y_offset) + box.getY1());
-  *area_pos = fchar;
-  ++area_pos;
-  fchar.ch[0] = box_char[1];
-  const auto line_length = box.getWidth() - 2;
-  std::fill (area_pos, area_pos + line_length, fchar);
-  area_pos += line_length;
-  fchar.ch[0] = box_char[2];
-  *area_pos = fchar;
-
-  // Update area_changes for the top line
-  auto y = y_offset + uInt(box.getY1());
-  auto max_width = uInt(area.size.width + area.shadow.width) - 1;
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-  area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-  area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
-  area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
-
-  // Draw the sides of the box
-  for (y = y_offset + uInt(box.getY1()) + 1; y < y_offset + uInt(box.getY2()); y++)
-  {
-    area_pos = &area.getFChar(int(x_offset) + box.getX1(), int(y));
-    fchar.ch[0] = box_char[3];
-    *area_pos = fchar;
-    area_pos += box.getWidth() - 1;
-    fchar.ch[0] = box_char[4];
-    *area_pos = fchar;
-    // Update area_changes for the sides
-    area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-    area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-    area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-    area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
-    area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
-  }
-
-  // Draw the bottom line of the box
-  area_pos = &area.getFChar(int(x_offset) + box.getX1(), int(y));
-  fchar.ch[0] = box_char[5];
-  *area_pos = fchar;
-  ++area_pos;
-  fchar.ch[0] = box_char[6];
-  std::fill (area_pos, area_pos + line_length, fchar);
-  area_pos += line_length;
-  fchar.ch[0] = box_char[7];
-  *area_pos = fchar;
-
-  // Update area_changes for the bottom line
-  y = y_offset + uInt(box.getY2());
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-  area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-  area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
-  area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
-  area.has_changes = true;
+  box.move ( w->woffset.getX1() + w->getX() - area->position.x - 2
+           , w->woffset.getY1() + w->getY() - area->position.y - 2 );
+  w->drawFrame (area, box, fchar, box_char);
 }
 
 //----------------------------------------------------------------------
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2021-2024 Markus Gans                                      *
+* Copyright 2021-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -48,7 +48,6 @@ using FWidgetList = std::vector<FWidget*>;
 
 // non-member function forward declarations
 void detectTerminalSize();
-void initByte1PrintTransMask();
 auto isFocusNextKey (const FKey) -> bool;
 auto isFocusPrevKey (const FKey) -> bool;
 auto isDialogMenuKey (const FKey) -> bool;
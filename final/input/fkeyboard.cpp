@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2018-2023 Markus Gans                                      *
+* Copyright 2018-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -37,6 +37,7 @@
 #include "final/input/fkey_map.h"
 #include "final/output/tty/fterm.h"
 #include "final/output/tty/ftermios.h"
+#include "final/util/futf8.h"
 
 #if defined(__linux__)
   #include "final/output/tty/ftermlinux.h"
@@ -371,6 +372,12 @@ inline auto FKeyboard::getSingleKey() -> FKey
       return FKey::Incomplete;
 
     keycode = UTF8decode(len);
+
+    if ( keycode == NOT_SET )  // Ill-formed or incomplete UTF-8 sequence
+    {
+      fifo_buf.pop(len);
+      return FKey::None;  // Is not queued as a key
+    }
   }
   else
     keycode = FKey(uChar(firstchar));
@@ -392,49 +399,21 @@ inline auto FKeyboard::isKeypressTimeout() -> bool
 //----------------------------------------------------------------------
 auto FKeyboard::UTF8decode (const std::size_t len) const noexcept -> FKey
 {
-  using distance_type = CharRingBuffer<FIFO_BUF_SIZE>::difference_type;
-  constexpr std::size_t max = 4U;
-  FKey ucs{FKey::None};  // Universal coded character
-  const auto begin = std::begin(fifo_buf);
-  const auto end = begin + static_cast<distance_type>(std::min(len, max));
+  // Decodes the UTF-8 sequence of len bytes at the beginning
+  // of the fifo buffer. Ill-formed sequences return NOT_SET.
 
-  for (auto iter{begin}; iter != end; ++iter)
-  {
-    const auto ch = uChar(*iter);
+  std::array<char, UTF8_MAX_LENGTH> utf8{};
+  uInt32 ucs{};
 
-    if ( (ch & uChar(0xc0)) == 0x80 )
-    {
-      // byte 2..4 = 10xxxxxx
-      ucs = (ucs << 6) | FKey(ch & uChar(0x3f));
-    }
-    else if ( ch < 128 )
-    {
-      // byte 1 = 0xxxxxxx (1 byte mapping)
-      ucs = FKey(uChar(ch));
-    }
-    else if ( len == 2U )
-    {
-      // byte 1 = 110xxxxx (2 byte mapping)
-      ucs = FKey(ch & uChar(0x1f));
-    }
-    else if ( len == 3U )
-    {
-      // byte 1 = 1110xxxx (3 byte mapping)
-      ucs = FKey(ch & uChar(0x0f));
-    }
-    else if ( len == 4U )
-    {
-      // byte 1 = 11110xxx (4 byte mapping)
-      ucs = FKey(ch & uChar(0x07));
-    }
-    else
-    {
-      // error
-      ucs = NOT_SET;
-    }
-  }
+  if ( len > UTF8_MAX_LENGTH || len > fifo_buf.getSize() )
+    return NOT_SET;  // 5 or 6 bytes or an incomplete sequence
+
+  std::copy_n (std::begin(fifo_buf), len, utf8.begin());
+
+  if ( decodeUTF8Char(utf8.data(), len, ucs) != len )
+    return NOT_SET;
 
-  return ucs;
+  return FKey(ucs);
 }
 
 //----------------------------------------------------------------------
@@ -472,7 +451,7 @@ void FKeyboard::parseKeyBuffer()
         break;
       }
 
-      if ( fkey != FKey::Incomplete )
+      if ( fkey != FKey::Incomplete && fkey != FKey::None )
         fkey_queue.emplace(fkey);
     }
 
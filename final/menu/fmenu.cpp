@@ -31,6 +31,7 @@
 #include "final/menu/fmenubar.h"
 #include "final/menu/fmenu.h"
 #include "final/menu/fmenuitem.h"
+#include "final/menu/fradiomenuitem.h"
 #include "final/util/flog.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/widget/fstatusbar.h"
@@ -313,19 +314,19 @@ auto FMenu::isDialog (const FWidget* w) const -> bool
 //----------------------------------------------------------------------
 auto FMenu::isMenuBar (const FWidget* w) const -> bool
 {
-  return w->isInstanceOf("FMenuBar");
+  return w->isInstanceOf<FMenuBar>();
 }
 
 //----------------------------------------------------------------------
 auto FMenu::isMenu (const FWidget* w) const -> bool
 {
-  return w->isInstanceOf("FMenu");
+  return w->isInstanceOf<FMenu>();
 }
 
 //----------------------------------------------------------------------
 auto FMenu::isRadioMenuItem (const FWidget* w) const -> bool
 {
-  return w->isInstanceOf("FRadioMenuItem");
+  return w->isInstanceOf<FRadioMenuItem>();
 }
 
 //----------------------------------------------------------------------
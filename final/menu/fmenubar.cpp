@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2015-2024 Markus Gans                                      *
+* Copyright 2015-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -78,7 +78,7 @@ void FMenuBar::hide()
   const auto& fg = wc->term.fg;
   const auto& bg = wc->term.bg;
   setColor (fg, bg);
-  print() << FPoint{1, 1} << FString{getDesktopWidth(), L' '};
+  fillRect (FRect{FPoint{1, 1}, FSize{getDesktopWidth(), 1}});
   FWindow::hide();
 }
 
@@ -431,18 +431,13 @@ auto FMenuItem::isDialog (const FWidget* w) const -> bool
 //----------------------------------------------------------------------
 auto FMenuItem::isMenuBar (const FWidget* w) const -> bool
 {
-  return w ? w->isInstanceOf("FMenuBar") : false;
+  return w ? w->isInstanceOf<FMenuBar>() : false;
 }
 
 //----------------------------------------------------------------------
 auto FMenuItem::isMenu (const FWidget* w) const -> bool
 {
-  if ( ! w )
-    return false;
-
-  const bool m1 = w->isInstanceOf("FMenu");
-  const bool m2 = w->isInstanceOf("FDialogListMenu");
-  return m1 || m2;
+  return w ? w->isInstanceOf<FMenu>() : false;  // incl. FDialogListMenu
 }
 
 //----------------------------------------------------------------------
@@ -106,6 +106,7 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual auto hasHalfBlockCharacter() const -> bool = 0;
     virtual auto hasShadowCharacter() const -> bool = 0;
     virtual auto areMetaAndArrowKeysSupported() const -> bool = 0;
+    virtual auto hasRectangleOperations() const -> bool = 0;
 
     // Methods
     virtual void initTerminal (FVTerm::FTermArea*) = 0;
@@ -116,6 +117,8 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual void initScreenSettings() = 0;
     virtual auto scrollTerminalForward() -> bool = 0;
     virtual auto scrollTerminalReverse() -> bool = 0;
+    virtual auto copyTerminalArea (const FRect&, const FPoint&) -> bool = 0;
+    virtual auto fillTerminalArea (const FRect&, const FChar&) -> bool = 0;
     virtual void clearTerminalAttributes() = 0;
     virtual void clearTerminalState() = 0;
     virtual auto clearTerminal (wchar_t = L' ') -> bool = 0;
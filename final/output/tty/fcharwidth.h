@@ -0,0 +1,111 @@
+/***********************************************************************
+* fcharwidth.h - Precomputed Unicode character width table             *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#ifndef FCHARWIDTH_H
+#define FCHARWIDTH_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include "final/fc.h"
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FCharWidth
+//----------------------------------------------------------------------
+
+// Character properties of the whole Unicode range in a two-level table.
+// block_index maps each block of 128 code points to a block of property
+// bytes in block_data. Blocks with the same properties are stored once.
+// The tables in fcharwidth.cpp are generated with ucd2code.pl and do
+// not depend on the libc locale. getWidth() returns the given width
+// for East Asian ambiguous characters (default: 1 column).
+
+class FCharWidth final
+{
+  public:
+    // Accessors
+    static auto getWidth (wchar_t, std::size_t = 1) noexcept -> std::size_t;
+    static auto getGraphemeBreak (wchar_t) noexcept -> GraphemeBreak;
+
+    // Inquiry
+    static auto isAmbiguousWidth (wchar_t) noexcept -> bool;
+
+  private:
+    // Constants
+    static constexpr uInt32 BLOCK_BITS = 7;
+    static constexpr uInt32 LAST_CODE_POINT = 0x10ffff;
+    static constexpr uInt8 WIDTH_MASK = 0x03;
+    static constexpr uInt8 AMBIGUOUS_FLAG = 0x04;
+    static constexpr uInt8 BREAK_SHIFT = 3;
+    static constexpr uInt8 INVALID_CHAR
+        = uInt8(GraphemeBreak::Control) << BREAK_SHIFT;  // Width 0
+
+    // Accessor
+    static auto getProperty (wchar_t) noexcept -> uInt8;
+
+    // Data members
+    static const uInt8 block_index[];
+    static const uInt8 block_data[];
+};
+
+// FCharWidth inline functions
+//----------------------------------------------------------------------
+inline auto FCharWidth::getWidth ( wchar_t wchar
+                                 , std::size_t ambiguous_width ) noexcept -> std::size_t
+{
+  const auto property = getProperty(wchar);
+
+  if ( property & AMBIGUOUS_FLAG )
+    return ambiguous_width;
+
+  return property & WIDTH_MASK;
+}
+
+//----------------------------------------------------------------------
+inline auto FCharWidth::getGraphemeBreak (wchar_t wchar) noexcept -> GraphemeBreak
+{ return static_cast<GraphemeBreak>(getProperty(wchar) >> BREAK_SHIFT); }
+
+//----------------------------------------------------------------------
+inline auto FCharWidth::isAmbiguousWidth (wchar_t wchar) noexcept -> bool
+{ return getProperty(wchar) & AMBIGUOUS_FLAG; }
+
+//----------------------------------------------------------------------
+inline auto FCharWidth::getProperty (wchar_t wchar) noexcept -> uInt8
+{
+  const auto code = uInt32(wchar);
+
+  if ( code > LAST_CODE_POINT )
+    return INVALID_CHAR;
+
+  const auto block = uInt32(block_index[code >> BLOCK_BITS]);
+  const auto offset = code & ((1U << BLOCK_BITS) - 1);
+  return block_data[(block << BLOCK_BITS) | offset];
+}
+
+}  // namespace finalcut
+
+#endif  // FCHARWIDTH_H
@@ -1405,6 +1405,8 @@ void FTerm::init_encoding()
   {
     setEncoding(getStartOptions().encoding);
   }
+
+  init_ambiguous_width();
 }
 
 //----------------------------------------------------------------------
@@ -1510,6 +1512,24 @@ void FTerm::init_tab_quirks()
   }
 }
 
+//----------------------------------------------------------------------
+void FTerm::init_ambiguous_width()
+{
+  // Terminals in a Chinese, Japanese or Korean UTF-8 locale display
+  // the East Asian ambiguous characters in two columns
+
+  auto& data = FTermData::getInstance();
+  const char* locale_name = std::setlocale (LC_CTYPE, nullptr);
+  const auto language = std::string(locale_name ? locale_name : "").substr(0, 2);
+  const bool cjk_locale = language == "ja"
+                       || language == "ko"
+                       || language == "zh";
+  data.supportWideAmbiguousCharacter
+  (
+    cjk_locale && data.getTerminalEncoding() == Encoding::UTF8
+  );
+}
+
 //----------------------------------------------------------------------
 void FTerm::init_captureFontAndTitle()
 {
@@ -270,6 +270,7 @@ class FTerm final
     static void init_force_vt100_encoding();
     static void init_utf8_without_alt_charset();
     static void init_tab_quirks();
+    static void init_ambiguous_width();
     static void init_captureFontAndTitle();
     static auto hasNoFontSettingOption() -> bool;
     static auto canSetTerminalFont() -> bool;
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2021-2023 Markus Gans                                      *
+* Copyright 2021-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -57,16 +57,13 @@ auto hasFullWidthSupports() -> bool;
 auto cp437_to_unicode (uChar) -> wchar_t;
 auto unicode_to_cp437 (wchar_t) -> uChar;
 
-#if defined(__CYGWIN__)
-  auto unicode_to_utf8 (wchar_t ucs) -> std::string;
-#else
-  auto unicode_to_utf8 (wchar_t ucs) -> std::string;
-#endif
+auto unicode_to_utf8 (wchar_t) -> std::string;
 
 auto getFullWidth (const FString&) -> FString;
 auto getHalfWidth (const FString&) -> FString;
 auto getColumnSubString (const FString&, std::size_t, std::size_t) -> FString;
 auto getLengthFromColumnWidth (const FString&, std::size_t) -> std::size_t;
+auto isPrintableAscii (const FString&) noexcept -> bool;
 auto getColumnWidth (const FString&, std::size_t) -> std::size_t;
 auto getColumnWidth (const FString&) -> std::size_t;
 auto getColumnWidth (const wchar_t) -> std::size_t;
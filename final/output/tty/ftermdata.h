@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2018-2023 Markus Gans                                      *
+* Copyright 2018-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -166,6 +166,7 @@ class FTermData final
     // Inquiries
     auto hasShadowCharacter() const noexcept -> bool;
     auto hasHalfBlockCharacter() const noexcept -> bool;
+    auto hasWideAmbiguousCharacter() const noexcept -> bool;
     auto hasCursorOptimisation() const noexcept -> bool;
     auto isCursorHidden() const noexcept -> bool;
     auto hasAlternateScreen() const noexcept -> bool;
@@ -187,6 +188,7 @@ class FTermData final
     void setBaudrate (uInt) noexcept;
     void supportShadowCharacter (bool = true) noexcept;
     void supportHalfBlockCharacter (bool = true) noexcept;
+    void supportWideAmbiguousCharacter (bool = true) noexcept;
     void supportCursorOptimisation (bool = true) noexcept;
     void setCursorHidden (bool = true) noexcept;
     void useAlternateScreen (bool = true) noexcept;
@@ -258,6 +260,7 @@ class FTermData final
     {
       bool  shadow_character{true};
       bool  half_block_character{true};
+      bool  wide_ambiguous_character{false};  // East Asian ambiguous width
       bool  cursor_optimisation{true};
       bool  hidden_cursor{false};  // Global cursor hidden state
       bool  use_alternate_screen{true};
@@ -357,6 +360,10 @@ inline auto FTermData::hasShadowCharacter() const noexcept -> bool
 inline auto FTermData::hasHalfBlockCharacter() const noexcept -> bool
 { return flags.half_block_character; }
 
+//----------------------------------------------------------------------
+inline auto FTermData::hasWideAmbiguousCharacter() const noexcept -> bool
+{ return flags.wide_ambiguous_character; }
+
 //----------------------------------------------------------------------
 inline auto FTermData::hasCursorOptimisation() const noexcept -> bool
 { return flags.cursor_optimisation; }
@@ -436,6 +443,10 @@ inline void FTermData::supportShadowCharacter (bool available) noexcept
 inline void FTermData::supportHalfBlockCharacter (bool available) noexcept
 { flags.half_block_character = available; }
 
+//----------------------------------------------------------------------
+inline void FTermData::supportWideAmbiguousCharacter (bool wide) noexcept
+{ flags.wide_ambiguous_character = wide; }
+
 //----------------------------------------------------------------------
 inline void FTermData::supportCursorOptimisation (bool available) noexcept
 { flags.cursor_optimisation = available; }
@@ -96,6 +96,9 @@ void FTermDetection::setTtyTypeFileName (const FString& ttytype_filename)
 //----------------------------------------------------------------------
 void FTermDetection::detect()
 {
+  // Reset the capabilities of a previous detection
+  rectangle_support = false;
+
   // Set the variable 'termtype' to the predefined type of the terminal
   getSystemTermType();
 
@@ -727,11 +730,11 @@ auto FTermDetection::secDA_Analysis (const FString& current_termtype) -> FString
     // Tera Term
     { 32, [this] (const auto&) { return secDA_Analysis_32(); } },
     // DEC VT420
-    { 41, [] (const auto& s) { return s; } },
+    { 41, [this] (const auto& s) { return secDA_Analysis_41(s); } },
     // DEC VT510
-    { 61, [] (const auto& s) { return s; } },
+    { 61, [this] (const auto& s) { return secDA_Analysis_41(s); } },
     // DEC VT520
-    { 64, [] (const auto& s) { return s; } },
+    { 64, [this] (const auto& s) { return secDA_Analysis_41(s); } },
     // DEC VT525
     { 65, [this] (const auto& s) { return secDA_Analysis_65(s); } },
     // Cygwin
@@ -835,6 +838,17 @@ inline auto FTermDetection::secDA_Analysis_32() const -> FString
   return "teraterm";
 }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::secDA_Analysis_41 (const FString& current_termtype) -> FString
+{
+  // Terminal ID 41 - DEC VT420 (also VT510 and VT520)
+
+  // Rectangular area operations (DECCRA, DECFRA) are available
+  // from the VT400 level
+  rectangle_support = true;
+  return current_termtype;
+}
+
 //----------------------------------------------------------------------
 inline auto FTermDetection::secDA_Analysis_65 (const FString& current_termtype) -> FString
 {
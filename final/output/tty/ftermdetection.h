@@ -73,6 +73,7 @@ class FTermDetection final
     auto  canDisplay256Colors() const noexcept -> bool;
     auto  hasTerminalDetection() const noexcept -> bool;
     auto  hasSetCursorStyleSupport() const noexcept -> bool;
+    auto  hasRectangleOperationSupport() const noexcept -> bool;
 
     // Mutators
     void  setTerminalDetection (bool = true) noexcept;
@@ -133,6 +134,7 @@ class FTermDetection final
     auto  secDA_Analysis_1 (const FString&) -> FString;
     auto  secDA_Analysis_24 (const FString&) -> FString;
     auto  secDA_Analysis_32 () const -> FString;
+    auto  secDA_Analysis_41 (const FString&) -> FString;
     auto  secDA_Analysis_65 (const FString&) -> FString;
     auto  secDA_Analysis_67 () const -> FString;
     auto  secDA_Analysis_77 () -> FString;
@@ -153,6 +155,7 @@ class FTermDetection final
     FString      termtype{};
     FString      ttytypename{"/etc/ttytype"};  // Default ttytype file
     bool         decscusr_support{false};      // Preset to false
+    bool         rectangle_support{false};     // Preset to false
     bool         terminal_detection{true};     // Preset to true
     bool         color256{};
     FString      answer_back{};
@@ -193,6 +196,10 @@ inline auto FTermDetection::canDisplay256Colors() const noexcept -> bool
 inline auto FTermDetection::hasSetCursorStyleSupport() const noexcept -> bool
 { return decscusr_support; }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::hasRectangleOperationSupport() const noexcept -> bool
+{ return rectangle_support; }
+
 //----------------------------------------------------------------------
 inline auto FTermDetection::hasTerminalDetection() const noexcept -> bool
 { return terminal_detection; }
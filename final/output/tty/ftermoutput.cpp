@@ -32,6 +32,7 @@
 #include "final/output/tty/foptimove.h"
 #include "final/output/tty/ftermcap.h"
 #include "final/output/tty/ftermdata.h"
+#include "final/output/tty/ftermdetection.h"
 #include "final/output/tty/ftermfreebsd.h"
 #include "final/output/tty/ftermios.h"
 #include "final/output/tty/ftermoutput.h"
@@ -176,6 +177,15 @@ auto FTermOutput::areMetaAndArrowKeysSupported() const -> bool
   return ! fterm_data->isTermType(FTermType::linux_con);
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::hasRectangleOperations() const -> bool
+{
+  // VT420 rectangular area operations (DECCRA, DECFRA)
+
+  static const auto& term_detection = FTermDetection::getInstance();
+  return term_detection.hasRectangleOperationSupport();
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::setCursor (FPoint p)
 {
@@ -368,6 +378,53 @@ auto FTermOutput::scrollTerminalReverse() -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::copyTerminalArea (const FRect& box, const FPoint& pos) -> bool
+{
+  // Copies the rectangular terminal area box to the position pos
+  // with DECCRA (Copy Rectangular Area). The cursor does not move.
+
+  if ( ! hasRectangleOperations()
+    || box.getWidth() == 0 || box.getHeight() == 0 )
+    return false;
+
+  // Terminal coordinates and page numbers start with 1
+  std::string deccra{CSI};
+  deccra += std::to_string(box.getY1() + 1) + ';'
+          + std::to_string(box.getX1() + 1) + ';'
+          + std::to_string(box.getY2() + 1) + ';'
+          + std::to_string(box.getX2() + 1) + ";1;"
+          + std::to_string(pos.getY() + 1) + ';'
+          + std::to_string(pos.getX() + 1) + ";1$v";
+  appendOutputBuffer (FTermControl{deccra});
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::fillTerminalArea (const FRect& box, const FChar& fchar) -> bool
+{
+  // Fills the rectangular terminal area box with the character fchar
+  // by DECFRA (Fill Rectangular Area) using the current attributes
+
+  const auto ch = fchar.ch[0];
+
+  if ( ! hasRectangleOperations()
+    || box.getWidth() == 0 || box.getHeight() == 0
+    || ch < L' ' || ch > L'~' || fchar.ch[1] != L'\0' )
+    return false;
+
+  auto next_attribute = fchar;
+  appendAttributes (next_attribute);
+  std::string decfra{CSI};
+  decfra += std::to_string(int(ch)) + ';'
+          + std::to_string(box.getY1() + 1) + ';'
+          + std::to_string(box.getX1() + 1) + ';'
+          + std::to_string(box.getY2() + 1) + ';'
+          + std::to_string(box.getX2() + 1) + "$x";
+  appendOutputBuffer (FTermControl{decfra});
+  return true;
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::clearTerminalAttributes()
 {
@@ -800,6 +857,50 @@ void FTermOutput::printRange (uInt xmin, uInt xmax, uInt y)
   }
 }
 
+//----------------------------------------------------------------------
+void FTermOutput::printChangedSpans ( const FVTerm::FLineChanges& line_changes
+                                    , uInt xmin, uInt xmax, uInt y )
+{
+  // Prints only the changed spans of line y within [xmin, xmax]
+
+  bool has_range{false};
+  uInt range_xmin{0};
+  uInt range_xmax{0};
+
+  for (std::size_t i{0}; i < line_changes.getSpanCount(); i++)
+  {
+    const auto& span = line_changes.getSpan(i);
+    const auto span_xmin = std::max(span.xmin, xmin);
+    const auto span_xmax = std::min(span.xmax, xmax);
+
+    if ( span_xmin > span_xmax )
+      continue;
+
+    // Reprinting a small gap is cheaper than a cursor movement
+    if ( has_range && span_xmin - range_xmax - 1 <= cursor_address_length )
+    {
+      range_xmax = span_xmax;
+      continue;
+    }
+
+    if ( has_range )
+    {
+      setCursor (FPoint{int(range_xmin), int(y)});
+      printRange (range_xmin, range_xmax, y);
+    }
+
+    has_range = true;
+    range_xmin = span_xmin;
+    range_xmax = span_xmax;
+  }
+
+  if ( has_range )
+  {
+    setCursor (FPoint{int(range_xmin), int(y)});
+    printRange (range_xmin, range_xmax, y);
+  }
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutput::replaceNonPrintableFullwidth ( uInt x
                                                       , FChar& print_char ) const
@@ -1167,10 +1268,10 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
   // Updates pending changes from line y to the terminal
 
   auto& vterm_changes = vterm->changes[y];
-  uInt& xmin = vterm_changes.xmin;
-  uInt& xmax = vterm_changes.xmax;
+  auto xmin = vterm_changes.getXMin();
+  auto xmax = vterm_changes.getXMax();
 
-  if ( xmin > xmax )  // This line has no changes
+  if ( ! vterm_changes.hasChanges() )  // This line has no changes
   {
     cursorWrap();
     return false;
@@ -1199,7 +1300,7 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
       markAsPrinted (0, xmin, y);
     }
 
-    printRange (xmin, xmax, y);
+    printChangedSpans (vterm_changes, xmin, xmax, y);
 
     if ( draw_trailing_ws )
     {
@@ -1211,8 +1312,7 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
   }
 
   // Reset line changes and wrap the cursor
-  xmin = uInt(vterm->size.width);
-  xmax = 0;
+  vterm_changes.reset(uInt(vterm->size.width));
   cursorWrap();
   return true;
 }
@@ -104,6 +104,7 @@ class FTermOutput final : public FOutput
     auto hasHalfBlockCharacter() const -> bool override;
     auto hasShadowCharacter() const -> bool override;
     auto areMetaAndArrowKeysSupported() const -> bool override;
+    auto hasRectangleOperations() const -> bool override;
 
     // Methods
     void initTerminal (FVTerm::FTermArea*) override;
@@ -114,6 +115,8 @@ class FTermOutput final : public FOutput
     void initScreenSettings() override;
     auto scrollTerminalForward() -> bool override;
     auto scrollTerminalReverse() -> bool override;
+    auto copyTerminalArea (const FRect&, const FPoint&) -> bool override;
+    auto fillTerminalArea (const FRect&, const FChar&) -> bool override;
     void clearTerminalAttributes() override;
     void clearTerminalState() override;
     auto clearTerminal (wchar_t = L' ') -> bool override;
@@ -190,6 +193,7 @@ class FTermOutput final : public FOutput
     auto canClearTrailingWS (uInt&, uInt) const -> bool;
     auto skipUnchangedCharacters (uInt&, uInt, uInt) -> bool;
     void printRange (uInt, uInt, uInt);
+    void printChangedSpans (const FVTerm::FLineChanges&, uInt, uInt, uInt);
     void replaceNonPrintableFullwidth (uInt, FChar&) const;
     void printCharacter (uInt&, uInt, bool, FChar&);
     void printFullWidthCharacter (uInt&, uInt, FChar&);
@@ -0,0 +1,156 @@
+#!/usr/bin/perl
+#
+# ucd2code.pl - Generates the Unicode character property tables
+#               (fcharwidth.cpp) from the Unicode database of Perl
+#
+# Each code point gets one property byte:
+#   bits 0-1  column width (0, 1 or 2)
+#   bit  2    East Asian ambiguous width with one column
+#   bits 3-6  grapheme cluster break property (GraphemeBreak in fc.h)
+#
+# The property bytes are stored in blocks of 128 code points.
+# Identical blocks are stored only once.
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap);
+
+my $OUTPUT = "fcharwidth.cpp";
+my $BLOCK_BITS = 7;
+my $BLOCK_SIZE = 1 << $BLOCK_BITS;
+my $MAX_CODE_POINT = 0x10ffff;
+
+# Order of the GraphemeBreak enumeration in fc.h
+my %grapheme_break =
+(
+  "Other"              => 0,
+  "CR"                 => 1,
+  "LF"                 => 2,
+  "Control"            => 3,
+  "Extend"             => 4,
+  "ZWJ"                => 5,
+  "Regional_Indicator" => 6,
+  "Prepend"            => 7,
+  "SpacingMark"        => 8,
+  "L"                  => 9,
+  "V"                  => 10,
+  "T"                  => 11,
+  "LV"                 => 12,
+  "LVT"                => 13,
+  "ExtPict"            => 14
+);
+
+# Expands an inversion map into a list with one value per code point
+sub expand
+{
+  my ($ranges, $values) = @_;
+  my @list;
+
+  for my $i (0 .. $#$ranges)
+  {
+    my $end = ( $i < $#$ranges ) ? $ranges->[$i + 1] - 1 : $MAX_CODE_POINT;
+    $list[$_] = $values->[$i] for $ranges->[$i] .. $end;
+  }
+
+  return \@list;
+}
+
+my $category = expand(prop_invmap("General_Category"));
+my $east_asian = expand(prop_invmap("East_Asian_Width"));
+my $gcb = expand(prop_invmap("Grapheme_Cluster_Break"));
+my $pictographic = expand(prop_invmap("Extended_Pictographic"));
+
+sub column_width
+{
+  my ($code) = @_;
+  my $gc = $category->[$code];
+
+  # Control characters, surrogates and line/paragraph separators
+  return 0 if $gc =~ /^(Cc|Cs|Zl|Zp)$/;
+
+  # Combining marks
+  return 0 if $gc =~ /^(Mn|Me)$/;
+
+  # Format characters (except soft hyphen and prepended
+  # format characters like U+0600 ARABIC NUMBER SIGN)
+  return 0 if $gc eq "Cf" && $code != 0x00ad && $gcb->[$code] ne "Prepend";
+
+  # Hangul medial vowels and final consonants
+  return 0 if ( $code >= 0x1160 && $code <= 0x11ff )
+           || ( $code >= 0xd7b0 && $code <= 0xd7ff );
+
+  return 2 if $east_asian->[$code] =~ /^(W|F)$/;
+  return 1;
+}
+
+sub property
+{
+  my ($code) = @_;
+  my $width = column_width($code);
+  my $break = $gcb->[$code];
+  my $ambiguous = ( $width == 1 && $east_asian->[$code] eq "A" ) ? 1 : 0;
+
+  $break = "ExtPict" if $break =~ /^ExtPict/
+                     || ( $break eq "Other" && $pictographic->[$code] eq "Y" );
+  die sprintf("Unknown grapheme break property %s at U+%04X\n", $break, $code)
+    if ! exists $grapheme_break{$break};
+
+  return $width | ($ambiguous << 2) | ($grapheme_break{$break} << 3);
+}
+
+# Build the two-level table
+my @block_index;
+my @block_data;
+my %known_blocks;
+
+for ( my $start = 0; $start <= $MAX_CODE_POINT; $start += $BLOCK_SIZE )
+{
+  my @block = map { property($_) } $start .. $start + $BLOCK_SIZE - 1;
+  my $key = join(",", @block);
+
+  if ( ! exists $known_blocks{$key} )
+  {
+    $known_blocks{$key} = scalar(keys %known_blocks);
+    push @block_data, [ $start, @block ];
+  }
+
+  push @block_index, $known_blocks{$key};
+}
+
+die "Too many blocks for an 8-bit block index\n" if @block_data > 256;
+
+open(my $fh, ">", $OUTPUT) or die "Cannot create $OUTPUT: $!\n";
+
+print $fh "// ${OUTPUT} - Unicode ", Unicode::UCD::UnicodeVersion(), " character properties\n";
+print $fh "// Generated by ucd2code.pl - do not edit\n\n";
+print $fh "#include \"final/output/tty/fcharwidth.h\"\n\n";
+print $fh "namespace finalcut\n{\n\n";
+printf $fh "const uInt8 FCharWidth::block_index[%d] =\n{\n", scalar(@block_index);
+
+for ( my $i = 0; $i < @block_index; $i += 16 )
+{
+  my $last = ( $i + 16 < @block_index ) ? $i + 15 : $#block_index;
+  my $line = join(", ", map { sprintf("0x%02x", $_) } @block_index[$i .. $last]);
+  $line .= "," if $last < $#block_index;
+  printf $fh "  %s  // U+%04X\n", $line, $i << $BLOCK_BITS;
+}
+
+print $fh "};\n\n";
+printf $fh "const uInt8 FCharWidth::block_data[%d] =\n{\n", @block_data * $BLOCK_SIZE;
+
+for my $n (0 .. $#block_data)
+{
+  my ($start, @block) = @{$block_data[$n]};
+  printf $fh "  // Block 0x%02x (U+%04X)\n", $n, $start;
+
+  for ( my $i = 0; $i < $BLOCK_SIZE; $i += 16 )
+  {
+    my $line = join(", ", map { sprintf("0x%02x", $_) } @block[$i .. $i + 15]);
+    $line .= "," if $n < $#block_data || $i + 16 < $BLOCK_SIZE;
+    print $fh "  $line\n";
+  }
+}
+
+print $fh "};\n\n";
+print $fh "}  // namespace finalcut\n";
+close($fh);
@@ -0,0 +1,208 @@
+/***********************************************************************
+* flrucache.h - Cache that discards the least recently used entries    *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FLruCache ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FLRUCACHE_H
+#define FLRUCACHE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FLruCache
+//----------------------------------------------------------------------
+
+// Maps keys to values with a fixed capacity. When the cache is full,
+// the least recently used entry is discarded.
+
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+class FLruCache final
+{
+  public:
+    // Constructor
+    explicit FLruCache (std::size_t = 256);
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getCapacity() const noexcept -> std::size_t;
+    auto getSize() const noexcept -> std::size_t;
+
+    // Mutator
+    void setCapacity (std::size_t);
+
+    // Inquiries
+    auto isEmpty() const noexcept -> bool;
+    auto contains (const KeyT&) const -> bool;
+
+    // Methods
+    auto find (const KeyT&) -> ValueT*;
+    auto insert (const KeyT&, ValueT&&) -> ValueT&;
+    void erase (const KeyT&);
+    void clear();
+
+  private:
+    // Using-declarations
+    using Entry = std::pair<KeyT, ValueT>;
+    using EntryList = std::list<Entry>;
+    using EntryMap = std::unordered_map<KeyT, typename EntryList::iterator, HashT>;
+
+    // Method
+    void discardEntries (std::size_t);
+
+    // Data members
+    EntryList   entries{};  // Most recently used first
+    EntryMap    entry_map{};
+    std::size_t capacity{};
+};
+
+// FLruCache inline functions
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline FLruCache<KeyT, ValueT, HashT>::FLruCache (std::size_t size)
+  : capacity{std::max(size, std::size_t(1))}
+{ }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::getClassName() const -> FString
+{ return "FLruCache"; }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::getCapacity() const noexcept -> std::size_t
+{ return capacity; }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::getSize() const noexcept -> std::size_t
+{ return entry_map.size(); }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline void FLruCache<KeyT, ValueT, HashT>::setCapacity (std::size_t size)
+{
+  capacity = std::max(size, std::size_t(1));
+  discardEntries (capacity);
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::isEmpty() const noexcept -> bool
+{ return entry_map.empty(); }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::contains (const KeyT& key) const -> bool
+{ return entry_map.find(key) != entry_map.end(); }
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::find (const KeyT& key) -> ValueT*
+{
+  // Returns the value or nullptr and marks the entry as recently used
+
+  const auto iter = entry_map.find(key);
+
+  if ( iter == entry_map.end() )
+    return nullptr;
+
+  entries.splice (entries.begin(), entries, iter->second);
+  return &iter->second->second;
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline auto FLruCache<KeyT, ValueT, HashT>::insert (const KeyT& key, ValueT&& value) -> ValueT&
+{
+  // Inserts or replaces the value of the key
+
+  const auto iter = entry_map.find(key);
+
+  if ( iter != entry_map.end() )
+  {
+    iter->second->second = std::move(value);
+    entries.splice (entries.begin(), entries, iter->second);
+    return iter->second->second;
+  }
+
+  discardEntries (capacity - 1);
+  entries.emplace_front (key, std::move(value));
+  entry_map.emplace (key, entries.begin());
+  return entries.front().second;
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline void FLruCache<KeyT, ValueT, HashT>::erase (const KeyT& key)
+{
+  const auto iter = entry_map.find(key);
+
+  if ( iter == entry_map.end() )
+    return;
+
+  entries.erase (iter->second);
+  entry_map.erase (iter);
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline void FLruCache<KeyT, ValueT, HashT>::clear()
+{
+  entries.clear();
+  entry_map.clear();
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename ValueT, typename HashT>
+inline void FLruCache<KeyT, ValueT, HashT>::discardEntries (std::size_t size)
+{
+  // Removes the least recently used entries down to the given size
+
+  while ( entry_map.size() > size )
+  {
+    entry_map.erase (entries.back().first);
+    entries.pop_back();
+  }
+}
+
+}  // namespace finalcut
+
+#endif  // FLRUCACHE_H
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2012-2024 Markus Gans                                      *
+* Copyright 2012-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -28,6 +28,7 @@
 #include "final/fapplication.h"
 #include "final/util/flog.h"
 #include "final/util/fstring.h"
+#include "final/util/futf8.h"
 
 namespace finalcut
 {
@@ -103,7 +104,7 @@ FString::FString (const std::string& s)
 FString::FString (const char s[])
 {
   if ( s )
-    internal_assign(internal_toWideString(s));
+    internal_assign(decodeUTF8(s, std::strlen(s)));
 }
 
 //----------------------------------------------------------------------
@@ -917,52 +918,13 @@ auto FString::includes (const FString& s) const -> bool
 //----------------------------------------------------------------------
 auto FString::internal_toCharString (const std::wstring& s) const -> std::string
 {
-  if ( s.empty() )
-    return {};
-
-  auto src = s.c_str();
-  auto state = std::mbstate_t();
-  const auto size = std::wcsrtombs(nullptr, &src, 0, &state);
-
-  if ( size == MALFORMED_STRING )
-    return {};
-
-  std::vector<char> dest(size + 1);  // Contains terminator "\0"
-  const auto mblength = std::wcsrtombs (dest.data(), &src, dest.size(), &state);
-
-  if ( mblength == MALFORMED_STRING && errno != EILSEQ )
-    return {};
-
-  return dest.data();
+  return encodeUTF8(s);
 }
 
 //----------------------------------------------------------------------
 auto FString::internal_toWideString (const std::string& s) const -> std::wstring
 {
-  if ( s.empty() )
-    return {};
-
-  auto src = s.c_str();
-  auto state = std::mbstate_t();
-  auto size = std::mbsrtowcs(nullptr, &src, 0, &state);
-
-  if ( size == MALFORMED_STRING )
-    return {};
-
-  size++;
-  std::vector<wchar_t> dest(size);
-  const auto wide_length = std::mbsrtowcs (dest.data(), &src, size, &state);
-
-  if ( wide_length == MALFORMED_STRING )
-    return {};
-
-  if ( wide_length == size )
-    dest[size - 1] = '\0';
-
-  if ( wide_length != 0 )
-    return {dest.data(), wide_length};
-
-  return {};
+  return decodeUTF8(s);
 }
 
 
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2012-2024 Markus Gans                                      *
+* Copyright 2012-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -506,7 +506,6 @@ class FString
   private:
     // Constants
     static constexpr auto INPBUFFER = uInt(200);
-    static constexpr auto MALFORMED_STRING = static_cast<std::size_t>(-1);
 
     // Methods
     void internal_assign (std::wstring);
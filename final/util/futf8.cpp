@@ -0,0 +1,260 @@
+/***********************************************************************
+* futf8.cpp - Locale-independent UTF-8 transcoding                     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+
+#include "final/util/futf8.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+// Constants
+constexpr uInt64 ascii_mask = 0x8080808080808080;  // High bit of 8 bytes
+constexpr uInt32 ill_formed = 0xffffffff;
+constexpr bool utf16_wchar = sizeof(wchar_t) == 2;
+
+//----------------------------------------------------------------------
+static inline auto readUTF8Sequence ( const uChar* str, std::size_t length
+                                    , uInt32& code ) noexcept -> std::size_t
+{
+  // Returns the length of the sequence at the beginning of str.
+  // For an ill-formed sequence, code is set to ill_formed and the
+  // length of its maximal subpart (at least 1) is returned.
+
+  const auto lead = str[0];
+  std::size_t count{0};
+  uChar lower{0x80};  // Valid range of the second byte
+  uChar upper{0xbf};
+
+  if ( lead < 0x80 )
+  {
+    code = lead;
+    return 1;
+  }
+
+  if ( lead >= 0xc2 && lead <= 0xdf )
+  {
+    count = 2;
+    code = lead & 0x1f;
+  }
+  else if ( lead >= 0xe0 && lead <= 0xef )
+  {
+    count = 3;
+    code = lead & 0x0f;
+    lower = ( lead == 0xe0 ) ? 0xa0 : lower;  // No overlong form
+    upper = ( lead == 0xed ) ? 0x9f : upper;  // No surrogate
+  }
+  else if ( lead >= 0xf0 && lead <= 0xf4 )
+  {
+    count = 4;
+    code = lead & 0x07;
+    lower = ( lead == 0xf0 ) ? 0x90 : lower;  // No overlong form
+    upper = ( lead == 0xf4 ) ? 0x8f : upper;  // Not above U+10FFFF
+  }
+  else
+  {
+    code = ill_formed;
+    return 1;
+  }
+
+  std::size_t n{1};
+
+  while ( n < count && n < length && str[n] >= lower && str[n] <= upper )
+  {
+    code = (code << 6) | (str[n] & 0x3f);
+    lower = 0x80;
+    upper = 0xbf;
+    n++;
+  }
+
+  if ( n < count )
+    code = ill_formed;
+
+  return n;
+}
+
+//----------------------------------------------------------------------
+static inline auto isASCII8 (const char* str) noexcept -> bool
+{
+  uInt64 bytes{};
+  std::memcpy (&bytes, str, sizeof(bytes));  // Unaligned load
+  return (bytes & ascii_mask) == 0;
+}
+
+}  // namespace internal
+
+
+// non-member functions
+//----------------------------------------------------------------------
+auto decodeUTF8Char ( const char* str, std::size_t length
+                    , uInt32& code ) noexcept -> std::size_t
+{
+  // Decodes one code point and returns the number of bytes read.
+  // Returns 0 for an empty, ill-formed or incomplete sequence.
+
+  if ( ! str || length == 0 )
+    return 0;
+
+  const auto* ustr = reinterpret_cast<const uChar*>(str);
+  uInt32 ucs{};
+  const auto n = internal::readUTF8Sequence(ustr, length, ucs);
+
+  if ( ucs == internal::ill_formed )
+    return 0;
+
+  code = ucs;
+  return n;
+}
+
+//----------------------------------------------------------------------
+auto decodeUTF8 (const char* str, std::size_t length) -> std::wstring
+{
+  // One byte yields at most one wide character,
+  // so the output is sized before the conversion
+
+  if ( ! str || length == 0 )
+    return {};
+
+  std::wstring wide_string(length, L'\0');
+  const auto* ustr = reinterpret_cast<const uChar*>(str);
+  auto* dest = &wide_string[0];
+  std::size_t pos{0};
+  std::size_t i{0};
+
+  while ( i < length )
+  {
+    // ASCII fast path: 8 bytes per step
+    while ( i + 8 <= length && internal::isASCII8(str + i) )
+    {
+      for (std::size_t n{0}; n < 8; n++)
+        dest[pos + n] = wchar_t(ustr[i + n]);
+
+      pos += 8;
+      i += 8;
+    }
+
+    if ( i == length )
+      break;
+
+    if ( ustr[i] < 0x80 )
+    {
+      dest[pos] = wchar_t(ustr[i]);
+      pos++;
+      i++;
+      continue;
+    }
+
+    uInt32 code{};
+    i += internal::readUTF8Sequence(ustr + i, length - i, code);
+
+    if ( code == internal::ill_formed )
+      code = UTF8_REPLACEMENT_CHAR;
+
+    if ( internal::utf16_wchar && code > 0xffff )  // Surrogate pair
+    {
+      code -= 0x10000;
+      dest[pos] = wchar_t(0xd800 | (code >> 10));
+      pos++;
+      code = 0xdc00 | (code & 0x3ff);
+    }
+
+    dest[pos] = wchar_t(code);
+    pos++;
+  }
+
+  wide_string.resize(pos);
+
+  if ( pos < length / 2 )  // Release the unused memory
+    wide_string.shrink_to_fit();
+
+  return wide_string;
+}
+
+//----------------------------------------------------------------------
+auto encodeUTF8 (const wchar_t* str, std::size_t length) -> std::string
+{
+  // The output starts with one byte per character
+  // and grows only for multi-byte sequences
+
+  if ( ! str || length == 0 )
+    return {};
+
+  std::string utf8_string(length, '\0');
+  std::size_t pos{0};
+  std::size_t i{0};
+
+  while ( i < length )
+  {
+    // ASCII fast path: 4 characters per step
+    while ( i + 4 <= length
+         && ( uInt32(str[i]) | uInt32(str[i + 1])
+            | uInt32(str[i + 2]) | uInt32(str[i + 3]) ) < 0x80 )
+    {
+      for (std::size_t n{0}; n < 4; n++)
+        utf8_string[pos + n] = char(str[i + n]);
+
+      pos += 4;
+      i += 4;
+    }
+
+    if ( i == length )
+      break;
+
+    auto code = uInt32(str[i]);
+    i++;
+
+    if ( code < 0x80 )
+    {
+      utf8_string[pos] = char(code);
+      pos++;
+      continue;
+    }
+
+    if ( internal::utf16_wchar && code >= 0xd800 && code <= 0xdbff
+      && i < length && uInt32(str[i]) >= 0xdc00 && uInt32(str[i]) <= 0xdfff )
+    {
+      code = 0x10000 + ((code & 0x3ff) << 10) + (uInt32(str[i]) & 0x3ff);
+      i++;
+    }
+
+    std::array<char, UTF8_MAX_LENGTH> buffer{};
+    const auto n = encodeUTF8Char(code, buffer.data());
+    const auto needed = pos + n + (length - i);  // One byte per rest
+
+    if ( needed > utf8_string.length() )
+      utf8_string.resize(std::max(needed, utf8_string.length() * 3 / 2));
+
+    std::memcpy (&utf8_string[pos], buffer.data(), n);
+    pos += n;
+  }
+
+  utf8_string.resize(pos);
+  return utf8_string;
+}
+
+}  // namespace finalcut
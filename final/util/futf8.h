@@ -0,0 +1,108 @@
+/***********************************************************************
+* futf8.h - Locale-independent UTF-8 transcoding                       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+// UTF-8 ⇄ wide character conversion without the libc locale.
+// Ill-formed UTF-8 sequences and code points that are not Unicode
+// scalar values (surrogates, values above U+10FFFF) are replaced
+// by U+FFFD. With a 16-bit wchar_t, wide strings are UTF-16.
+
+#ifndef FUTF8_H
+#define FUTF8_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <string>
+
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+// Constants
+constexpr std::size_t UTF8_MAX_LENGTH = 4;  // Bytes per code point
+constexpr uInt32 UTF8_REPLACEMENT_CHAR = 0xfffd;
+
+// non-member function forward declarations
+auto decodeUTF8Char (const char*, std::size_t, uInt32&) noexcept -> std::size_t;
+auto encodeUTF8Char (uInt32, char*) noexcept -> std::size_t;
+auto decodeUTF8 (const char*, std::size_t) -> std::wstring;
+auto decodeUTF8 (const std::string&) -> std::wstring;
+auto encodeUTF8 (const wchar_t*, std::size_t) -> std::string;
+auto encodeUTF8 (const std::wstring&) -> std::string;
+
+
+// non-member inline functions
+//----------------------------------------------------------------------
+inline auto encodeUTF8Char (uInt32 code, char* dest) noexcept -> std::size_t
+{
+  // Writes 1 to 4 bytes (without a terminating null) into dest
+  // and returns the number of bytes
+
+  if ( code < 0x80 )  // 0xxxxxxx
+  {
+    dest[0] = char(code);
+    return 1;
+  }
+
+  if ( code < 0x800 )  // 110xxxxx 10xxxxxx
+  {
+    dest[0] = char(0xc0 | (code >> 6));
+    dest[1] = char(0x80 | (code & 0x3f));
+    return 2;
+  }
+
+  if ( code > 0x10ffff || (code >= 0xd800 && code <= 0xdfff) )
+    code = UTF8_REPLACEMENT_CHAR;  // Not a Unicode scalar value
+
+  if ( code < 0x10000 )  // 1110xxxx 10xxxxxx 10xxxxxx
+  {
+    dest[0] = char(0xe0 | (code >> 12));
+    dest[1] = char(0x80 | ((code >> 6) & 0x3f));
+    dest[2] = char(0x80 | (code & 0x3f));
+    return 3;
+  }
+
+  // 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+  dest[0] = char(0xf0 | (code >> 18));
+  dest[1] = char(0x80 | ((code >> 12) & 0x3f));
+  dest[2] = char(0x80 | ((code >> 6) & 0x3f));
+  dest[3] = char(0x80 | (code & 0x3f));
+  return 4;
+}
+
+//----------------------------------------------------------------------
+inline auto decodeUTF8 (const std::string& str) -> std::wstring
+{
+  return decodeUTF8 (str.data(), str.length());
+}
+
+//----------------------------------------------------------------------
+inline auto encodeUTF8 (const std::wstring& str) -> std::string
+{
+  return encodeUTF8 (str.data(), str.length());
+}
+
+}  // namespace finalcut
+
+#endif  // FUTF8_H
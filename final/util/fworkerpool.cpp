@@ -0,0 +1,265 @@
+/***********************************************************************
+* fworkerpool.cpp - Pool of worker threads for parallel processing     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include "final/util/fworkerpool.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FWorkerPool
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FWorkerPool::FWorkerPool (std::size_t threads)  // constructor
+{
+  // threads = 0 uses the number of hardware threads
+  startWorkers (threads == 0 ? getHardwareConcurrency() : threads);
+}
+
+//----------------------------------------------------------------------
+FWorkerPool::~FWorkerPool()  // destructor
+{
+  stopWorkers();
+}
+
+
+// public methods of FWorkerPool
+//----------------------------------------------------------------------
+auto FWorkerPool::getHardwareConcurrency() noexcept -> std::size_t
+{
+  return std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+}
+
+//----------------------------------------------------------------------
+auto FWorkerPool::getSharedPool() -> FWorkerPool*
+{
+  // The pool for the parallel work of all widgets, created on first
+  // use. The calling thread of parallelFor() processes a band itself,
+  // so the pool has one thread less than the hardware. Returns nullptr
+  // if there is only one hardware thread.
+
+  static const auto threads = getHardwareConcurrency();
+
+  if ( threads < 2 )
+    return nullptr;
+
+  static FWorkerPool shared_pool{threads - 1};
+  return &shared_pool;
+}
+
+//----------------------------------------------------------------------
+auto FWorkerPool::isIdle() const -> bool
+{
+  std::lock_guard<std::mutex> lock_guard(queue_mutex);
+  return pending_tasks == 0;
+}
+
+//----------------------------------------------------------------------
+void FWorkerPool::submit (FTask&& task)
+{
+  // Queues a task for asynchronous execution on a worker thread
+
+  if ( ! task )
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock_guard(queue_mutex);
+    task_queue.emplace_back(std::move(task));
+    pending_tasks++;
+  }
+
+  task_available.notify_one();
+}
+
+//----------------------------------------------------------------------
+void FWorkerPool::wait()
+{
+  // Blocks until all submitted tasks have been processed
+
+  std::unique_lock<std::mutex> lock(queue_mutex);
+  all_done.wait (lock, [this] { return pending_tasks == 0; });
+}
+
+//----------------------------------------------------------------------
+void FWorkerPool::parallelFor ( std::size_t begin, std::size_t end
+                              , std::size_t min_chunk
+                              , const FRangeTask& task )
+{
+  // Divides the range [begin, end) into contiguous bands and processes
+  // them concurrently. The first band runs on the calling thread, so
+  // up to thread_count + 1 bands are used. Each band covers a disjoint
+  // range, so the result is deterministic as long as the task only
+  // writes to its own range. If a band throws an exception, all other
+  // bands are still completed before the first exception is rethrown.
+
+  if ( begin >= end || ! task )
+    return;
+
+  const auto length = end - begin;
+  const auto chunk_min = std::max(min_chunk, std::size_t(1));
+  const auto max_bands = (length + chunk_min - 1) / chunk_min;
+  const auto bands = std::min(thread_count + 1, max_bands);
+
+  if ( bands <= 1 )
+  {
+    task (begin, end);  // Serial fallback
+    return;
+  }
+
+  struct BandState
+  {
+    std::mutex mutex{};
+    std::condition_variable done{};
+    std::size_t remaining{0};
+    std::exception_ptr error{};
+  };
+
+  auto state = std::make_shared<BandState>();
+  state->remaining = bands - 1;
+
+  const auto run_band = [&state, &task] (std::size_t from, std::size_t to)
+  {
+    std::exception_ptr error{};
+
+    try
+    {
+      task (from, to);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    if ( error )
+    {
+      std::lock_guard<std::mutex> lock_guard(state->mutex);
+
+      if ( ! state->error )
+        state->error = error;
+    }
+  };
+
+  const auto band_size = length / bands;
+  const auto remainder = length % bands;
+  std::size_t band_begin = begin;
+  std::size_t first_band_end{};
+
+  for (std::size_t band{0}; band < bands; band++)
+  {
+    const auto band_end = band_begin + band_size + (band < remainder ? 1 : 0);
+
+    if ( band == 0 )
+      first_band_end = band_end;
+    else
+    {
+      // The caller waits for all bands, so the references stay valid
+      submit ([state, &run_band, band_begin, band_end] ()
+              {
+                run_band (band_begin, band_end);
+                std::lock_guard<std::mutex> lock_guard(state->mutex);
+
+                if ( --state->remaining == 0 )
+                  state->done.notify_one();
+              });
+    }
+
+    band_begin = band_end;
+  }
+
+  run_band (begin, first_band_end);
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->done.wait (lock, [&state] { return state->remaining == 0; });
+
+  if ( state->error )
+    std::rethrow_exception (state->error);
+}
+
+
+// private methods of FWorkerPool
+//----------------------------------------------------------------------
+void FWorkerPool::startWorkers (std::size_t threads)
+{
+  thread_count = std::max(threads, std::size_t(1));
+  workers.reserve(thread_count);
+
+  for (std::size_t n{0}; n < thread_count; n++)
+    workers.emplace_back(&FWorkerPool::workerLoop, this);
+}
+
+//----------------------------------------------------------------------
+void FWorkerPool::stopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock_guard(queue_mutex);
+    stopping = true;
+  }
+
+  task_available.notify_all();
+
+  for (auto&& worker : workers)
+  {
+    if ( worker.joinable() )
+      worker.join();
+  }
+
+  workers.clear();
+}
+
+//----------------------------------------------------------------------
+void FWorkerPool::workerLoop()
+{
+  while ( true )
+  {
+    FTask task{};
+
+    {
+      std::unique_lock<std::mutex> lock(queue_mutex);
+      task_available.wait ( lock
+                          , [this] { return stopping || ! task_queue.empty(); } );
+
+      if ( task_queue.empty() )
+        return;  // Stopping and nothing left to do
+
+      task = std::move(task_queue.front());
+      task_queue.pop_front();
+    }
+
+    task();
+
+    {
+      std::lock_guard<std::mutex> lock_guard(queue_mutex);
+      pending_tasks--;
+
+      if ( pending_tasks == 0 )
+        all_done.notify_all();
+    }
+  }
+}
+
+}  // namespace finalcut
@@ -0,0 +1,121 @@
+/***********************************************************************
+* fworkerpool.h - Pool of worker threads for parallel processing       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FWorkerPool ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FWORKERPOOL_H
+#define FWORKERPOOL_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FWorkerPool
+//----------------------------------------------------------------------
+
+class FWorkerPool
+{
+  public:
+    // Using-declarations
+    using FTask = std::function<void()>;
+    using FRangeTask = std::function<void(std::size_t, std::size_t)>;
+
+    // Constructor
+    explicit FWorkerPool (std::size_t = 0);
+
+    // Disable copy constructor
+    FWorkerPool (const FWorkerPool&) = delete;
+
+    // Disable move constructor
+    FWorkerPool (FWorkerPool&&) noexcept = delete;
+
+    // Destructor
+    ~FWorkerPool();
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FWorkerPool&) -> FWorkerPool& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (FWorkerPool&&) noexcept -> FWorkerPool& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getThreadCount() const noexcept -> std::size_t;
+    static auto getHardwareConcurrency() noexcept -> std::size_t;
+    static auto getSharedPool() -> FWorkerPool*;
+
+    // Inquiry
+    auto isIdle() const -> bool;
+
+    // Methods
+    void submit (FTask&&);
+    void wait();
+    void parallelFor (std::size_t, std::size_t, std::size_t, const FRangeTask&);
+
+  private:
+    // Methods
+    void startWorkers (std::size_t);
+    void stopWorkers();
+    void workerLoop();
+
+    // Data members
+    std::vector<std::thread>  workers{};
+    std::deque<FTask>         task_queue{};
+    mutable std::mutex        queue_mutex{};
+    std::condition_variable   task_available{};
+    std::condition_variable   all_done{};
+    std::size_t               thread_count{1};
+    std::size_t               pending_tasks{0};
+    bool                      stopping{false};
+};
+
+// FWorkerPool inline functions
+//----------------------------------------------------------------------
+inline auto FWorkerPool::getClassName() const -> FString
+{ return "FWorkerPool"; }
+
+//----------------------------------------------------------------------
+inline auto FWorkerPool::getThreadCount() const noexcept -> std::size_t
+{ return thread_count; }
+
+}  // namespace finalcut
+
+#endif  // FWORKERPOOL_H
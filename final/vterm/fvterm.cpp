@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2016-2024 Markus Gans                                      *
+* Copyright 2016-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <array>
 #include <numeric>
 #include <string>
 #include <unordered_set>
@@ -34,6 +35,7 @@
 #include "final/util/frect.h"
 #include "final/util/fsize.h"
 #include "final/util/fsystem.h"
+#include "final/util/fworkerpool.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fstyle.h"
 #include "final/vterm/fvterm.h"
@@ -44,14 +46,28 @@ namespace finalcut
 namespace internal
 {
 
+struct FBlendRule
+{
+  uInt32 src_attr_mask;  // Attribute bits of the area character
+  uInt32 dst_attr_mask;  // Attribute bits of the covered character
+  uInt16 src_fg_mask;    // 0xffff = foreground color of the area character
+  uInt16 src_bg_mask;    // 0xffff = background color of the area character
+  bool   src_char;       // Use the character of the area
+  bool   overlay;        // Hide covered block characters
+};
+
 struct var
 {
   static bool  fvterm_initialized;  // Global init state
   static uInt8 b1_transparent_mask;
+  static std::array<uInt8, 256> b1_blend_mode;
+  static std::array<FBlendRule, 4> blend_rules;
 };
 
 bool  var::fvterm_initialized{false};
 uInt8 var::b1_transparent_mask{};
+std::array<uInt8, 256> var::b1_blend_mode{};
+std::array<FBlendRule, 4> var::blend_rules{};
 
 }  // namespace internal
 
@@ -63,6 +79,14 @@ bool                 FVTerm::force_terminal_update{false};
 FVTerm::FTermArea*   FVTerm::active_area{nullptr};
 uInt8                FVTerm::b1_print_trans_mask{};
 int                  FVTerm::tabstop{8};
+std::size_t          FVTerm::compositing_threads{1};
+FVTerm::FAreaMove    FVTerm::area_move{};
+constexpr std::size_t FVTerm::MIN_COMPOSITING_BAND_HEIGHT;
+constexpr std::size_t FVTerm::MIN_PARALLEL_COMPOSITING_CELLS;
+constexpr std::size_t FVTerm::MIN_RECTANGLE_COPY_CELLS;
+constexpr std::size_t FVTerm::MIN_RECTANGLE_FILL_CELLS;
+constexpr std::size_t FVTerm::FLineChanges::MAX_SPANS;
+constexpr uInt        FVTerm::FLineChanges::SPAN_MERGE_GAP;
 
 using TransparentInvisibleLookupMap = std::unordered_set<wchar_t>;
 
@@ -166,6 +190,19 @@ void FVTerm::setCursor (const FPoint& pos) noexcept
   }
 }
 
+//----------------------------------------------------------------------
+void FVTerm::setCompositingThreads (std::size_t threads)
+{
+  // Sets the number of threads used to merge the areas into the
+  // virtual terminal (1 = serial compositing, 0 = all hardware threads)
+
+  if ( threads == 0 )
+    threads = FWorkerPool::getHardwareConcurrency();
+
+  // The bands are processed by the shared worker pool
+  compositing_threads = threads;
+}
+
 //----------------------------------------------------------------------
 void FVTerm::setNonBlockingRead (bool enable)
 {
@@ -236,9 +273,7 @@ void FVTerm::putVTerm() const
 {
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    auto& vterm_changes = vterm->changes[unsigned(i)];
-    vterm_changes.xmin = 0;
-    vterm_changes.xmax = uInt(vterm->size.width - 1);
+    vterm->changes[unsigned(i)].add (0, uInt(vterm->size.width - 1));
   }
 
   updateTerminal();
@@ -249,9 +284,12 @@ auto FVTerm::updateTerminal() const -> bool
 {
   // Update terminal screen when modified
 
-  auto terminal_updated = canUpdateTerminalNow()
-                        ? foutput->updateTerminal()
-                        : false;
+  if ( ! canUpdateTerminalNow() )
+    return false;
+
+  copyMovedArea();
+  area_move = {};
+  const auto terminal_updated = foutput->updateTerminal();
 
   if ( terminal_updated )
     saveCurrentVTerm();
@@ -266,39 +304,29 @@ void FVTerm::reduceTerminalLineUpdates (uInt y)
   static const auto& vterm = init_object->vterm;
   static const auto& vterm_old = init_object->vterm_old;
   auto& vterm_changes = vterm->changes[unsigned(y)];
-  uInt& xmin = vterm_changes.xmin;
-  uInt& xmax = vterm_changes.xmax;
 
-  if ( xmin > xmax )  // No changes
+  if ( ! vterm_changes.hasChanges() )
     return;
 
-  const auto* first = &vterm->getFChar(int(xmin), int(y));
-  const auto* first_old = &vterm_old->getFChar(int(xmin), int(y));
-  auto* last = &vterm->getFChar(int(xmax), int(y));
-  const auto* last_old = &vterm_old->getFChar(int(xmax), int(y));
+  // Reduce each span and remove the spans without changes
+  FLineChanges::FSpanArray reduced_spans{};
+  std::size_t count{0};
 
-  while ( xmin < xmax && *first == *first_old )
+  for (std::size_t n{0}; n < vterm_changes.getSpanCount(); n++)
   {
-    xmin++;
-    first++;
-    first_old++;
-  }
+    auto span = vterm_changes.getSpan(n);
 
-  while ( last >= first && *last == *last_old )
-  {
-    xmax--;
-    last--;
-    last_old--;
+    if ( reduceSpanUpdates(vterm.get(), vterm_old.get(), span, y) )
+    {
+      reduced_spans[count] = span;
+      count++;
+    }
   }
 
-  while ( last > first )
-  {
-    if ( *last == *last_old )
-      last->attr.bit.no_changes = true;
-
-    last--;
-    last_old--;
-  }
+  if ( count == 0 )
+    vterm_changes.reset(uInt(vterm->size.width));
+  else
+    vterm_changes.setSpans(reduced_spans, count);
 }
 
 //----------------------------------------------------------------------
@@ -375,8 +403,8 @@ auto FVTerm::print (const FString& string) noexcept -> int
   if ( string.isEmpty() )
     return 0;
 
-  vterm_buffer.print(string);
-  return print (vterm_buffer);
+  auto area = getPrintArea();
+  return area ? print (area, string) : -1;
 }
 
 //----------------------------------------------------------------------
@@ -385,6 +413,9 @@ auto FVTerm::print (FTermArea* area, const FString& string) noexcept -> int
   if ( ! area || string.isEmpty() )
     return -1;
 
+  if ( isPrintableAscii(string) )  // Fast path without FVTermBuffer
+    return printAsciiString (area, string);
+
   vterm_buffer.print(string);
   return print (area, vterm_buffer);
 }
@@ -525,6 +556,228 @@ auto FVTerm::print (FTermArea* area, const FChar& term_char) const noexcept -> i
   return 1;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::fillRect (const FRect& box, wchar_t fillchar)
+{
+  // Fills the box (in print coordinates) with the current attributes
+
+  if ( box.getWidth() == 0 || box.getHeight() == 0 )
+    return;
+
+  print (box.getPos());
+  auto area = getPrintArea();
+
+  if ( ! area )
+    return;
+
+  const FPoint pos{area->cursor.x - 1, area->cursor.y - 1};
+  fillRect (area, FRect{pos, box.getSize()}, getFillChar(fillchar));
+}
+
+//----------------------------------------------------------------------
+void FVTerm::fillRect ( FTermArea* area, const FRect& box
+                      , const FChar& fillchar ) const noexcept
+{
+  // Fills the box (in area coordinates starting at 0) with fillchar.
+  // Unchanged characters are skipped, and every line gets only
+  // one change update for the changed columns.
+
+  if ( ! area || area->data.empty() )
+    return;
+
+  if ( fillchar.attr.bit.char_width > 1 )
+  {
+    fillRectFullWidth (area, box, fillchar);
+    return;
+  }
+
+  const int y_min = std::max(box.getY1(), 0);
+  const int y_max = std::min(box.getY2(), getFullAreaHeight(area) - 1);
+
+  for (auto y{y_min}; y <= y_max; y++)
+  {
+    const auto changed = writeAreaCells ( area, FPoint{box.getX1(), y}
+                                        , &fillchar, box.getWidth(), 0 );
+    addLineChanges (area, y, changed);
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::fillRectFullWidth ( FTermArea* area, const FRect& box
+                               , const FChar& fillchar ) const noexcept
+{
+  // Fills the box with pairs of the full-width fillchar and its
+  // padding character. A column without room for a whole pair
+  // (at the odd end of the box or at the area border) gets a space.
+
+  std::array<FChar, 2> pair{{ fillchar, fillchar }};
+  auto& padding = pair[1];
+
+  if ( area->encoding == Encoding::UTF8 )
+  {
+    padding.ch = {{ L'\0' }};
+    padding.attr.bit.fullwidth_padding = true;
+    padding.attr.bit.char_width = 0;
+  }
+  else
+  {
+    padding.ch[0] = L'.';
+    padding.ch[1] = L'\0';
+    padding.attr.bit.char_width = 1;
+  }
+
+  FChar space{fillchar};
+  space.ch[0] = L' ';
+  space.ch[1] = L'\0';
+  space.attr.bit.char_width = 1;
+
+  const int x1 = box.getX1();
+  const int x_min = std::max(x1, 0);
+  const int x_max = std::min(box.getX2(), getFullAreaWidth(area) - 1);
+  const int y_min = std::max(box.getY1(), 0);
+  const int y_max = std::min(box.getY2(), getFullAreaHeight(area) - 1);
+  const int first_pair = x1 + (x_min - x1 + 1) / 2 * 2;
+
+  if ( x_min > x_max )
+    return;
+
+  for (auto y{y_min}; y <= y_max; y++)
+  {
+    FChangeSpan changed{1, 0};  // Empty
+    int x = first_pair;
+
+    if ( x > x_min )  // The lead character is outside the area
+      changed = writeAreaCells (area, FPoint{x_min, y}, &space, 1, 0);
+
+    for (; x < x_max; x += 2)
+      changed = joinChangeSpans ( changed
+                                , writeAreaCells (area, FPoint{x, y}, pair.data(), 2, 1) );
+
+    if ( x == x_max )  // No room for the padding character
+      changed = joinChangeSpans ( changed
+                                , writeAreaCells (area, FPoint{x, y}, &space, 1, 0) );
+
+    addLineChanges (area, y, changed);
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::drawFrame (const FRect& box, const FFrameChars& frame_chars)
+{
+  // Draws a frame around the box (in print coordinates)
+  // with the current attributes
+
+  if ( box.getWidth() == 0 || box.getHeight() == 0 )
+    return;
+
+  print (box.getPos());
+  auto area = getPrintArea();
+
+  if ( ! area )
+    return;
+
+  const FPoint pos{area->cursor.x - 1, area->cursor.y - 1};
+  auto fchar = getFillChar(L' ');
+  fchar.attr.bit.char_width = 1;
+  drawFrame (area, FRect{pos, box.getSize()}, fchar, frame_chars);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::drawFrame ( FTermArea* area, const FRect& box
+                       , const FChar& fchar
+                       , const FFrameChars& frame_chars ) const noexcept
+{
+  // Draws a frame with the characters ┌ ─ ┐ │ │ └ ─ ┘ from frame_chars
+  // and the attributes of fchar on the edges of the box (in area
+  // coordinates starting at 0). The inside of the box is not changed.
+
+  if ( ! area || area->data.empty()
+    || box.getWidth() < 2 || box.getHeight() < 2 )
+    return;
+
+  std::array<FChar, 8> cells{};
+
+  for (std::size_t i{0}; i < cells.size(); i++)
+  {
+    cells[i] = fchar;
+    cells[i].ch[0] = frame_chars[i];
+    cells[i].ch[1] = L'\0';
+  }
+
+  const auto inner_width = box.getWidth() - 2;
+  const int x1 = box.getX1();
+  const int x2 = box.getX2();
+
+  const auto draw_line = [this, area, inner_width, x1, x2, &cells] (int y, std::size_t n)
+  {
+    // Horizontal line with corner characters (n = index of the left corner)
+    auto changed = writeAreaCells (area, FPoint{x1, y}, &cells[n], 1, 0);
+    changed = joinChangeSpans ( changed
+                              , writeAreaCells ( area, FPoint{x1 + 1, y}
+                                               , &cells[n + 1], inner_width, 0 ) );
+    changed = joinChangeSpans ( changed
+                              , writeAreaCells (area, FPoint{x2, y}, &cells[n + 2], 1, 0) );
+    addLineChanges (area, y, changed);
+  };
+
+  draw_line (box.getY1(), 0);
+  const int y_min = std::max(box.getY1() + 1, 0);
+  const int y_max = std::min(box.getY2() - 1, getFullAreaHeight(area) - 1);
+
+  for (auto y{y_min}; y <= y_max; y++)
+  {
+    // The left and right side are separate changes
+    addLineChanges (area, y, writeAreaCells (area, FPoint{x1, y}, &cells[3], 1, 0));
+    addLineChanges (area, y, writeAreaCells (area, FPoint{x2, y}, &cells[4], 1, 0));
+  }
+
+  draw_line (box.getY2(), 5);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::blit ( const FPoint& pos, const FChar* cells
+                  , std::size_t width, std::size_t height )
+{
+  // Copies the cells to pos (in print coordinates)
+
+  print (pos);
+  auto area = getPrintArea();
+
+  if ( ! area )
+    return;
+
+  const FPoint area_pos{area->cursor.x - 1, area->cursor.y - 1};
+  blit (area, area_pos, cells, width, height);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::blit ( FTermArea* area, const FPoint& pos, const FChar* cells
+                  , std::size_t width, std::size_t height ) const noexcept
+{
+  // Copies width × height cells line by line to pos (in area
+  // coordinates starting at 0). The cells must contain the column
+  // width, and a full-width character must be followed by its
+  // padding character.
+
+  if ( ! area || area->data.empty() || ! cells )
+    return;
+
+  for (std::size_t row{0}; row < height; row++)
+  {
+    const int y = pos.getY() + int(row);
+
+    if ( y < 0 )
+      continue;
+
+    if ( y >= getFullAreaHeight(area) )
+      break;
+
+    const auto changed = writeAreaCells ( area, FPoint{pos.getX(), y}
+                                        , cells + row * width, width, 1 );
+    addLineChanges (area, y, changed);
+  }
+}
+
 //----------------------------------------------------------------------
 void FVTerm::flush() const
 {
@@ -711,9 +964,7 @@ void FVTerm::getArea (const FPoint& pos, FTermArea* area) const noexcept
     const auto& tc = vterm->getFChar(ax, ay + y);  // terminal character
     auto& ac = area->getFChar(0, y);  // area character
     putAreaLine (tc, ac, unsigned(length));
-    auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(length - 1);
+    area->changes[unsigned(y)].add (0, uInt(length - 1));
   }
 }
 
@@ -748,9 +999,7 @@ void FVTerm::getArea (const FRect& box, FTermArea* area) const noexcept
     const auto& tc = vterm->getFChar(x, y + line);  // terminal character
     auto& ac = area->getFChar(dx, dy + line);  // area character
     putAreaLine (tc, ac, unsigned(length));
-    auto& line_changes = area->changes[unsigned(dy + line)];
-    line_changes.xmin = std::min(line_changes.xmin, uInt(dx));
-    line_changes.xmax = std::max(line_changes.xmax, uInt(dx + length - 1));
+    area->changes[unsigned(dy + line)].add (uInt(dx), uInt(dx + length - 1));
   }
 }
 
@@ -762,60 +1011,16 @@ void FVTerm::addLayer (FTermArea* area) const noexcept
   if ( ! area || ! area->visible )
     return;
 
-  const int ax = std::max(area->position.x, 0);
-  const int ol = std::max(0, -area->position.x);  // Outside left
   const int ay = area->position.y;
-  const int width = getFullAreaWidth(area);
   const int height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
   const int y_end = std::min(vterm->size.height - ay, height);
 
   // Call the preprocessing handler methods (child area change handling)
   callPreprocessingHandler(area);
 
-  for (auto y{0}; y < y_end; y++)  // Line loop
-  {
-    auto& line_changes = area->changes[unsigned(y)];
-    auto line_xmin = int(line_changes.xmin);
-    auto line_xmax = int(line_changes.xmax);
-    line_xmin = std::max(line_xmin, ol);
-    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
-
-    if ( line_xmin > line_xmax )
-      continue;
-
-    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
-    const int tx = ax - ol;  // Global terminal positions for x
-    const int ty = ay + y;  // Global terminal positions for y
-
-    if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
-      continue;
-
-    // Area character
-    const auto& ac = area->getFChar(line_xmin, y);
-
-    // Terminal character
-    auto& tc = vterm->getFChar(tx + line_xmin, ty);
-
-    if ( line_changes.trans_count > 0 )
-    {
-      // Line with hidden and transparent characters
-      addAreaLineWithTransparency (&ac, &tc, length);
-    }
-    else
-    {
-      // Line has only covered characters
-      putAreaLine (ac, tc, length);
-    }
-
-    int new_xmin = ax + line_xmin - ol;
-    int new_xmax = ax + line_xmax;
-    auto& vterm_changes = vterm->changes[unsigned(ty)];
-    vterm_changes.xmin = std::min(vterm_changes.xmin, uInt(new_xmin));
-    new_xmax = std::min(new_xmax, vterm->size.width - 1);
-    vterm_changes.xmax = std::max (vterm_changes.xmax, uInt(new_xmax));
-    line_changes.xmin = uInt(width);
-    line_changes.xmax = 0;
-  }
+  // Every line only writes to its own vterm row
+  compositeLines ( y_end, getFullAreaWidth(area)
+                 , [this, area] (int y) { addLayerLine(area, y); } );
 
   vterm->has_changes = true;
   updateVTermCursor(area);
@@ -858,7 +1063,7 @@ void FVTerm::copyArea (FTermArea* dst, const FPoint& pos, const FTermArea* const
   if ( length < 1 )
     return;
 
-  for (int y{0}; y < y_end; y++)  // line loop
+  const auto copy_line = [this, dst, src, ax, ay, ol, ot, length] (int y)
   {
     const int cy = ay + y;
     auto& dst_changes = dst->changes[unsigned(cy)];
@@ -876,13 +1081,52 @@ void FVTerm::copyArea (FTermArea* dst, const FPoint& pos, const FTermArea* const
       putAreaLine (*sc, *dc, unsigned(length));
     }
 
-    dst_changes.xmin = std::min(uInt(ax), dst_changes.xmin);
-    dst_changes.xmax = std::max(uInt(ax + length - 1), dst_changes.xmax);
+    dst_changes.add (uInt(ax), uInt(ax + length - 1));
+  };
+
+  const auto has_transparency = std::any_of ( src->changes.cbegin()
+                                            , src->changes.cbegin() + y_end
+                                            , [] (const FLineChanges& line)
+                                              {
+                                                return line.trans_count > 0;
+                                              } );
+
+  if ( has_transparency )
+  {
+    // Transparent lines restore the underlying areas via restoreVTerm(),
+    // which may write to any vterm line, so they must run serially
+    for (int y{0}; y < y_end; y++)  // line loop
+      copy_line(y);
   }
+  else
+    compositeLines (y_end, length, copy_line);
 
   dst->has_changes = true;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::trackAreaMove (const FTermArea* area, const FPoint& old_pos) const noexcept
+{
+  // Remembers the terminal geometry of an area before its first move
+  // since the last terminal update. The terminal can then copy the
+  // displayed window content to the new position (see copyMovedArea).
+
+  if ( ! area || area_move.discarded || area_move.area == area )
+    return;
+
+  if ( area_move.area )  // Only one moved area per terminal update
+  {
+    area_move.area = nullptr;
+    area_move.discarded = true;
+    return;
+  }
+
+  area_move.area = area;
+  area_move.geometry.setRect ( old_pos.getX(), old_pos.getY()
+                             , std::size_t(getFullAreaWidth(area))
+                             , std::size_t(getFullAreaHeight(area)) );
+}
+
 //----------------------------------------------------------------------
 void FVTerm::determineWindowLayers() noexcept
 {
@@ -920,9 +1164,7 @@ void FVTerm::scrollAreaForward (FTermArea* area)
     auto& dc = area->getFChar(0, y);  // destination character
     const auto& sc = area->getFChar(0, y + 1);  // source character
     putAreaLine (sc, dc, unsigned(area->size.width));
-    auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(x_max);
+    area->changes[unsigned(y)].add (0, uInt(x_max));
   }
 
   // insert a new line below
@@ -934,9 +1176,7 @@ void FVTerm::scrollAreaForward (FTermArea* area)
   nc.ch[1] = L'\0';
   auto& dc = area->getFChar(0, y_max);  // destination character
   std::fill (&dc, &dc + area->size.width, nc);
-  auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  area->changes[unsigned(y_max)].add (0, uInt(x_max));
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
@@ -959,9 +1199,7 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
     auto& dc = area->getFChar(0, y);  // destination character
     const auto& sc = area->getFChar(0, y - 1);  // source character
     putAreaLine (sc, dc, unsigned(area->size.width));
-    auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(x_max);
+    area->changes[unsigned(y)].add (0, uInt(x_max));
   }
 
   // insert a new line above
@@ -973,9 +1211,7 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   nc.ch[1] = L'\0';
   auto& dc = area->getFChar(0, 0);  // destination character
   std::fill (&dc, &dc + area->size.width, nc);
-  auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  area->changes[unsigned(y_max)].add (0, uInt(x_max));
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
@@ -1014,8 +1250,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
   for (auto i{0}; i < area->size.height; i++)
   {
     auto& line_changes = area->changes[unsigned(i)];
-    line_changes.xmin = 0;
-    line_changes.xmax = width - 1;
+    line_changes.add (0, width - 1);
 
     if ( nc.attr.bit.transparent
       || nc.attr.bit.color_overlay
@@ -1031,8 +1266,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
   {
     const int y = area->size.height + i;
     auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = width - 1;
+    line_changes.add (0, width - 1);
     line_changes.trans_count = width;
   }
 
@@ -1109,6 +1343,90 @@ auto FVTerm::isInitialized() -> bool
   return internal::var::fvterm_initialized;
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::reduceSpanUpdates ( FTermArea* vt, const FTermArea* vt_old
+                               , FChangeSpan& span, uInt y ) -> bool
+{
+  // Removes unchanged characters at the beginning and at the end of
+  // the span and marks the unchanged characters in between.
+  // Returns false if the span does not contain any changes.
+
+  auto* first = &vt->getFChar(int(span.xmin), int(y));
+  const auto* first_old = &vt_old->getFChar(int(span.xmin), int(y));
+  auto* last = &vt->getFChar(int(span.xmax), int(y));
+  const auto* last_old = &vt_old->getFChar(int(span.xmax), int(y));
+
+  while ( span.xmin < span.xmax && *first == *first_old )
+  {
+    span.xmin++;
+    first++;
+    first_old++;
+  }
+
+  if ( span.xmin == span.xmax && *first == *first_old )
+    return false;
+
+  while ( last > first && *last == *last_old )
+  {
+    span.xmax--;
+    last--;
+    last_old--;
+  }
+
+  while ( last > first )
+  {
+    if ( *last == *last_old )
+      last->attr.bit.no_changes = true;
+
+    last--;
+    last_old--;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::isParallelCompositing (int lines, int width) const noexcept -> bool
+{
+  // Small areas and single-row updates are cheaper to compose serially
+
+  return compositing_threads > 1
+      && FWorkerPool::getSharedPool()
+      && std::size_t(lines) >= 2 * MIN_COMPOSITING_BAND_HEIGHT
+      && std::size_t(lines) * std::size_t(width) >= MIN_PARALLEL_COMPOSITING_CELLS;
+}
+
+//----------------------------------------------------------------------
+template <typename LineFunction>
+inline void FVTerm::compositeLines (int lines, int width, LineFunction&& line_func) const
+{
+  // Calls line_func for each line from 0 to lines - 1. On large areas,
+  // the lines are divided into at most compositing_threads bands,
+  // which are processed in parallel by the shared worker pool.
+
+  if ( lines <= 0 )
+    return;
+
+  if ( ! isParallelCompositing(lines, width) )
+  {
+    for (auto y{0}; y < lines; y++)  // Line loop
+      line_func(y);
+
+    return;
+  }
+
+  const auto band_height = std::max ( MIN_COMPOSITING_BAND_HEIGHT
+                                    , ( std::size_t(lines) + compositing_threads - 1 )
+                                      / compositing_threads );
+  FWorkerPool::getSharedPool()->parallelFor ( 0, std::size_t(lines), band_height
+                                            , [&line_func] ( std::size_t first
+                                                           , std::size_t last )
+                                              {
+                                                for (auto y = first; y < last; y++)
+                                                  line_func(int(y));
+                                              } );
+}
+
 //----------------------------------------------------------------------
 void FVTerm::resetAreaEncoding() const
 {
@@ -1147,7 +1465,7 @@ inline void FVTerm::resetTextAreaToDefault ( FTermArea* area
   };
   std::fill (area->data.begin(), area->data.end(), default_char);
 
-  FLineChanges unchanged { uInt(size.getWidth()), 0, 0 };
+  const FLineChanges unchanged{uInt(size.getWidth())};
   std::fill (area->changes.begin(), area->changes.end(), unchanged);
 }
 
@@ -1340,9 +1658,8 @@ inline void FVTerm::passChangesToOverlappingWindowLine (FTermArea* win, int y, c
   const int x_end = calculateEndCoordinate (vterm_x_max, area_x_max, win_x_min, win_x_max);
 
   // Sets the new change boundaries
-  auto& line_changes = win->changes[unsigned(y)];
-  line_changes.xmin = uInt(std::min(int(line_changes.xmin), x_start));
-  line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
+  if ( x_start <= x_end )
+    win->changes[unsigned(y)].add (uInt(x_start), uInt(x_end));
 }
 
 //----------------------------------------------------------------------
@@ -1431,9 +1748,7 @@ inline void FVTerm::scrollTerminalForward() const
   // avoid update lines from 0 to (y_max - 1)
   for (auto y{0}; y < y_max; y++)
   {
-    auto& vdesktop_changes = vdesktop->changes[unsigned(y)];
-    vdesktop_changes.xmin = uInt(vdesktop->size.width - 1);
-    vdesktop_changes.xmax = 0;
+    vdesktop->changes[unsigned(y)].reset (uInt(vdesktop->size.width - 1));
   }
 
   putArea (FPoint{1, 1}, vdesktop.get());
@@ -1456,9 +1771,7 @@ inline void FVTerm::scrollTerminalReverse() const
   // avoid update lines from 1 to y_max
   for (auto y{0}; y < y_max; y++)
   {
-    auto& vdesktop_changes = vdesktop->changes[unsigned(y + 1)];
-    vdesktop_changes.xmin = uInt(vdesktop->size.width - 1);
-    vdesktop_changes.xmax = 0;
+    vdesktop->changes[unsigned(y + 1)].reset (uInt(vdesktop->size.width - 1));
   }
 
   putArea (FPoint{1, 1}, vdesktop.get());
@@ -1547,6 +1860,63 @@ void FVTerm::defineByte1TransparentMask()
   internal::var::b1_transparent_mask = getFAttributeByte(mask, 1);
 }
 
+//----------------------------------------------------------------------
+void FVTerm::defineBlendRules()
+{
+  // Precalculates the blending of an area character with the covered
+  // terminal character for the blend modes Default, Transparent,
+  // ColorOverlay and InheritBackground. The blend mode is determined
+  // with a table lookup of the attribute byte 1.
+
+  FCharAttribute trans{};
+  trans.transparent = true;
+  FCharAttribute overlay{};
+  overlay.color_overlay = true;
+  FCharAttribute inherit{};
+  inherit.inherit_background = true;
+  const auto trans_bit = getFAttributeByte(trans, 1);
+  const auto overlay_bit = getFAttributeByte(overlay, 1);
+  const auto inherit_bit = getFAttributeByte(inherit, 1);
+
+  for (std::size_t byte{0}; byte < internal::var::b1_blend_mode.size(); byte++)
+  {
+    auto mode = BlendMode::Default;
+
+    if ( byte & trans_bit )
+      mode = BlendMode::Transparent;
+    else if ( byte & overlay_bit )
+      mode = BlendMode::ColorOverlay;
+    else if ( byte & inherit_bit )
+      mode = BlendMode::InheritBackground;
+
+    internal::var::b1_blend_mode[byte] = uInt8(mode);
+  }
+
+  FAttribute all{};
+  all.word = ~uInt32(0);
+  FAttribute changes{};  // "no_changes" and "printed"
+  changes.bit.no_changes = true;
+  changes.bit.printed = true;
+  FAttribute overlay_off{};  // Removed by a color overlay
+  overlay_off.bit.color_overlay = true;
+  overlay_off.bit.reverse = true;
+  overlay_off.bit.standout = true;
+  FAttribute byte_0_1{};
+  byte_0_1.byte[0] = 0xff;
+  byte_0_1.byte[1] = 0xff;
+
+  auto& rules = internal::var::blend_rules;
+  rules[std::size_t(BlendMode::Default)] =
+      { all.word, 0, 0xffff, 0xffff, true, false };
+  rules[std::size_t(BlendMode::Transparent)] =
+      { 0, all.word, 0, 0, false, false };
+  rules[std::size_t(BlendMode::ColorOverlay)] =
+      { byte_0_1.word & ~overlay_off.word, ~byte_0_1.word & ~changes.word
+      , 0xffff, 0xffff, false, true };
+  rules[std::size_t(BlendMode::InheritBackground)] =
+      { all.word & ~changes.word, 0, 0xffff, 0, true, false };
+}
+
 //----------------------------------------------------------------------
 void FVTerm::initSettings()
 {
@@ -1583,11 +1953,303 @@ void FVTerm::finish() const
 //----------------------------------------------------------------------
 inline void FVTerm::saveCurrentVTerm() const
 {
-  // Save the content of the virtual terminal
-  std::memcpy(vterm_old->data.data(), vterm->data.data(), vterm->data.size() * sizeof(FChar));
+  // Save the content of the virtual terminal.
+  // The line changes of vterm_old hold the generation of the saved
+  // line, so only lines modified since the last save are copied.
+
+  const auto width = std::size_t(vterm->size.width);
+  const auto height = std::size_t(vterm->size.height);
+
+  for (std::size_t y{0}; y < height; y++)
+  {
+    const auto generation = vterm->changes[y].generation;
+    auto& saved_generation = vterm_old->changes[y].generation;
+
+    if ( saved_generation == generation )
+      continue;
+
+    const auto offset = y * width;
+    std::memcpy ( vterm_old->data.data() + offset
+                , vterm->data.data() + offset
+                , width * sizeof(FChar) );
+    saved_generation = generation;
+  }
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::touchVTermLines() const noexcept
+{
+  // Marks all lines of the virtual terminal as modified
+
+  for (auto& line_changes : vterm->changes)
+    line_changes.generation++;
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::invalidateSavedLine (int y, int xmin, int xmax) const noexcept
+{
+  // The terminal content of line y was changed between xmin and xmax
+  // without printing. The characters are compared again with vterm,
+  // and the saved line is renewed with the next save.
+
+  auto& line_changes = vterm->changes[unsigned(y)];
+  line_changes.add (uInt(xmin), uInt(xmax));
+  vterm_old->changes[unsigned(y)].generation = line_changes.generation - 1;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::isWindowArea (const FTermArea* area) const -> bool
+{
+  const auto& win_list = getWindowList();
+
+  if ( ! area || ! win_list )
+    return false;
+
+  return std::any_of ( win_list->cbegin()
+                     , win_list->cend()
+                     , [area] (const FVTerm* win)
+                       {
+                         return win->getVWin() == area;
+                       } );
+}
+
+//----------------------------------------------------------------------
+void FVTerm::copyMovedArea() const
+{
+  // Moves the displayed content of a moved window with a rectangular
+  // copy operation of the terminal (DECCRA) instead of reprinting it.
+  // Uniform parts of the uncovered background are filled (DECFRA).
+
+  const auto* area = area_move.area;
+
+  if ( ! area || ! foutput->hasRectangleOperations()
+    || ! isWindowArea(area) || ! area->visible )
+    return;
+
+  const auto& geometry = area_move.geometry;
+  const FPoint delta{ area->position.x - geometry.getX()
+                    , area->position.y - geometry.getY() };
+
+  if ( delta.isOrigin() )
+    return;
+
+  const FRect term_geometry{ 0, 0
+                           , std::size_t(vterm->size.width)
+                           , std::size_t(vterm->size.height) };
+  const auto old_geometry = geometry.intersect(term_geometry);
+  auto new_geometry = geometry;
+  new_geometry.move(delta);
+  new_geometry = new_geometry.intersect(term_geometry);
+
+  // The target must be inside the terminal
+  auto target = old_geometry;
+  target.move(delta);
+  target = target.intersect(term_geometry);
+  auto source = target;
+  source.move(-delta);
+
+  if ( target.getWidth() > 0 && target.getHeight() > 0
+    && getRectangleCopyGain(source, target) >= MIN_RECTANGLE_COPY_CELLS
+    && foutput->copyTerminalArea(source, target.getPos()) )
+  {
+    moveSavedTerminalCells (source, target);
+  }
+
+  fillExposedArea (old_geometry, new_geometry);
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getRectangleCopyGain ( const FRect& source
+                                  , const FRect& target ) const noexcept -> std::size_t
+{
+  // Returns the number of characters that no longer need to be
+  // printed after copying the displayed source area to the target
+
+  const auto width = int(target.getWidth());
+  const auto height = int(target.getHeight());
+  std::size_t gain{0};
+  std::size_t loss{0};
+
+  for (auto y{0}; y < height; y++)
+  {
+    const auto* src = &vterm_old->getFChar(source.getX(), source.getY() + y);
+    const auto* saved = &vterm_old->getFChar(target.getX(), target.getY() + y);
+    const auto* current = &vterm->getFChar(target.getX(), target.getY() + y);
+
+    for (auto x{0}; x < width; x++)
+    {
+      // Do not split full-width characters
+      if ( src[x].attr.bit.char_width > 1 || src[x].attr.bit.fullwidth_padding )
+        return 0;
+
+      const bool was_equal = saved[x] == current[x];
+      const bool is_equal = src[x] == current[x];
+
+      if ( is_equal && ! was_equal )
+        gain++;
+      else if ( ! is_equal && was_equal )
+        loss++;
+    }
+  }
+
+  return ( gain > loss ) ? gain - loss : 0;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::moveSavedTerminalCells ( const FRect& source
+                                    , const FRect& target ) const noexcept
+{
+  // Repeats the terminal copy operation on the saved terminal content
 
+  const auto width = target.getWidth();
+  const auto height = int(target.getHeight());
+  const bool downwards = target.getY() > source.getY();
+
+  for (auto n{0}; n < height; n++)
+  {
+    // Overlapping lines are copied in the direction of movement
+    const int y = downwards ? height - 1 - n : n;
+    const int target_y = target.getY() + y;
+    const auto* src = &vterm_old->getFChar(source.getX(), source.getY() + y);
+    auto* dst = &vterm_old->getFChar(target.getX(), target_y);
+    std::memmove (dst, src, width * sizeof(FChar));
+    invalidateSavedLine (target_y, target.getX1(), target.getX2());
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::fillExposedArea ( const FRect& old_geometry
+                             , const FRect& new_geometry ) const
+{
+  // Fills the parts of the old window geometry
+  // that are not covered by the new geometry
+
+  const auto overlap = old_geometry.intersect(new_geometry);
+
+  if ( overlap.getWidth() == 0 || overlap.getHeight() == 0 )
+  {
+    fillTerminalRectangle (old_geometry);
+    return;
+  }
+
+  const int x1 = old_geometry.getX1();
+  const int y1 = old_geometry.getY1();
+  const int x2 = old_geometry.getX2();
+  const int y2 = old_geometry.getY2();
+  // Above, below, left and right of the overlapping area
+  fillTerminalRectangle ({FPoint{x1, y1}, FPoint{x2, overlap.getY1() - 1}});
+  fillTerminalRectangle ({FPoint{x1, overlap.getY2() + 1}, FPoint{x2, y2}});
+  fillTerminalRectangle ({ FPoint{x1, overlap.getY1()}
+                         , FPoint{overlap.getX1() - 1, overlap.getY2()} });
+  fillTerminalRectangle ({ FPoint{overlap.getX2() + 1, overlap.getY1()}
+                         , FPoint{x2, overlap.getY2()} });
+}
+
+//----------------------------------------------------------------------
+void FVTerm::fillTerminalRectangle (const FRect& box) const
+{
+  // Fills the terminal rectangle box if all its characters are equal
+
+  if ( box.getWidth() == 0 || box.getHeight() == 0 )
+    return;
+
+  const auto width = int(box.getWidth());
+  const auto& fill_char = vterm->getFChar(box.getX(), box.getY());
+  std::size_t gain{0};
+
+  if ( fill_char.attr.bit.char_width > 1 || fill_char.attr.bit.fullwidth_padding )
+    return;
+
+  for (auto y{box.getY1()}; y <= box.getY2(); y++)
+  {
+    const auto* current = &vterm->getFChar(box.getX(), y);
+    const auto* saved = &vterm_old->getFChar(box.getX(), y);
+
+    for (auto x{0}; x < width; x++)
+    {
+      if ( current[x] != fill_char )
+        return;
+
+      if ( saved[x] != fill_char )
+        gain++;
+    }
+  }
+
+  if ( gain < MIN_RECTANGLE_FILL_CELLS
+    || ! foutput->fillTerminalArea(box, fill_char) )
+    return;
+
+  for (auto y{box.getY1()}; y <= box.getY2(); y++)
+  {
+    auto* saved = &vterm_old->getFChar(box.getX(), y);
+    std::fill (saved, saved + width, fill_char);
+    invalidateSavedLine (y, box.getX1(), box.getX2());
+  }
+}
+
+
+
+//----------------------------------------------------------------------
+inline void FVTerm::addLayerLine (FTermArea* area, int y) const noexcept
+{
+  // Transmit the changes of line y from area to the virtual terminal
+
+  auto& line_changes = area->changes[unsigned(y)];
+  bool transmitted{false};
+
+  // Transmit only the changed spans
+  for (std::size_t n{0}; n < line_changes.getSpanCount(); n++)
+    transmitted |= addLayerSpan (area, y, line_changes.getSpan(n));
+
+  if ( transmitted )
+    line_changes.reset(uInt(getFullAreaWidth(area)));
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::addLayerSpan ( FTermArea* area, int y
+                                 , const FChangeSpan& span ) const noexcept -> bool
+{
+  // Transmit the span of line y from area to the virtual terminal
+
+  const int ax = std::max(area->position.x, 0);
+  const int ol = std::max(0, -area->position.x);  // Outside left
+  const int ay = area->position.y;
+  const auto& line_changes = area->changes[unsigned(y)];
+  const int line_xmin = std::max(int(span.xmin), ol);
+  const int line_xmax = std::min(int(span.xmax), vterm->size.width + ol - ax - 1);
+
+  if ( line_xmin > line_xmax )
+    return false;
+
+  const std::size_t length = unsigned(line_xmax - line_xmin + 1);
+  const int tx = ax - ol;  // Global terminal positions for x
+  const int ty = ay + y;  // Global terminal positions for y
+
+  if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
+    return false;
+
+  // Area character
+  const auto& ac = area->getFChar(line_xmin, y);
+
+  // Terminal character
+  auto& tc = vterm->getFChar(tx + line_xmin, ty);
+
+  if ( line_changes.trans_count > 0 )
+  {
+    // Line with hidden and transparent characters
+    addAreaLineWithShadow (area, y, line_xmin, &ac, &tc, length);
+  }
+  else
+  {
+    // Line has only covered characters
+    putAreaLine (ac, tc, length);
+  }
+
+  const int new_xmin = ax + line_xmin - ol;
+  const int new_xmax = std::min(ax + line_xmax, vterm->size.width - 1);
+  vterm->changes[unsigned(ty)].add (uInt(new_xmin), uInt(new_xmax));
+  return true;
+}
 
 //----------------------------------------------------------------------
 inline void FVTerm::putAreaLine (const FChar& src_char, FChar& dst_char, const std::size_t length) const
@@ -1658,101 +2320,104 @@ inline void FVTerm::putTransparentAreaLine ( const FPoint& pos
   restoreVTerm(box);
 }
 
+//----------------------------------------------------------------------
+inline void FVTerm::addAreaLineWithShadow ( const FTermArea* area
+                                          , int y
+                                          , int xmin
+                                          , const FChar* src_char
+                                          , FChar* dst_char
+                                          , const std::size_t length ) const
+{
+  // The shadow region results from the area geometry: the right
+  // shadow columns of each line and the complete bottom shadow lines.
+  // Their characters are blended without searching for opaque spans.
+
+  const int shadow_x = ( y < area->size.height ) ? area->size.width : 0;
+  const auto body_length = std::size_t(std::max(0, std::min(int(length), shadow_x - xmin)));
+
+  if ( body_length > 0 )
+    addAreaLineWithTransparency (src_char, dst_char, body_length);
+
+  if ( body_length < length )
+    blendAreaLine (src_char + body_length, dst_char + body_length, length - body_length);
+}
+
 //----------------------------------------------------------------------
 inline void FVTerm::addAreaLineWithTransparency ( const FChar* src_char
                                                 , FChar* dst_char
                                                 , const std::size_t length ) const
 {
+  // Opaque spans are copied with memcpy, the remaining
+  // spans are blended character by character
+
   const auto end_char = src_char + length;
-  const auto last_char = end_char - 1;
-  const FChar* start_char{nullptr};
-  std::size_t trans_count{0};
-  std::size_t non_trans_count{0};
 
   while ( src_char < end_char )  // column loop
   {
-    const auto is_transparent = isFCharTransparent(*src_char);
-
-    if ( is_transparent )
-    {
-      putNonTransparent(non_trans_count, start_char, dst_char);
+    const auto* span_end = src_char;
 
-      if ( trans_count == 0 )
-        start_char = src_char;
+    while ( span_end < end_char && ! isFCharTransparent(*span_end) )
+      ++span_end;
 
-      trans_count++;
-    }
-    else
+    if ( span_end != src_char )
     {
-      addTransparent(trans_count, start_char, dst_char);
-
-      if ( non_trans_count == 0 )
-        start_char = src_char;
-
-      non_trans_count++;
+      const auto opaque_length = std::size_t(span_end - src_char);
+      putAreaLine (*src_char, *dst_char, opaque_length);
+      dst_char += opaque_length;
+      src_char = span_end;
     }
 
-    if ( src_char == last_char )
+    while ( src_char < end_char && isFCharTransparent(*src_char) )
     {
-      if ( trans_count != 0 )
-        addTransparentAreaLine (*start_char, *dst_char, trans_count);
-      else if ( non_trans_count != 0 )
-        putAreaLine (*start_char, *dst_char, non_trans_count);
-
-      break;
+      blendAreaChar (*src_char, *dst_char);
+      ++src_char;
+      ++dst_char;
     }
-
-    src_char++;
   }
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::addTransparentAreaLine ( const FChar& src_char
-                                           , FChar& dst_char
-                                           , const std::size_t length ) const
+inline void FVTerm::blendAreaLine ( const FChar* src_char
+                                  , FChar* dst_char
+                                  , const std::size_t length ) const noexcept
 {
-  auto src = &src_char;
-  auto dst = &dst_char;
-  const auto end = src + length;
+  const auto end_char = src_char + length;
 
-  for (; src < end; ++src)  // column loop
+  for (; src_char < end_char; ++src_char)  // column loop
   {
-    addTransparentAreaChar (*src, *dst);
-    ++dst;  // dst character
+    blendAreaChar (*src_char, *dst_char);
+    ++dst_char;  // dst character
   }
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::addTransparentAreaChar (const FChar& src_char, FChar& dst_char) const
+inline void FVTerm::blendAreaChar ( const FChar& src_char
+                                  , FChar& dst_char ) const noexcept
 {
-  if ( src_char.attr.bit.transparent )  // Transparent
-    return;  // Leave character on vterm untouched
+  // Blends an area character with the covered terminal character.
+  // Instead of branching on the transparent, color_overlay and
+  // inherit_background bits, the precalculated rule of the blend
+  // mode selects the source of each character component.
+  //
+  //  Default           : area character
+  //  Transparent       : covered character
+  //  ColorOverlay      : covered character + area colors and attributes
+  //  InheritBackground : area character + covered background color
 
-  if ( src_char.attr.bit.color_overlay )  // Color overlay
-  {
-    // Get covered character + add the current color
-    dst_char.fg_color = src_char.fg_color;
-    dst_char.bg_color = src_char.bg_color;
-    dst_char.attr.byte[0] = src_char.attr.byte[0];
-    dst_char.attr.byte[1] = src_char.attr.byte[1];
-    dst_char.attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
-    dst_char.attr.bit.color_overlay  = false;
-    dst_char.attr.bit.reverse  = false;
-    dst_char.attr.bit.standout = false;
+  const auto mode = internal::var::b1_blend_mode[src_char.attr.byte[1]];
+  const auto& rule = internal::var::blend_rules[mode];
+  const auto& char_src = rule.src_char ? src_char : dst_char;
+  dst_char.ch = char_src.ch;
+  dst_char.encoded_char = char_src.encoded_char;
+  dst_char.fg_color = FColor( (uInt16(src_char.fg_color) & rule.src_fg_mask)
+                            | (uInt16(dst_char.fg_color) & uInt16(~rule.src_fg_mask)) );
+  dst_char.bg_color = FColor( (uInt16(src_char.bg_color) & rule.src_bg_mask)
+                            | (uInt16(dst_char.bg_color) & uInt16(~rule.src_bg_mask)) );
+  dst_char.attr.word = (src_char.attr.word & rule.src_attr_mask)
+                     | (dst_char.attr.word & rule.dst_attr_mask);
 
-    if ( isTransparentInvisible(dst_char) )
-      dst_char.ch[0] = L' ';
-  }
-  else if ( src_char.attr.bit.inherit_background )
-  {
-    // Add the covered background to this character
-    auto bg_color = dst_char.bg_color;
-    dst_char = src_char;
-    dst_char.bg_color = bg_color;
-    dst_char.attr.byte[2] &= ~0x03;  // Clearing "no_changes" and "printed"
-  }
-  else  // Default
-    dst_char = src_char;
+  if ( rule.overlay && isTransparentInvisible(dst_char) )
+    dst_char.ch[0] = L' ';
 }
 
 //----------------------------------------------------------------------
@@ -1769,6 +2434,7 @@ auto FVTerm::clearFullArea (FTermArea* area, FChar& fillchar) const -> bool
   {
     fillchar.attr.bit.printed = true;
     std::fill (vterm->data.begin(), vterm->data.end(), fillchar);
+    touchVTermLines();
     saveCurrentVTerm();
   }
   else
@@ -1776,8 +2442,7 @@ auto FVTerm::clearFullArea (FTermArea* area, FChar& fillchar) const -> bool
     for (auto i{0}; i < vdesktop->size.height; i++)
     {
       auto& vdesktop_changes = vdesktop->changes[unsigned(i)];
-      vdesktop_changes.xmin = 0;
-      vdesktop_changes.xmax = uInt(vdesktop->size.width) - 1;
+      vdesktop_changes.add (0, uInt(vdesktop->size.width) - 1);
       vdesktop_changes.trans_count = 0;
     }
 
@@ -1906,11 +2571,7 @@ inline auto FVTerm::printCharacterOnCoordinate ( FTermArea* area
 
   const auto padding = unsigned(ac->attr.bit.char_width == 2);
 
-  if ( uInt(ax) < line_changes.xmin )
-    line_changes.xmin = uInt(ax);
-
-  if ( uInt(ax) + padding > line_changes.xmax )
-    line_changes.xmax = uInt(ax) + padding;
+  line_changes.add (uInt(ax), uInt(ax) + padding);
 
   return ac->attr.bit.char_width;
 }
@@ -1942,27 +2603,196 @@ inline void FVTerm::printPaddingCharacter (FTermArea* area, const FChar& term_ch
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::putNonTransparent ( std::size_t& non_trans_count
-                                      , const FChar* start_char, FChar*& dst_char ) const
+auto FVTerm::printAsciiString ( FTermArea* area
+                              , const FString& string ) const noexcept -> int
 {
-  if ( non_trans_count == 0 )
+  // Printable ASCII characters have no combining characters and
+  // a column width of 1. Therefore, they are written directly line
+  // by line into the area with the same cursor movement and the
+  // same change spans as print(area, FChar).
+
+  static const auto& next_attr = getAttribute();
+  FChar fchar{};
+  fchar.fg_color     = next_attr.fg_color;
+  fchar.bg_color     = next_attr.bg_color;
+  fchar.attr.byte[0] = next_attr.attr.byte[0];
+  fchar.attr.byte[1] = next_attr.attr.byte[1];
+  fchar.attr.bit.char_width = 1;
+  const int full_width = getFullAreaWidth(area);
+  const int full_height = getFullAreaHeight(area);
+  auto iter = string.cbegin();
+  const auto end = string.cend();
+  int len{0};
+
+  while ( iter != end )
+  {
+    if ( ! area->checkPrintPos() || printWrap(area) )
+      break;  // Cursor position out of range or end of area reached
+
+    const int ax = area->cursor.x - 1;
+    const int ay = area->cursor.y - 1;
+    const auto run = int(std::min(std::ptrdiff_t(full_width - ax), end - iter));
+    auto* ac = &area->getFChar(ax, ay);  // area character
+    auto& line_changes = area->changes[unsigned(ay)];
+    uInt span_min{1};
+    uInt span_max{0};
+
+    for (auto i{0}; i < run; i++, ++iter)
+    {
+      fchar.ch[0] = *iter;
+
+      if ( ac[i] == fchar )
+        continue;
+
+      if ( changedToTransparency(ac[i], fchar) )
+        line_changes.trans_count++;
+
+      if ( changedFromTransparency(ac[i], fchar) )
+        line_changes.trans_count--;
+
+      ac[i] = fchar;
+      const auto x = uInt(ax + i);
+
+      if ( span_min <= span_max && x <= span_max + FLineChanges::SPAN_MERGE_GAP )
+      {
+        span_max = x;  // Extend the current span
+        continue;
+      }
+
+      if ( span_min <= span_max )
+        line_changes.add (span_min, span_max);
+
+      span_min = x;
+      span_max = x;
+    }
+
+    if ( span_min <= span_max )
+      line_changes.add (span_min, span_max);
+
+    len += run;
+    area->cursor.x += run;
+    area->has_changes = true;
+
+    // Line break at right margin
+    if ( area->cursor.x > full_width )
+    {
+      area->cursor.x = 1;
+      area->cursor.y++;
+    }
+
+    // Prevent up scrolling
+    if ( area->cursor.y > full_height )
+      area->cursor.y--;
+  }
+
+  return len;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::getFillChar (wchar_t fillchar) const -> FChar
+{
+  // Returns the fill character with the current attributes
+
+  static const auto& next_attr = getAttribute();
+  FChar fchar{};
+  fchar.fg_color     = next_attr.fg_color;
+  fchar.bg_color     = next_attr.bg_color;
+  fchar.attr.byte[0] = next_attr.attr.byte[0];
+  fchar.attr.byte[1] = next_attr.attr.byte[1];
+  fchar.ch[0] = fillchar;
+  fchar.ch[1] = L'\0';
+  fchar.attr.bit.char_width = getColumnWidth(fillchar) & 0x03;
+  return fchar;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::writeAreaCells ( FTermArea* area, const FPoint& pos
+                                   , const FChar* src, std::size_t length
+                                   , std::size_t step ) const noexcept -> FChangeSpan
+{
+  // Writes length characters from src to pos in the area line and
+  // returns the changed columns. With a step of 0, the first source
+  // character is repeated. The line is clipped to the area.
+
+  FChangeSpan changed{1, 0};  // Empty
+  int x = pos.getX();
+  const int y = pos.getY();
+  const int full_width = getFullAreaWidth(area);
+
+  if ( y < 0 || y >= getFullAreaHeight(area) || x >= full_width
+    || length == 0 || x + int(length) <= 0 )
+    return changed;
+
+  if ( x < 0 )
+  {
+    src += std::size_t(-x) * step;
+    length -= std::size_t(-x);
+    x = 0;
+  }
+
+  length = std::min(length, std::size_t(full_width - x));
+  auto* dst = &area->getFChar(x, y);
+  auto& line_changes = area->changes[unsigned(y)];
+  std::size_t first{length};
+  std::size_t last{0};
+
+  for (std::size_t i{0}; i < length; i++, src += step)
+  {
+    if ( dst[i] == *src )
+      continue;
+
+    if ( isFCharTransparent(dst[i]) )
+      line_changes.trans_count--;
+
+    if ( isFCharTransparent(*src) )
+      line_changes.trans_count++;
+
+    dst[i] = *src;
+    first = std::min(first, i);
+    last = i;
+  }
+
+  if ( first < length )
+    changed = {uInt(x) + uInt(first), uInt(x) + uInt(last)};
+
+  return changed;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::joinChangeSpans ( const FChangeSpan& span1
+                                    , const FChangeSpan& span2 ) noexcept -> FChangeSpan
+{
+  if ( span2.xmin > span2.xmax )
+    return span1;
+
+  if ( span1.xmin > span1.xmax )
+    return span2;
+
+  return { std::min(span1.xmin, span2.xmin)
+         , std::max(span1.xmax, span2.xmax) };
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::addLineChanges ( FTermArea* area, int y
+                                   , const FChangeSpan& changed ) noexcept
+{
+  if ( changed.xmin > changed.xmax )
     return;
 
-  putAreaLine(*start_char, *dst_char, non_trans_count);
-  dst_char += non_trans_count;  // dst character
-  non_trans_count = 0;
+  area->changes[unsigned(y)].add (changed.xmin, changed.xmax);
+  area->has_changes = true;
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::addTransparent ( std::size_t& trans_count
-                                   , const FChar* start_char, FChar*& dst_char ) const
+inline void FVTerm::putNonTransparent ( std::size_t& non_trans_count
+                                      , const FChar* start_char, FChar*& dst_char ) const
 {
-  if ( trans_count == 0 )
+  if ( non_trans_count == 0 )
     return;
 
-  addTransparentAreaLine (*start_char, *dst_char, trans_count);
-  dst_char += trans_count;  // dst character
-  trans_count = 0;
+  putAreaLine(*start_char, *dst_char, non_trans_count);
+  dst_char += non_trans_count;  // dst character
+  non_trans_count = 0;
 }
 
 //----------------------------------------------------------------------
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2016-2024 Markus Gans                                      *
+* Copyright 2016-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -50,6 +50,7 @@
 #include <sys/time.h>  // need for timeval (cygwin)
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -99,16 +100,60 @@ class FVTerm : public FVTermAttribute
     struct FTermArea;             // forward declaration
     struct FVTermPreprocessing;   // forward declaration
 
-    struct FLineChanges
+    struct FChangeSpan
     {
       uInt xmin;           // X-position with the first change
       uInt xmax;           // X-position with the last change
-      uInt trans_count;    // Number of transparent characters
+    };
+
+    class FLineChanges
+    {
+      public:
+        // Constants
+        static constexpr std::size_t MAX_SPANS = 4;
+        static constexpr uInt SPAN_MERGE_GAP = 4;
+
+        // Using-declaration
+        using FSpanArray = std::array<FChangeSpan, MAX_SPANS>;
+
+        // Constructors
+        FLineChanges() = default;
+        explicit FLineChanges (uInt) noexcept;
+
+        // Accessors
+        auto getXMin() const noexcept -> uInt;
+        auto getXMax() const noexcept -> uInt;
+        auto getSpanCount() const noexcept -> std::size_t;
+        auto getSpan (std::size_t) const noexcept -> const FChangeSpan&;
+
+        // Mutator
+        void setSpans (const FSpanArray&, std::size_t) noexcept;
+
+        // Inquiry
+        auto hasChanges() const noexcept -> bool;
+
+        // Methods
+        void add (uInt, uInt) noexcept;
+        void reset (uInt) noexcept;
+
+        // Data members
+        uInt trans_count{0};  // Number of transparent characters
+        uInt generation{0};   // Modification counter of the line
+
+      private:
+        // Data members (only changed by add(), setSpans() and reset(),
+        // so the span list always covers all changes of the line.
+        // The default is a change in column 0.)
+        uInt         xmin{0};        // X-position with the first change
+        uInt         xmax{0};        // X-position with the last change
+        FSpanArray   spans{};        // Changed intervals
+        std::size_t  span_count{1};  // Number of used spans
     };
 
     // Using-declarations
     using FVTermAttribute::print;
     using FCharVector = std::vector<FChar>;
+    using FFrameChars = std::array<wchar_t, 8>;  // ┌ ─ ┐ │ │ └ ─ ┘
     using FPreprocessingHandler = void (FVTerm::*)();
     using FPreprocessingFunction = std::function<void()>;
     using FPreprocVector = std::vector<std::unique_ptr<FVTermPreprocessing>>;
@@ -173,11 +218,13 @@ class FVTerm : public FVTermAttribute
     auto  getVWin() const noexcept -> const FTermArea*;
     auto  getPrintCursor() -> FPoint;
     static auto  getWindowList() -> FVTermList*;
+    static auto  getCompositingThreads() noexcept -> std::size_t;
 
     // Mutators
     void  setTerminalUpdates (TerminalUpdate) const;
     void  setCursor (const FPoint&) noexcept;
     void  setVWin (std::unique_ptr<FTermArea>&&) noexcept;
+    static void  setCompositingThreads (std::size_t);
     static void  setNonBlockingRead (bool = true);
     static void  unsetNonBlockingRead();
 
@@ -216,6 +263,14 @@ class FVTerm : public FVTermAttribute
     auto  print (FTermArea*, const FChar&) const noexcept -> int;
     virtual void print (const FPoint&);
     auto  print() & -> FVTerm&;
+    void  fillRect (const FRect&, wchar_t = L' ');
+    void  fillRect (FTermArea*, const FRect&, const FChar&) const noexcept;
+    void  drawFrame (const FRect&, const FFrameChars&);
+    void  drawFrame ( FTermArea*, const FRect&
+                    , const FChar&, const FFrameChars& ) const noexcept;
+    void  blit (const FPoint&, const FChar*, std::size_t, std::size_t);
+    void  blit ( FTermArea*, const FPoint&, const FChar*
+               , std::size_t, std::size_t ) const noexcept;
     void  flush() const;
 
   protected:
@@ -258,6 +313,7 @@ class FVTerm : public FVTermAttribute
     void  addLayer (FTermArea*) const noexcept;
     void  putArea (const FPoint&, const FTermArea*) const noexcept;
     void  copyArea (FTermArea*, const FPoint&, const FTermArea* const)  const noexcept;
+    void  trackAreaMove (const FTermArea*, const FPoint&) const noexcept;
     static auto  getLayer (FVTerm&) noexcept -> int;
     static void  determineWindowLayers() noexcept;
     void  scrollAreaForward (FTermArea*);
@@ -272,8 +328,12 @@ class FVTerm : public FVTermAttribute
   private:
     // Constants
     static constexpr int DEFAULT_MINIMIZED_HEIGHT = 1;
+    static constexpr std::size_t MIN_COMPOSITING_BAND_HEIGHT = 8;
+    static constexpr std::size_t MIN_PARALLEL_COMPOSITING_CELLS = 16'384;
+    static constexpr std::size_t MIN_RECTANGLE_COPY_CELLS = 32;
+    static constexpr std::size_t MIN_RECTANGLE_FILL_CELLS = 24;
 
-    // Enumeration
+    // Enumerations
     enum class CoveredState
     {
       None,
@@ -281,10 +341,29 @@ class FVTerm : public FVTermAttribute
       Full
     };
 
+    enum class BlendMode : uInt8
+    {
+      Default,
+      Transparent,
+      ColorOverlay,
+      InheritBackground
+    };
+
+    struct FAreaMove
+    {
+      const FTermArea* area{nullptr};  // Moved area
+      FRect geometry{};                // Terminal geometry before the move
+      bool  discarded{false};          // More than one area was moved
+    };
+
     // Methods
     static void setGlobalFVTermInstance (FVTerm* ptr);
     static auto getGlobalFVTermInstance() -> FVTerm*&;
     static auto isInitialized() -> bool;
+    static auto reduceSpanUpdates (FTermArea*, const FTermArea*, FChangeSpan&, uInt) -> bool;
+    auto  isParallelCompositing (int, int) const noexcept -> bool;
+    template <typename LineFunction>
+    void  compositeLines (int, int, LineFunction&&) const;
     void  resetAreaEncoding() const;
     void  resetTextAreaToDefault (FTermArea*, const FSize&) const noexcept;
     auto  resizeTextArea (FTermArea*, std::size_t, std::size_t ) const -> bool;
@@ -314,17 +393,29 @@ class FVTerm : public FVTermAttribute
     auto  isFCharTransparent (const FChar&) const -> bool;
     auto  isTransparentInvisible (const FChar&) const -> bool;
     static void defineByte1TransparentMask();
+    static void defineBlendRules();
     template <typename FOutputType>
     void  init();
     void  initSettings();
     void  finish() const;
     void  saveCurrentVTerm() const;
+    void  touchVTermLines() const noexcept;
+    void  invalidateSavedLine (int, int, int) const noexcept;
+    auto  isWindowArea (const FTermArea*) const -> bool;
+    void  copyMovedArea() const;
+    auto  getRectangleCopyGain (const FRect&, const FRect&) const noexcept -> std::size_t;
+    void  moveSavedTerminalCells (const FRect&, const FRect&) const noexcept;
+    void  fillExposedArea (const FRect&, const FRect&) const;
+    void  fillTerminalRectangle (const FRect&) const;
+    void  addLayerLine (FTermArea*, int) const noexcept;
+    auto  addLayerSpan (FTermArea*, int, const FChangeSpan&) const noexcept -> bool;
     void  putAreaLine (const FChar&, FChar&, const std::size_t) const;
     void  putAreaLineWithTransparency (const FChar*, FChar*, const int, FPoint) const;
     void  putTransparentAreaLine (const FPoint&, const std::size_t) const;
+    void  addAreaLineWithShadow (const FTermArea*, int, int, const FChar*, FChar*, const std::size_t) const;
     void  addAreaLineWithTransparency (const FChar*, FChar*, const std::size_t) const;
-    void  addTransparentAreaLine (const FChar&, FChar&, const std::size_t) const;
-    void  addTransparentAreaChar (const FChar&, FChar&) const;
+    void  blendAreaLine (const FChar*, FChar*, const std::size_t) const noexcept;
+    void  blendAreaChar (const FChar&, FChar&) const noexcept;
     auto  clearFullArea (FTermArea*, FChar&) const -> bool;
     void  clearAreaWithShadow (FTermArea*, const FChar&) const noexcept;
     auto  printWrap (FTermArea*) const -> bool;
@@ -334,8 +425,14 @@ class FVTerm : public FVTermAttribute
     auto  printCharacterOnCoordinate ( FTermArea*
                                      , const FChar&) const noexcept -> std::size_t;
     void  printPaddingCharacter (FTermArea*, const FChar&) const;
+    auto  printAsciiString (FTermArea*, const FString&) const noexcept -> int;
+    auto  getFillChar (wchar_t) const -> FChar;
+    void  fillRectFullWidth (FTermArea*, const FRect&, const FChar&) const noexcept;
+    auto  writeAreaCells ( FTermArea*, const FPoint&, const FChar*
+                         , std::size_t, std::size_t ) const noexcept -> FChangeSpan;
+    static auto  joinChangeSpans (const FChangeSpan&, const FChangeSpan&) noexcept -> FChangeSpan;
+    static void  addLineChanges (FTermArea*, int, const FChangeSpan&) noexcept;
     void  putNonTransparent (std::size_t&, const FChar*, FChar*&) const;
-    void  addTransparent (std::size_t&, const FChar*, FChar*&) const;
     void  putTransparent (std::size_t&, const FPoint&, FChar*&) const;
     auto  isInsideTerminal (const FPoint&) const noexcept -> bool;
     auto  canUpdateTerminalNow() const -> bool;
@@ -355,6 +452,8 @@ class FVTerm : public FVTermAttribute
     static FTermArea*            active_area;                // Active area
     static uInt8                 b1_print_trans_mask;        // Transparency mask
     static int                   tabstop;
+    static std::size_t           compositing_threads;
+    static FAreaMove             area_move;                  // Window move since the last update
     static bool                  draw_completed;
     static bool                  skip_one_vterm_update;
     static bool                  no_terminal_updates;
@@ -366,6 +465,151 @@ class FVTerm : public FVTermAttribute
 };
 
 
+//----------------------------------------------------------------------
+// class FVTerm::FLineChanges
+//----------------------------------------------------------------------
+
+inline FVTerm::FLineChanges::FLineChanges (uInt unchanged_xmin) noexcept
+  : xmin{unchanged_xmin}
+  , span_count{0}
+{ }
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getXMin() const noexcept -> uInt
+{ return xmin; }
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getXMax() const noexcept -> uInt
+{ return xmax; }
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getSpanCount() const noexcept -> std::size_t
+{ return span_count; }
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getSpan (std::size_t index) const noexcept
+    -> const FChangeSpan&
+{ return spans[index]; }
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::setSpans ( const FSpanArray& span_list
+                                           , std::size_t count ) noexcept
+{
+  // Replaces the changes with 1 to MAX_SPANS sorted, disjoint spans
+  // (e.g. after narrowing them). The generation is not changed.
+
+  if ( count == 0 || count > MAX_SPANS )
+    return;
+
+  std::copy (span_list.begin(), span_list.begin() + std::ptrdiff_t(count), spans.begin());
+  span_count = count;
+  xmin = spans[0].xmin;
+  xmax = spans[count - 1].xmax;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::hasChanges() const noexcept -> bool
+{ return xmin <= xmax; }
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::add (uInt first, uInt last) noexcept
+{
+  // Adds the changed columns first to last. A line stores up to
+  // MAX_SPANS disjoint intervals, so distant changes do not mark
+  // the unchanged characters in between. Spans with a gap of up to
+  // SPAN_MERGE_GAP columns are merged. If there are too many spans,
+  // the two closest spans are merged.
+
+  if ( first > last )
+    return;
+
+  generation++;
+
+  if ( xmin > xmax )  // No previous changes
+  {
+    spans[0] = {first, last};
+    span_count = 1;
+    xmin = first;
+    xmax = last;
+    return;
+  }
+
+  auto& last_span = spans[span_count - 1];
+
+  if ( first >= last_span.xmin && first <= last_span.xmax + SPAN_MERGE_GAP )
+  {
+    // Fast path: extend the last span (e.g. for consecutive characters)
+    last_span.xmax = std::max(last_span.xmax, last);
+    xmax = last_span.xmax;
+    return;
+  }
+
+  std::array<FChangeSpan, MAX_SPANS + 1> merged{};
+  std::size_t count{0};
+  std::size_t index{0};
+
+  // Spans on the left side
+  while ( index < span_count && spans[index].xmax + SPAN_MERGE_GAP < first )
+  {
+    merged[count] = spans[index];
+    count++;
+    index++;
+  }
+
+  // Overlapping or neighbouring spans
+  FChangeSpan new_span{first, last};
+
+  while ( index < span_count && spans[index].xmin <= last + SPAN_MERGE_GAP )
+  {
+    new_span.xmin = std::min(new_span.xmin, spans[index].xmin);
+    new_span.xmax = std::max(new_span.xmax, spans[index].xmax);
+    index++;
+  }
+
+  merged[count] = new_span;
+  count++;
+
+  // Spans on the right side
+  while ( index < span_count )
+  {
+    merged[count] = spans[index];
+    count++;
+    index++;
+  }
+
+  if ( count > MAX_SPANS )
+  {
+    // Merge the two spans with the smallest gap
+    std::size_t pos{0};
+
+    for (std::size_t i{1}; i + 1 < count; i++)
+    {
+      if ( merged[i + 1].xmin - merged[i].xmax
+         < merged[pos + 1].xmin - merged[pos].xmax )
+        pos = i;
+    }
+
+    merged[pos].xmax = merged[pos + 1].xmax;
+    const auto iter = merged.begin() + std::ptrdiff_t(pos);
+    std::copy (iter + 2, merged.begin() + std::ptrdiff_t(count), iter + 1);
+    count--;
+  }
+
+  std::copy (merged.begin(), merged.begin() + std::ptrdiff_t(count), spans.begin());
+  span_count = count;
+  xmin = std::min(xmin, first);
+  xmax = std::max(xmax, last);
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::reset (uInt unchanged_xmin) noexcept
+{
+  xmin = unchanged_xmin;
+  xmax = 0;
+  span_count = 0;
+}
+
+
 //----------------------------------------------------------------------
 // struct FVTerm::FTermArea
 //----------------------------------------------------------------------
@@ -570,9 +814,9 @@ inline auto FVTerm::FTermArea::reprint (const FRect& box, const FSize& term_size
     const int box_x2 = x_pos + w - 1;
     const int x2 = position.x + size.width + shadow.width - 1;
     const int x_end = std::min(int(term_size.getWidth()) - 1 , std::min(box_x2, x2)) - position.x;
-    auto& line_changes = changes[std::size_t(y)];
-    line_changes.xmin = uInt(std::min(int(line_changes.xmin), x_start));
-    line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
+
+    if ( x_start <= x_end )
+      changes[std::size_t(y)].add (uInt(x_start), uInt(x_end));
   }
 
   return true;
@@ -740,6 +984,10 @@ inline auto FVTerm::getWindowList() -> FVTermList*
         : nullptr;
 }
 
+//----------------------------------------------------------------------
+inline auto FVTerm::getCompositingThreads() noexcept -> std::size_t
+{ return compositing_threads; }
+
 //----------------------------------------------------------------------
 inline void FVTerm::setVWin (std::unique_ptr<FTermArea>&& area) noexcept
 { vwin = std::move(area); }
@@ -846,6 +1094,7 @@ inline void FVTerm::init()
   {
     setGlobalFVTermInstance(this);
     defineByte1TransparentMask();
+    defineBlendRules();
     b1_print_trans_mask = getByte1PrintTransMask();
     foutput     = std::make_shared<FOutputType>(*this);
     window_list = std::make_shared<FVTermList>();
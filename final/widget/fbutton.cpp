@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2012-2024 Markus Gans                                      *
+* Copyright 2012-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -218,11 +218,8 @@ void FButton::hide()
   if ( size == 0 )
     return;
 
-  for (std::size_t y{0}; y < getHeight() + s + (f << 1u); y++)
-  {
-    print() << FPoint{1 - int(f), 1 + int(y) - int(f)}
-            << FString{size, L' '};
-  }
+  fillRect (FRect{ FPoint{1 - int(f), 1 - int(f)}
+                 , FSize{size, getHeight() + s + (f << 1u)} });
 }
 
 //----------------------------------------------------------------------
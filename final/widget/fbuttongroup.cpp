@@ -4,7 +4,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -170,8 +170,7 @@ void FButtonGroup::hide()
   // Hide border
   unsetViewportPrint();
 
-  for (auto y{0}; y < int(getHeight()); y++)
-    print() << FPoint{1, 1 + y} << FString{size, L' '};
+  fillRect (FRect{FPoint{1, 1}, FSize{size, getHeight()}});
 
   setViewportPrint();
 }
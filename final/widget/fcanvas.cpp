@@ -0,0 +1,372 @@
+/***********************************************************************
+* fcanvas.cpp - Widget FCanvas (a pixel buffer shown with block cells) *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <array>
+
+#include "final/fc.h"
+#include "final/util/frect.h"
+#include "final/util/fworkerpool.h"
+#include "final/widget/fcanvas.h"
+
+namespace finalcut
+{
+
+// Constants
+constexpr std::size_t canvas_tile_width = 64;    // Pixels per render tile
+constexpr std::size_t canvas_tile_height = 32;
+constexpr std::size_t canvas_rows_per_band = 8;  // Conversion band size
+
+// Quadrant characters indexed by the foreground pixel mask
+// (1 = upper left, 2 = upper right, 4 = lower left, 8 = lower right)
+constexpr std::array<wchar_t, 16> quadrant_chars
+{{
+  0x0020,  // 0000
+  0x2598,  // 0001 ▘
+  0x259d,  // 0010 ▝
+  0x2580,  // 0011 ▀
+  0x2596,  // 0100 ▖
+  0x258c,  // 0101 ▌
+  0x259e,  // 0110 ▞
+  0x259b,  // 0111 ▛
+  0x2597,  // 1000 ▗
+  0x259a,  // 1001 ▚
+  0x2590,  // 1010 ▐
+  0x259c,  // 1011 ▜
+  0x2584,  // 1100 ▄
+  0x2599,  // 1101 ▙
+  0x259f,  // 1110 ▟
+  0x2588   // 1111 █
+}};
+
+//----------------------------------------------------------------------
+// class FCanvas
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FCanvas::FCanvas (FWidget* parent)
+  : FWidget{parent}
+{
+  init();
+}
+
+//----------------------------------------------------------------------
+FCanvas::~FCanvas() noexcept = default;  // destructor
+
+
+// public methods of FCanvas
+//----------------------------------------------------------------------
+void FCanvas::setSize (const FSize& size, bool adjust)
+{
+  FWidget::setSize (size, adjust);
+  resizePixels();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::setGeometry ( const FPoint& pos, const FSize& size
+                          , bool adjust )
+{
+  FWidget::setGeometry (pos, size, adjust);
+  resizePixels();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::setCanvasStyle (CanvasStyle style)
+{
+  if ( canvas_style == style )
+    return;
+
+  canvas_style = style;
+  resizePixels();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::fill (FColor color)
+{
+  std::fill (pixels.begin(), pixels.end(), color);
+}
+
+//----------------------------------------------------------------------
+void FCanvas::clear()
+{
+  fill (getBackgroundColor());
+}
+
+//----------------------------------------------------------------------
+void FCanvas::render (const FRenderTask& task)
+{
+  // Calls the task for tiles of the pixel buffer on the worker pool
+  // and shows the result. The task must only write the pixels of the
+  // given tile, because the tiles are rendered in parallel.
+
+  if ( ! task || pixels.empty() )
+    return;
+
+  const auto columns = (pixel_width + canvas_tile_width - 1) / canvas_tile_width;
+  const auto rows = (pixel_height + canvas_tile_height - 1) / canvas_tile_height;
+  const auto width = pixel_width;
+  const auto height = pixel_height;
+
+  const auto render_tiles = [&task, columns, width, height] ( std::size_t first
+                                                             , std::size_t last )
+  {
+    for (auto tile = first; tile < last; tile++)
+    {
+      const auto x = (tile % columns) * canvas_tile_width;
+      const auto y = (tile / columns) * canvas_tile_height;
+      const FSize size { std::min(canvas_tile_width, width - x)
+                       , std::min(canvas_tile_height, height - y) };
+      task (FRect{FPoint{int(x), int(y)}, size});
+    }
+  };
+
+  if ( auto pool = FWorkerPool::getSharedPool() )
+    pool->parallelFor (0, columns * rows, 1, render_tiles);
+  else
+    render_tiles (0, columns * rows);  // Serial fallback
+
+  update();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::update()
+{
+  // Shows the changed pixels
+
+  if ( isShown() )
+    writeCells();
+}
+
+
+// private methods of FCanvas
+//----------------------------------------------------------------------
+auto FCanvas::getDrawStyle() const -> CanvasStyle
+{
+  // Quadrant and Braille characters are only available with UTF-8
+
+  if ( canvas_style != CanvasStyle::HalfBlock
+    && FVTerm::getFOutput()->getEncoding() != Encoding::UTF8 )
+    return CanvasStyle::HalfBlock;
+
+  return canvas_style;
+}
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getSubColumns() const -> std::size_t
+{
+  return ( draw_style == CanvasStyle::HalfBlock ) ? 1 : 2;
+}
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getSubRows() const -> std::size_t
+{
+  return ( draw_style == CanvasStyle::Braille ) ? 4 : 2;
+}
+
+//----------------------------------------------------------------------
+void FCanvas::init()
+{
+  unsetFocusable();
+  useParentWidgetColor();
+  resizePixels();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::draw()
+{
+  if ( draw_style != getDrawStyle() )  // The encoding has changed
+    resizePixels();
+
+  writeCells();
+}
+
+//----------------------------------------------------------------------
+void FCanvas::resizePixels()
+{
+  // Allocates a cleared pixel buffer for the cell size and style
+
+  draw_style = getDrawStyle();
+  pixel_width = getWidth() * getSubColumns();
+  pixel_height = getHeight() * getSubRows();
+  pixels.assign(pixel_width * pixel_height, getBackgroundColor());
+}
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getCell (std::size_t x, std::size_t y) const -> FCell
+{
+  // Chooses the character and its two colors for the cell (x, y)
+
+  if ( draw_style == CanvasStyle::Braille )
+    return getBrailleCell(x, y);
+
+  if ( draw_style == CanvasStyle::HalfBlock )
+  {
+    const auto* upper = &pixels[2 * y * pixel_width + x];
+    const auto top = upper[0];
+    const auto bottom = upper[pixel_width];
+
+    if ( top == bottom )
+      return {L' ', top, top};
+
+    return {wchar_t(UniChar::UpperHalfBlock), top, bottom};  // ▀
+  }
+
+  // Quadrant: the upper left pixel sets the foreground color and
+  // the first pixel with another color sets the background color.
+  // Pixels with a third color are shown in the background color.
+  const auto* upper = &pixels[2 * y * pixel_width + 2 * x];
+  const auto* lower = upper + pixel_width;
+  const std::array<FColor, 4> quad{{upper[0], upper[1], lower[0], lower[1]}};
+  const auto fg = quad[0];
+  auto bg = fg;
+  uInt mask{1};
+
+  for (uInt i{1}; i < 4; i++)
+  {
+    if ( quad[i] == fg )
+      mask |= 1U << i;
+    else if ( bg == fg )
+      bg = quad[i];
+  }
+
+  if ( mask == 0xf )
+    return {L' ', fg, fg};
+
+  return {quadrant_chars[mask], fg, bg};
+}
+
+//----------------------------------------------------------------------
+auto FCanvas::getBrailleCell (std::size_t x, std::size_t y) const -> FCell
+{
+  // Pixels with a color other than the background color are dots.
+  // The last dot sets the foreground color.
+
+  static constexpr std::array<std::array<uInt8, 2>, 4> dot_bit
+  {{
+    {{0x01, 0x08}},
+    {{0x02, 0x10}},
+    {{0x04, 0x20}},
+    {{0x40, 0x80}}
+  }};
+
+  const auto bg = getBackgroundColor();
+  const auto* line = &pixels[4 * y * pixel_width + 2 * x];
+  auto fg = bg;
+  uInt8 dots{0};
+
+  for (std::size_t row{0}; row < 4; row++)
+  {
+    for (std::size_t column{0}; column < 2; column++)
+    {
+      const auto color = line[column];
+
+      if ( color != bg )
+      {
+        dots |= dot_bit[row][column];
+        fg = color;
+      }
+    }
+
+    line += pixel_width;
+  }
+
+  if ( dots == 0 )
+    return {L' ', bg, bg};
+
+  return {wchar_t(0x2800 + dots), fg, bg};
+}
+
+//----------------------------------------------------------------------
+void FCanvas::writeCells()
+{
+  // Writes the cells directly into the print area. Each band of
+  // lines has its own line change records, so the bands can be
+  // converted in parallel.
+
+  auto* area = getPrintArea();
+
+  if ( ! area || pixels.empty() )
+    return;
+
+  setPrintPos (FPoint{1, 1});  // Maps the widget origin into the area
+  const int ax = area->cursor.x - 1;
+  const int ay = area->cursor.y - 1;
+  const auto height = std::size_t(std::max(0, std::min ( int(getHeight())
+                                                       , area->size.height - ay )));
+
+  if ( ax < 0 || ay < 0 || ax >= area->size.width )
+    return;
+
+  const auto write_lines = [this, area, ax, ay] (std::size_t first, std::size_t last)
+  {
+    for (auto row = first; row < last; row++)
+      writeLine (area, ax, ay, row);
+  };
+
+  if ( auto pool = FWorkerPool::getSharedPool() )
+    pool->parallelFor (0, height, canvas_rows_per_band, write_lines);
+  else
+    write_lines (0, height);  // Serial fallback
+
+  area->has_changes = true;
+}
+
+//----------------------------------------------------------------------
+void FCanvas::writeLine (FTermArea* area, int ax, int ay, std::size_t row)
+{
+  const auto width = std::min ( getWidth()
+                              , std::size_t(area->size.width - ax) );
+  const int y = ay + int(row);
+  auto& line_changes = area->changes[unsigned(y)];
+  auto* ac = &area->getFChar(ax, y);
+  FChar nc{};
+  nc.ch[1] = L'\0';
+  nc.attr.bit.char_width = 1;
+  std::size_t first{width};
+  std::size_t last{0};
+
+  for (std::size_t x{0}; x < width; x++)
+  {
+    const auto cell = getCell(x, row);
+    nc.ch[0] = cell.ch;
+    nc.fg_color = cell.fg;
+    nc.bg_color = cell.bg;
+
+    if ( ac[x] == nc )
+      continue;
+
+    if ( ac[x].attr.bit.transparent
+      || ac[x].attr.bit.color_overlay
+      || ac[x].attr.bit.inherit_background )
+      line_changes.trans_count--;
+
+    ac[x] = nc;
+    first = std::min(first, x);
+    last = x;
+  }
+
+  if ( first <= last && first < width )
+    line_changes.add (uInt(ax) + uInt(first), uInt(ax) + uInt(last));
+}
+
+}  // namespace finalcut
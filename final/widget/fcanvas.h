@@ -0,0 +1,178 @@
+/***********************************************************************
+* fcanvas.h - Widget FCanvas (a pixel buffer shown with block cells)   *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▏
+ * ▕ FVTerm  ▏ ▕ FObject ▏
+ * ▕▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▏
+ *      ▲           ▲
+ *      │           │
+ *      └─────┬─────┘
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FWidget ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏*     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FCanvas ▏- - - -▕ FWorkerPool ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FCANVAS_H
+#define FCANVAS_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <functional>
+#include <vector>
+
+#include "final/fwidget.h"
+
+namespace finalcut
+{
+
+// class forward declaration
+class FRect;
+
+//----------------------------------------------------------------------
+// class FCanvas
+//----------------------------------------------------------------------
+
+// The canvas stores one color index per pixel. Depending on the
+// canvas style, one character cell shows 1×2, 2×2 or 2×4 pixels.
+// update() converts the pixels to cells and writes them directly into
+// the print area, without the character conversion of print().
+// RGB values can be converted with rgb2ColorIndex().
+
+class FCanvas : public FWidget
+{
+  public:
+    // Using-declarations
+    using FWidget::setGeometry;
+    using FRenderTask = std::function<void(const FRect&)>;
+
+    // Constructor
+    explicit FCanvas (FWidget* = nullptr);
+
+    // Destructor
+    ~FCanvas() noexcept override;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getCanvasStyle() const noexcept -> CanvasStyle;
+    auto getPixelWidth() const noexcept -> std::size_t;
+    auto getPixelHeight() const noexcept -> std::size_t;
+    auto getPixel (std::size_t, std::size_t) const -> FColor;
+    auto getPixelLine (std::size_t) -> FColor*;
+
+    // Mutators
+    void setSize (const FSize&, bool = true) override;
+    void setGeometry (const FPoint&, const FSize&, bool = true) override;
+    void setCanvasStyle (CanvasStyle);
+    void setPixel (std::size_t, std::size_t, FColor);
+
+    // Methods
+    void fill (FColor);
+    void clear();
+    void render (const FRenderTask&);
+    void update();
+
+  private:
+    struct FCell
+    {
+      wchar_t  ch;
+      FColor   fg;
+      FColor   bg;
+    };
+
+    // Accessors
+    auto getDrawStyle() const -> CanvasStyle;
+    auto getSubColumns() const -> std::size_t;
+    auto getSubRows() const -> std::size_t;
+
+    // Methods
+    void init();
+    void draw() override;
+    void resizePixels();
+    auto getCell (std::size_t, std::size_t) const -> FCell;
+    auto getBrailleCell (std::size_t, std::size_t) const -> FCell;
+    void writeCells();
+    void writeLine (FTermArea*, int, int, std::size_t);
+
+    // Data members
+    std::vector<FColor>  pixels{};
+    std::size_t          pixel_width{0};
+    std::size_t          pixel_height{0};
+    CanvasStyle          canvas_style{CanvasStyle::HalfBlock};
+    CanvasStyle          draw_style{CanvasStyle::HalfBlock};
+};
+
+// FCanvas inline functions
+//----------------------------------------------------------------------
+inline auto FCanvas::getClassName() const -> FString
+{ return "FCanvas"; }
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getCanvasStyle() const noexcept -> CanvasStyle
+{ return canvas_style; }
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getPixelWidth() const noexcept -> std::size_t
+{ return pixel_width; }
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getPixelHeight() const noexcept -> std::size_t
+{ return pixel_height; }
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getPixel (std::size_t x, std::size_t y) const -> FColor
+{
+  if ( x >= pixel_width || y >= pixel_height )
+    return FColor::Default;
+
+  return pixels[y * pixel_width + x];
+}
+
+//----------------------------------------------------------------------
+inline auto FCanvas::getPixelLine (std::size_t y) -> FColor*
+{
+  if ( y >= pixel_height )
+    return nullptr;
+
+  return &pixels[y * pixel_width];
+}
+
+//----------------------------------------------------------------------
+inline void FCanvas::setPixel (std::size_t x, std::size_t y, FColor color)
+{
+  if ( x < pixel_width && y < pixel_height )
+    pixels[y * pixel_width + x] = color;
+}
+
+}  // namespace finalcut
+
+#endif  // FCANVAS_H
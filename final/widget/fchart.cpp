@@ -0,0 +1,625 @@
+/***********************************************************************
+* fchart.cpp - Widget FChart (a streaming line chart)                  *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "final/fc.h"
+#include "final/fevent.h"
+#include "final/vterm/fcolorpair.h"
+#include "final/widget/fchart.h"
+
+namespace finalcut
+{
+
+// Constants
+constexpr wchar_t braille_blank = 0x2800;  // Braille pattern without dots
+
+// Function prototype
+auto getBrailleDot (std::size_t, std::size_t) -> uInt8;
+
+// Function
+//----------------------------------------------------------------------
+inline auto getBrailleDot (std::size_t column, std::size_t row) -> uInt8
+{
+  // Returns the bit of a dot in the 2×4 Braille pattern
+  //
+  //   0 3
+  //   1 4
+  //   2 5
+  //   6 7
+
+  if ( row < 3 )
+    return uInt8(1U << (column * 3 + row));
+
+  return uInt8(1U << (6 + column));
+}
+
+
+//----------------------------------------------------------------------
+// class FChart
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FChart::FChart (FWidget* parent)
+  : FWidget{parent}
+{
+  init();
+}
+
+//----------------------------------------------------------------------
+FChart::~FChart() noexcept = default;  // destructor
+
+
+// public methods of FChart
+//----------------------------------------------------------------------
+auto FChart::getSampleCount (std::size_t series) const -> std::size_t
+{
+  if ( series >= series_list.size() )
+    return 0;
+
+  return series_list[series].count;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getSample (std::size_t series, std::size_t index) const -> double
+{
+  // Returns a stored sample (index 0 is the oldest sample)
+
+  if ( index >= getSampleCount(series) )
+    return 0.0;
+
+  const auto& s = series_list[series];
+  return s.samples[(s.total - s.count + index) % capacity];
+}
+
+//----------------------------------------------------------------------
+void FChart::setSize (const FSize& size, bool adjust)
+{
+  FWidget::setSize (size, adjust);
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::setGeometry ( const FPoint& pos, const FSize& size
+                         , bool adjust )
+{
+  FWidget::setGeometry (pos, size, adjust);
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::resetColors()
+{
+  useParentWidgetColor();
+  markChanged(0);
+}
+
+//----------------------------------------------------------------------
+void FChart::setChartStyle (ChartStyle style)
+{
+  if ( chart_style == style )
+    return;
+
+  chart_style = style;
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::setCapacity (std::size_t size)
+{
+  // Sets the number of stored samples per series
+
+  capacity = std::max(size, std::size_t(1));
+
+  for (auto& series : series_list)
+    resizeSeries (series);
+
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::setRange (double min, double max)
+{
+  // Sets a fixed value range
+
+  if ( min > max )
+    std::swap (min, max);
+
+  if ( min == max )
+    max = min + 1.0;
+
+  minimum = min;
+  maximum = max;
+  auto_range = false;
+  markChanged(0);
+}
+
+//----------------------------------------------------------------------
+void FChart::setAutoRange (bool enable)
+{
+  // The value range follows the shown samples
+
+  auto_range = enable;
+  markChanged(0);
+}
+
+//----------------------------------------------------------------------
+void FChart::setSeriesColor (std::size_t series, FColor color)
+{
+  if ( series >= series_list.size() )
+    return;
+
+  series_list[series].color = color;
+  markChanged(0);
+}
+
+//----------------------------------------------------------------------
+void FChart::hide()
+{
+  FWidget::hide();
+  hideArea (getSize());
+  stopFrameTimer();
+}
+
+//----------------------------------------------------------------------
+auto FChart::addSeries (FColor color) -> std::size_t
+{
+  // Adds a data series and returns its number
+
+  series_list.emplace_back();
+  auto& series = series_list.back();
+  series.color = color;
+  resizeSeries (series);
+  series.buckets.assign(getBucketCount(), {0.0, 0.0, NOT_SET});
+  return series_list.size() - 1;
+}
+
+//----------------------------------------------------------------------
+void FChart::append (std::size_t number, double value)
+{
+  // Appends a sample to a series in O(1)
+
+  if ( number >= series_list.size() )
+    return;
+
+  auto& series = series_list[number];
+  const auto old_end = getWindowEnd(series);
+  const auto old_oldest = getOldestBucket(series);
+  series.samples[series.total % capacity] = value;
+  series.total++;
+
+  if ( series.count < capacity )
+    series.count++;
+
+  addToBucket (series, series.total - 1, value);
+
+  if ( getWidth() == 0 )
+    return;
+
+  if ( getWindowEnd(series) != old_end )
+  {
+    markChanged(0);  // The chart moves one column to the left
+    return;
+  }
+
+  markChanged(getWidth() - 1);
+
+  if ( getOldestBucket(series) == old_oldest )
+    return;
+
+  // The oldest bucket has lost its last sample
+  const auto start = sInt64(old_end) - sInt64(getBucketCount());
+
+  if ( sInt64(old_oldest) >= start )
+    markChanged(std::size_t(sInt64(old_oldest) - start) / getSubColumns());
+}
+
+//----------------------------------------------------------------------
+void FChart::clear()
+{
+  // Removes all samples
+
+  for (auto& series : series_list)
+  {
+    series.total = 0;
+    series.count = 0;
+  }
+
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::onTimer (FTimerEvent* ev)
+{
+  if ( ev->getTimerId() != update_timer )
+    return;
+
+  if ( first_changed_column != NOT_SET && isShown() )
+  {
+    if ( auto_range && updateRange() )
+      first_changed_column = 0;
+
+    drawColumns (first_changed_column);
+    first_changed_column = NOT_SET;
+  }
+
+  stopFrameTimer();
+}
+
+
+// private methods of FChart
+//----------------------------------------------------------------------
+auto FChart::getDrawStyle() const -> ChartStyle
+{
+  // Braille patterns are only available with UTF-8
+
+  if ( chart_style == ChartStyle::Braille
+    && FVTerm::getFOutput()->getEncoding() != Encoding::UTF8 )
+    return ChartStyle::HalfBlock;
+
+  return chart_style;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getSubColumns() const -> std::size_t
+{
+  return ( draw_style == ChartStyle::Braille ) ? 2 : 1;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getSubRows() const -> std::size_t
+{
+  return ( draw_style == ChartStyle::Braille ) ? 4 : 2;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getBucketCount() const -> std::size_t
+{
+  return std::max(getWidth(), std::size_t(1)) * getSubColumns();
+}
+
+//----------------------------------------------------------------------
+auto FChart::getWindowEnd (const FSeries& series) const -> std::size_t
+{
+  // Returns the bucket number behind the last shown bucket.
+  // The window moves by whole character columns, so that each
+  // column keeps its buckets until the chart moves.
+
+  const auto sub_columns = getSubColumns();
+
+  if ( series.total == 0 )
+    return sub_columns;
+
+  const auto current = (series.total - 1) / samples_per_bucket;
+  return current - current % sub_columns + sub_columns;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getOldestBucket (const FSeries& series) const -> std::size_t
+{
+  return (series.total - series.count) / samples_per_bucket;
+}
+
+//----------------------------------------------------------------------
+auto FChart::findBucket (const FSeries& series, sInt64 index) const -> const FBucket*
+{
+  if ( index < 0
+    || series.count == 0
+    || std::size_t(index) < getOldestBucket(series)
+    || std::size_t(index) > (series.total - 1) / samples_per_bucket )
+    return nullptr;
+
+  const auto& bucket = series.buckets[std::size_t(index) % series.buckets.size()];
+
+  if ( bucket.index != std::size_t(index) || bucket.min > bucket.max )
+    return nullptr;
+
+  return &bucket;
+}
+
+//----------------------------------------------------------------------
+auto FChart::getDotRow (double value) const -> std::size_t
+{
+  // Returns the dot row from the top for a value
+
+  const auto dot_rows = getHeight() * getSubRows();
+  const double range = maximum - minimum;
+
+  if ( dot_rows == 0 )
+    return 0;
+
+  double pos = ( range > 0.0 ) ? (maximum - value) / range : 0.5;
+  pos = std::max(0.0, std::min(1.0, pos));
+  return std::size_t(std::lround(pos * double(dot_rows - 1)));
+}
+
+//----------------------------------------------------------------------
+void FChart::init()
+{
+  unsetFocusable();
+  FChart::resetColors();
+  rebuildBuckets();
+}
+
+//----------------------------------------------------------------------
+void FChart::draw()
+{
+  // The whole chart is printed again
+
+  if ( draw_style != getDrawStyle() )  // The encoding has changed
+    rebuildBuckets();
+
+  const FChartCell unknown{L'\0', FColor::Default, FColor::Default};
+  drawn_cells.assign(getWidth() * getHeight(), unknown);
+
+  if ( auto_range )
+    updateRange();
+
+  drawColumns(0);
+  first_changed_column = NOT_SET;
+}
+
+//----------------------------------------------------------------------
+void FChart::resizeSeries (FSeries& series) const
+{
+  // Copies the newest samples into a ring buffer with the current capacity
+
+  std::vector<double> samples(capacity);
+  const auto old_capacity = series.samples.size();
+  const auto count = std::min(series.count, capacity);
+
+  for (auto n = series.total - count; n < series.total; n++)
+    samples[n % capacity] = series.samples[n % old_capacity];
+
+  series.samples.swap(samples);
+  series.count = count;
+}
+
+//----------------------------------------------------------------------
+void FChart::rebuildBuckets()
+{
+  // Decimates the stored samples to the new sub-column resolution.
+  // This is the only operation that depends on the capacity.
+
+  draw_style = getDrawStyle();
+  const auto bucket_count = getBucketCount();
+  samples_per_bucket = std::max ( std::size_t(1)
+                                , (capacity + bucket_count - 1) / bucket_count );
+
+  for (auto& series : series_list)
+  {
+    series.buckets.assign(bucket_count, {0.0, 0.0, NOT_SET});
+
+    for (auto n = series.total - series.count; n < series.total; n++)
+      addToBucket (series, n, series.samples[n % capacity]);
+  }
+
+  drawn_cells.clear();
+  markChanged(0);
+}
+
+//----------------------------------------------------------------------
+void FChart::addToBucket ( FSeries& series, std::size_t sample
+                         , double value ) const
+{
+  const auto index = sample / samples_per_bucket;
+  auto& bucket = series.buckets[index % series.buckets.size()];
+
+  if ( bucket.index != index )
+  {
+    bucket.min = std::numeric_limits<double>::infinity();
+    bucket.max = -std::numeric_limits<double>::infinity();
+    bucket.index = index;
+  }
+
+  if ( std::isnan(value) )  // Gap
+    return;
+
+  bucket.min = std::min(bucket.min, value);
+  bucket.max = std::max(bucket.max, value);
+}
+
+//----------------------------------------------------------------------
+void FChart::markChanged (std::size_t column)
+{
+  // The changed columns are drawn with the next frame
+
+  if ( first_changed_column == NOT_SET || column < first_changed_column )
+    first_changed_column = column;
+
+  if ( ! update_timer && isShown() )
+    update_timer = addTimer(FRAME_INTERVAL);
+}
+
+//----------------------------------------------------------------------
+void FChart::stopFrameTimer()
+{
+  if ( ! update_timer )
+    return;
+
+  delTimer (update_timer);
+  update_timer = 0;
+}
+
+//----------------------------------------------------------------------
+auto FChart::updateRange() -> bool
+{
+  // Determines the value range of the shown buckets.
+  // Returns true if the range has changed.
+
+  auto min = std::numeric_limits<double>::infinity();
+  auto max = -std::numeric_limits<double>::infinity();
+  const auto bucket_count = getBucketCount();
+
+  for (const auto& series : series_list)
+  {
+    const auto end = sInt64(getWindowEnd(series));
+
+    for (auto index = end - sInt64(bucket_count); index < end; index++)
+    {
+      if ( const auto* bucket = findBucket(series, index) )
+      {
+        min = std::min(min, bucket->min);
+        max = std::max(max, bucket->max);
+      }
+    }
+  }
+
+  if ( min > max )  // No samples
+  {
+    min = 0.0;
+    max = 1.0;
+  }
+  else if ( min == max )
+  {
+    min -= 1.0;
+    max += 1.0;
+  }
+
+  if ( min == minimum && max == maximum )
+    return false;
+
+  minimum = min;
+  maximum = max;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FChart::renderColumn (std::size_t column)
+{
+  // Renders the character cells of one column into column_cells
+
+  const auto height = getHeight();
+  const auto sub_columns = getSubColumns();
+  const auto sub_rows = getSubRows();
+  const bool braille = ( draw_style == ChartStyle::Braille );
+  const auto bg = getBackgroundColor();
+  std::vector<uInt8> dots(height, 0);
+  std::vector<FColor> upper(height, bg);
+  std::vector<FColor> lower(height, bg);
+
+  for (const auto& series : series_list)
+  {
+    const auto start = sInt64(getWindowEnd(series)) - sInt64(getBucketCount());
+
+    for (std::size_t sub{0}; sub < sub_columns; sub++)
+    {
+      const auto index = start + sInt64(column * sub_columns + sub);
+      const auto* bucket = findBucket(series, index);
+
+      if ( ! bucket )
+        continue;
+
+      auto low = bucket->min;
+      auto high = bucket->max;
+
+      // Connects the line to the previous bucket
+      if ( const auto* prev = findBucket(series, index - 1) )
+      {
+        low = std::min(low, prev->max);
+        high = std::max(high, prev->min);
+      }
+
+      const auto bottom = getDotRow(low);
+
+      for (auto dot = getDotRow(high); dot <= bottom; dot++)
+      {
+        const auto row = dot / sub_rows;
+        const auto sub_row = dot % sub_rows;
+
+        if ( braille )
+        {
+          dots[row] |= getBrailleDot(sub, sub_row);
+          upper[row] = series.color;
+        }
+        else
+        {
+          dots[row] |= uInt8(1U << sub_row);
+          ( sub_row == 0 ? upper[row] : lower[row] ) = series.color;
+        }
+      }
+    }
+  }
+
+  const auto fg = getForegroundColor();
+  column_cells.resize(height);
+
+  for (std::size_t row{0}; row < height; row++)
+  {
+    auto& cell = column_cells[row];
+    cell = {L' ', fg, bg};
+
+    if ( braille )
+    {
+      if ( dots[row] )
+        cell = {wchar_t(braille_blank + dots[row]), upper[row], bg};
+    }
+    else if ( dots[row] == 3 && upper[row] == lower[row] )
+      cell = {wchar_t(UniChar::FullBlock), upper[row], bg};  // █
+    else if ( dots[row] == 3 )
+      cell = {wchar_t(UniChar::UpperHalfBlock), upper[row], lower[row]};  // ▀
+    else if ( dots[row] == 1 )
+      cell = {wchar_t(UniChar::UpperHalfBlock), upper[row], bg};  // ▀
+    else if ( dots[row] == 2 )
+      cell = {wchar_t(UniChar::LowerHalfBlock), lower[row], bg};  // ▄
+  }
+}
+
+//----------------------------------------------------------------------
+void FChart::drawColumns (std::size_t first)
+{
+  // Prints only the cells that differ from the printed cells
+
+  const auto width = getWidth();
+  const auto height = getHeight();
+
+  if ( drawn_cells.size() != width * height )
+  {
+    const FChartCell unknown{L'\0', FColor::Default, FColor::Default};
+    drawn_cells.assign(width * height, unknown);
+    first = 0;
+  }
+
+  for (auto column = first; column < width; column++)
+  {
+    renderColumn (column);
+
+    for (std::size_t row{0}; row < height; row++)
+    {
+      const auto& cell = column_cells[row];
+      auto& drawn = drawn_cells[column * height + row];
+
+      if ( cell.ch == drawn.ch && cell.fg == drawn.fg && cell.bg == drawn.bg )
+        continue;
+
+      drawn = cell;
+      print() << FPoint{int(column) + 1, int(row) + 1}
+              << FColorPair{cell.fg, cell.bg} << cell.ch;
+    }
+  }
+}
+
+}  // namespace finalcut
@@ -0,0 +1,221 @@
+/***********************************************************************
+* fchart.h - Widget FChart (a streaming line chart)                    *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▏
+ * ▕ FVTerm  ▏ ▕ FObject ▏
+ * ▕▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▏
+ *      ▲           ▲
+ *      │           │
+ *      └─────┬─────┘
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FWidget ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FChart  ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FCHART_H
+#define FCHART_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <vector>
+
+#include "final/fwidget.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FChart
+//----------------------------------------------------------------------
+
+// The chart shows the last samples of each series from right to left.
+// Each series keeps its samples in a ring buffer with a fixed capacity
+// and their minimum and maximum per sub-column (decimation).
+// Appending a sample only updates the newest sub-column, so it does
+// not depend on the number of stored samples.
+
+class FChart : public FWidget
+{
+  public:
+    // Using-declaration
+    using FWidget::setGeometry;
+
+    // Constructor
+    explicit FChart (FWidget* = nullptr);
+
+    // Destructor
+    ~FChart() noexcept override;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getChartStyle() const noexcept -> ChartStyle;
+    auto getCapacity() const noexcept -> std::size_t;
+    auto getSeriesCount() const noexcept -> std::size_t;
+    auto getSampleCount (std::size_t) const -> std::size_t;
+    auto getSample (std::size_t, std::size_t) const -> double;
+    auto getSamplesPerColumn() const noexcept -> std::size_t;
+    auto getMinimum() const noexcept -> double;
+    auto getMaximum() const noexcept -> double;
+
+    // Mutators
+    void setSize (const FSize&, bool = true) override;
+    void setGeometry (const FPoint&, const FSize&, bool = true) override;
+    void resetColors() override;
+    void setChartStyle (ChartStyle);
+    void setCapacity (std::size_t);
+    void setRange (double, double);
+    void setAutoRange (bool = true);
+    void unsetAutoRange();
+    void setSeriesColor (std::size_t, FColor);
+
+    // Inquiry
+    auto hasAutoRange() const noexcept -> bool;
+
+    // Methods
+    void hide() override;
+    auto addSeries (FColor) -> std::size_t;
+    void append (std::size_t, double);
+    void clear();
+
+    // Event handler
+    void onTimer (FTimerEvent*) override;
+
+  private:
+    // Constants
+    static constexpr auto NOT_SET = static_cast<std::size_t>(-1);
+    static constexpr int FRAME_INTERVAL = 20;  // Chart update (ms)
+
+    struct FBucket
+    {
+      double      min;
+      double      max;
+      std::size_t index;  // Absolute bucket number
+    };
+
+    struct FSeries
+    {
+      std::vector<double>   samples{};  // Ring buffer
+      std::vector<FBucket>  buckets{};  // Ring buffer with the sub-columns
+      std::size_t           total{0};   // Number of appended samples
+      std::size_t           count{0};   // Number of stored samples
+      FColor                color{FColor::Default};
+    };
+
+    struct FChartCell
+    {
+      wchar_t  ch;
+      FColor   fg;
+      FColor   bg;
+    };
+
+    // Using-declarations
+    using FSeriesList = std::vector<FSeries>;
+    using FChartCells = std::vector<FChartCell>;
+
+    // Accessors
+    auto getDrawStyle() const -> ChartStyle;
+    auto getSubColumns() const -> std::size_t;
+    auto getSubRows() const -> std::size_t;
+    auto getBucketCount() const -> std::size_t;
+    auto getWindowEnd (const FSeries&) const -> std::size_t;
+    auto getOldestBucket (const FSeries&) const -> std::size_t;
+    auto findBucket (const FSeries&, sInt64) const -> const FBucket*;
+    auto getDotRow (double) const -> std::size_t;
+
+    // Methods
+    void init();
+    void draw() override;
+    void resizeSeries (FSeries&) const;
+    void rebuildBuckets();
+    void addToBucket (FSeries&, std::size_t, double) const;
+    void markChanged (std::size_t);
+    void stopFrameTimer();
+    auto updateRange() -> bool;
+    void renderColumn (std::size_t);
+    void drawColumns (std::size_t);
+
+    // Data members
+    FSeriesList  series_list{};
+    FChartCells  drawn_cells{};  // Printed cells, column by column
+    FChartCells  column_cells{};  // Rendered cells of one column
+    double       minimum{0.0};
+    double       maximum{1.0};
+    std::size_t  capacity{1024};
+    std::size_t  samples_per_bucket{1};
+    std::size_t  first_changed_column{NOT_SET};
+    int          update_timer{0};
+    ChartStyle   chart_style{ChartStyle::Braille};
+    ChartStyle   draw_style{ChartStyle::Braille};
+    bool         auto_range{true};
+};
+
+// FChart inline functions
+//----------------------------------------------------------------------
+inline auto FChart::getClassName() const -> FString
+{ return "FChart"; }
+
+//----------------------------------------------------------------------
+inline auto FChart::getChartStyle() const noexcept -> ChartStyle
+{ return chart_style; }
+
+//----------------------------------------------------------------------
+inline auto FChart::getCapacity() const noexcept -> std::size_t
+{ return capacity; }
+
+//----------------------------------------------------------------------
+inline auto FChart::getSeriesCount() const noexcept -> std::size_t
+{ return series_list.size(); }
+
+//----------------------------------------------------------------------
+inline auto FChart::getSamplesPerColumn() const noexcept -> std::size_t
+{ return samples_per_bucket; }
+
+//----------------------------------------------------------------------
+inline auto FChart::getMinimum() const noexcept -> double
+{ return minimum; }
+
+//----------------------------------------------------------------------
+inline auto FChart::getMaximum() const noexcept -> double
+{ return maximum; }
+
+//----------------------------------------------------------------------
+inline void FChart::unsetAutoRange()
+{ setAutoRange(false); }
+
+//----------------------------------------------------------------------
+inline auto FChart::hasAutoRange() const noexcept -> bool
+{ return auto_range; }
+
+}  // namespace finalcut
+
+#endif  // FCHART_H
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2019-2024 Markus Gans                                      *
+* Copyright 2019-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -158,7 +158,7 @@ auto FDropDownListBox::containsWidget (const FPoint& p) -> bool
   if ( getTermGeometry().contains(p) )
     return true;
 
-  if ( parent && parent->isInstanceOf("FComboBox") )
+  if ( parent && parent->isInstanceOf<FComboBox>() )
     return static_cast<FComboBox*>(parent)->getTermGeometry().contains(p);
 
   return false;
@@ -263,7 +263,7 @@ void FComboBox::remove (std::size_t item)
 {
   list_window.list.remove(item);
 
-  if ( ! list_window.isEmpty() )
+  if ( ! list_window.isEmpty() && list_window.list.currentItem() > 0 )
   {
     const std::size_t index = list_window.list.currentItem();
     input_field = list_window.list.getItem(index).getText();
@@ -315,6 +315,10 @@ void FComboBox::hideDropDown()
      return;
 
   list_window.hide();
+
+  if ( list_window.list.isFiltered() )
+    list_window.list.clearFilter();  // Shows all items next time
+
   input_field.setFocus();
   input_field.redraw();
 }
@@ -586,6 +590,10 @@ void FComboBox::cb_setInputField()
 {
   auto& list = list_window.list;
   const std::size_t index = list.currentItem();
+
+  if ( index == 0 )  // No visible item
+    return;
+
   input_field = list.getItem(index).getText();
   input_field.redraw();
   processRowChanged();
@@ -645,7 +653,7 @@ void closeOpenComboBox()
   if ( ! openmenu )
     return;
 
-  if ( openmenu->isInstanceOf("FDropDownListBox") )
+  if ( openmenu->isInstanceOf<FDropDownListBox>() )
   {
     auto drop_down = static_cast<FDropDownListBox*>(openmenu);
     drop_down->hide();
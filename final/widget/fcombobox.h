@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2019-2023 Markus Gans                                      *
+* Copyright 2019-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -158,6 +158,10 @@ class FComboBox : public FWidget
     void clearText();
     void setLabelText (const FString&);
     void setLabelOrientation (const LabelOrientation);
+    void setSearchIndex (bool = true);
+    void unsetSearchIndex();
+    void setTypeAheadFilter (bool = true);
+    void unsetTypeAheadFilter();
 
     // Inquiries
     auto hasShadow() const -> bool;
@@ -259,6 +263,22 @@ inline void FComboBox::unsetShadow()
 inline void FComboBox::unsetEditable()
 { setEditable(false); }
 
+//----------------------------------------------------------------------
+inline void FComboBox::setSearchIndex (bool enable)
+{ list_window.list.setSearchIndex(enable); }
+
+//----------------------------------------------------------------------
+inline void FComboBox::unsetSearchIndex()
+{ setSearchIndex(false); }
+
+//----------------------------------------------------------------------
+inline void FComboBox::setTypeAheadFilter (bool enable)
+{ list_window.list.setTypeAheadFilter(enable); }
+
+//----------------------------------------------------------------------
+inline void FComboBox::unsetTypeAheadFilter()
+{ setTypeAheadFilter(false); }
+
 //----------------------------------------------------------------------
 inline auto FComboBox::hasShadow() const -> bool
 { return getFlags().shadow.shadow; }
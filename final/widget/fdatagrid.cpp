@@ -0,0 +1,1459 @@
+/***********************************************************************
+* fdatagrid.cpp - Widget FDataGrid (a table with a row/column model)   *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cwchar>
+#include <cwctype>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#include "final/fc.h"
+#include "final/fevent.h"
+#include "final/fwidgetcolors.h"
+#include "final/util/fstring.h"
+#include "final/widget/fdatagrid.h"
+#include "final/widget/fscrollbar.h"
+
+namespace finalcut
+{
+
+// Constants
+constexpr auto not_visible = static_cast<std::size_t>(-1);
+constexpr std::size_t max_column_width = 40;  // Measured column width
+
+// Function prototypes
+auto getCellKey (std::size_t, std::size_t) -> uInt64;
+auto getLowerCaseText (const FString&) -> std::wstring;
+auto parseNumber (const FString&, double&) -> bool;
+
+// Function
+//----------------------------------------------------------------------
+inline auto getCellKey (std::size_t row, std::size_t column) -> uInt64
+{
+  return (uInt64(row) << 32) | uInt64(column & 0xffffffff);
+}
+
+//----------------------------------------------------------------------
+auto getLowerCaseText (const FString& text) -> std::wstring
+{
+  auto str = text.toWString();
+  std::transform ( str.begin(), str.end(), str.begin()
+                 , [] (wchar_t ch)
+                   {
+                     return wchar_t(std::towlower(wint_t(ch)));
+                   } );
+  return str;
+}
+
+//----------------------------------------------------------------------
+auto parseNumber (const FString& text, double& value) -> bool
+{
+  // Reads a decimal number like "-12.5" or "3e8" independent of the
+  // locale. Whitespace, hex numbers, "inf" and "nan" are not numbers.
+
+  const auto str = text.toWString();
+  std::string number{};
+  std::size_t digits{0};
+  std::size_t i{0};
+  const auto append_digits = [&str, &number, &i] ()
+  {
+    const auto begin = i;
+
+    while ( i < str.length() && str[i] >= L'0' && str[i] <= L'9' )
+    {
+      number.push_back(char(str[i]));
+      i++;
+    }
+
+    return i - begin;
+  };
+
+  if ( i < str.length() && (str[i] == L'+' || str[i] == L'-') )
+  {
+    number.push_back(char(str[i]));
+    i++;
+  }
+
+  digits += append_digits();
+
+  if ( i < str.length() && str[i] == L'.' )
+  {
+    number.push_back('.');
+    i++;
+    digits += append_digits();
+  }
+
+  if ( digits == 0 )
+    return false;
+
+  if ( i < str.length() && (str[i] == L'e' || str[i] == L'E') )
+  {
+    number.push_back('e');
+    i++;
+
+    if ( i < str.length() && (str[i] == L'+' || str[i] == L'-') )
+    {
+      number.push_back(char(str[i]));
+      i++;
+    }
+
+    if ( append_digits() == 0 )
+      return false;
+  }
+
+  if ( i != str.length() )
+    return false;
+
+  std::istringstream stream{number};
+  stream.imbue(std::locale::classic());
+  stream >> value;
+  return ! stream.fail() && std::isfinite(value);
+}
+
+
+//----------------------------------------------------------------------
+// class FDataGridModel
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FDataGridModel::~FDataGridModel() noexcept = default;
+
+// public methods of FDataGridModel
+//----------------------------------------------------------------------
+auto FDataGridModel::getClassName() const -> FString
+{
+  return "FDataGridModel";
+}
+
+//----------------------------------------------------------------------
+auto FDataGridModel::getColumnText (std::size_t) const -> FString
+{
+  return {};
+}
+
+//----------------------------------------------------------------------
+auto FDataGridModel::getColumnAlignment (std::size_t) const -> Align
+{
+  return Align::Left;
+}
+
+//----------------------------------------------------------------------
+auto FDataGridModel::isSortable (std::size_t) const -> bool
+{
+  return false;
+}
+
+//----------------------------------------------------------------------
+void FDataGridModel::sort (std::size_t, SortOrder)
+{
+  // A model that can be sorted reimplements this method
+}
+
+//----------------------------------------------------------------------
+void FDataGridModel::filter (const FString&)
+{
+  // A model that can be filtered reimplements this method
+}
+
+
+//----------------------------------------------------------------------
+// class FDataGridTable
+//----------------------------------------------------------------------
+
+// public methods of FDataGridTable
+//----------------------------------------------------------------------
+auto FDataGridTable::getData (std::size_t row, std::size_t column) const -> FString
+{
+  if ( row >= rows.size() )
+    return {};
+
+  const auto& line = data[rows[row]];
+  return ( column < line.size() ) ? line[column] : FString{};
+}
+
+//----------------------------------------------------------------------
+auto FDataGridTable::getColumnText (std::size_t column) const -> FString
+{
+  return ( column < columns.size() ) ? columns[column].text : FString{};
+}
+
+//----------------------------------------------------------------------
+auto FDataGridTable::getColumnAlignment (std::size_t column) const -> Align
+{
+  return ( column < columns.size() ) ? columns[column].alignment : Align::Left;
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::setData ( std::size_t row, std::size_t column
+                             , const FString& text )
+{
+  // The row keeps its position until the next sort() or filter()
+
+  if ( row >= rows.size() || column >= columns.size() )
+    return;
+
+  auto& line = data[rows[row]];
+
+  if ( column >= line.size() )
+    line.resize(columns.size());
+
+  line[column] = text;
+
+  if ( column == sort_column && rows[row] < sort_keys.size() )
+    sort_keys[rows[row]] = getSortKey(text);
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::addColumn (const FString& text, Align alignment)
+{
+  columns.push_back({text, alignment});
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::addRow (const FStringList& line)
+{
+  data.push_back(line);
+  const auto index = data.size() - 1;
+
+  if ( ! isMatching(index) )
+    return;
+
+  if ( sort_order == SortOrder::Unsorted )
+  {
+    rows.push_back(index);
+    return;
+  }
+
+  // Inserts the row at its sorted position
+  sort_keys.resize(data.size());
+  sort_keys[index] = getSortKey(getSortCell(index));
+  const auto iter = std::upper_bound ( rows.cbegin(), rows.cend(), index
+                                     , [this] (std::size_t lhs, std::size_t rhs)
+                                       {
+                                         return isLess(lhs, rhs);
+                                       } );
+  rows.insert (iter, index);
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::clear()
+{
+  // Removes all rows
+
+  data.clear();
+  rows.clear();
+  sort_keys.clear();
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::sort (std::size_t column, SortOrder order)
+{
+  sort_column = column;
+  sort_order = order;
+  updateRows();
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::filter (const FString& text)
+{
+  filter_key = getLowerCaseText(text);
+  updateRows();
+}
+
+
+// private methods of FDataGridTable
+//----------------------------------------------------------------------
+auto FDataGridTable::getSortCell (std::size_t index) const -> const FString&
+{
+  static const FString empty{};
+  const auto& line = data[index];
+  return ( sort_column < line.size() ) ? line[sort_column] : empty;
+}
+
+//----------------------------------------------------------------------
+auto FDataGridTable::getSortKey (const FString& text) -> SortKey
+{
+  SortKey key{};
+  key.is_number = parseNumber(text, key.value);
+  return key;
+}
+
+//----------------------------------------------------------------------
+auto FDataGridTable::isMatching (std::size_t index) const -> bool
+{
+  // A row matches if one of its cells contains the filter text
+
+  if ( filter_key.empty() )
+    return true;
+
+  const auto& line = data[index];
+
+  return std::any_of ( line.cbegin(), line.cend()
+                     , [this] (const FString& cell)
+                       {
+                         return getLowerCaseText(cell).find(filter_key)
+                             != std::wstring::npos;
+                       } );
+}
+
+//----------------------------------------------------------------------
+auto FDataGridTable::isLess (std::size_t lhs, std::size_t rhs) const -> bool
+{
+  // All numbers come before all texts. Numbers are compared
+  // by value and texts by their character codes.
+
+  const auto& lhs_key = sort_keys[lhs];
+  const auto& rhs_key = sort_keys[rhs];
+  int result{};
+
+  if ( lhs_key.is_number != rhs_key.is_number )
+    result = lhs_key.is_number ? -1 : 1;
+  else if ( lhs_key.is_number )
+    result = int(lhs_key.value > rhs_key.value) - int(lhs_key.value < rhs_key.value);
+  else
+    result = std::wcscmp(getSortCell(lhs).wc_str(), getSortCell(rhs).wc_str());
+
+  return ( sort_order == SortOrder::Descending ) ? result > 0 : result < 0;
+}
+
+//----------------------------------------------------------------------
+void FDataGridTable::updateRows()
+{
+  rows.clear();
+  sort_keys.clear();
+
+  for (std::size_t index{0}; index < data.size(); index++)
+    if ( isMatching(index) )
+      rows.push_back(index);
+
+  if ( sort_order == SortOrder::Unsorted )
+    return;
+
+  // Every cell of the sort column is classified only once
+  sort_keys.resize(data.size());
+
+  for (const auto index : rows)
+    sort_keys[index] = getSortKey(getSortCell(index));
+
+  std::stable_sort ( rows.begin(), rows.end()
+                   , [this] (std::size_t lhs, std::size_t rhs)
+                     {
+                       return isLess(lhs, rhs);
+                     } );
+}
+
+
+//----------------------------------------------------------------------
+// class FDataGrid
+//----------------------------------------------------------------------
+
+// constructor and destructor
+//----------------------------------------------------------------------
+FDataGrid::FDataGrid (FWidget* parent)
+  : FWidget{parent}
+{
+  init();
+}
+
+//----------------------------------------------------------------------
+FDataGrid::~FDataGrid() noexcept = default;  // destructor
+
+
+// public methods of FDataGrid
+//----------------------------------------------------------------------
+auto FDataGrid::getColumnWidth (std::size_t column) -> std::size_t
+{
+  // The width of a column is measured when it is first shown
+
+  if ( column >= column_widths.size() )
+    return 0;
+
+  if ( column_widths[column] == 0 )
+    column_widths[column] = measureColumn(column);
+
+  return column_widths[column];
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setSize (const FSize& size, bool adjust)
+{
+  FWidget::setSize (size, adjust);
+  changeOnResize();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setGeometry ( const FPoint& pos, const FSize& size
+                            , bool adjust )
+{
+  FWidget::setGeometry (pos, size, adjust);
+  changeOnResize();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::resetColors()
+{
+  const auto& wc = getColorTheme();
+  FWidget::setForegroundColor (wc->list.fg);
+  FWidget::setBackgroundColor (wc->list.bg);
+  FWidget::resetColors();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setModel (FDataGridModel* data_model)
+{
+  model = data_model;
+  current_row = 0;
+  current_column = 0;
+  xoffset = 0;
+  yoffset = 0;
+  sort_column = 0;
+  sort_order = SortOrder::Unsorted;
+  resetColumnWidths();
+  updateData();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setColumnWidth (std::size_t column, std::size_t width)
+{
+  // Sets a fixed column width instead of the measured width
+
+  if ( column >= column_widths.size() )
+    return;
+
+  column_widths[column] = std::max(width, std::size_t(1));
+
+  if ( isShown() )
+    redraw();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setFrozenRows (std::size_t rows)
+{
+  // The first rows stay visible when scrolling vertically
+
+  frozen_rows = rows;
+  yoffset = 0;
+  updateData();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setFrozenColumns (std::size_t columns)
+{
+  // The first columns stay visible when scrolling horizontally
+
+  frozen_columns = columns;
+  xoffset = 0;
+  updateData();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setCurrentCell (std::size_t row, std::size_t column)
+{
+  const auto rows = getRowCount();
+  const auto columns = getColumnCount();
+
+  if ( rows == 0 || columns == 0 )
+    return;
+
+  row = std::min(row, rows - 1);
+  column = std::min(column, columns - 1);
+
+  if ( row == current_row && column == current_column )
+    return;
+
+  const auto old_row = current_row;
+  const auto old_pos = getScrollPos();
+  current_row = row;
+  current_column = column;
+  scrollToCurrentCell();
+
+  if ( isShown() && getScrollPos() == old_pos )
+  {
+    // Only the highlighting has changed
+    drawRow (old_row);
+    drawRow (current_row);
+  }
+
+  if ( old_row != current_row )
+    processRowChanged();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setFilterText (const FString& text)
+{
+  if ( ! model )
+    return;
+
+  model->filter(text);
+  current_row = 0;
+  yoffset = 0;
+  updateData();
+  processRowChanged();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::hide()
+{
+  FWidget::hide();
+  hideArea (getSize());
+  dirty_cells.clear();
+  updateFrameTimer();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::sortByColumn (std::size_t column, SortOrder order)
+{
+  if ( ! model || ! model->isSortable(column) )
+    return;
+
+  sort_column = column;
+  sort_order = order;
+  model->sort(column, order);
+  updateData();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::updateCell (std::size_t row, std::size_t column)
+{
+  // Marks a changed cell. Only visible cells are drawn again.
+
+  if ( ! isShown()
+    || getRowLine(row) == not_visible
+    || ! findVisibleColumn(column) )
+    return;
+
+  dirty_cells.insert (getCellKey(row, column));
+  updateFrameTimer();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::updateRow (std::size_t row)
+{
+  for (const auto& visible_column : visible_columns)
+    updateCell (row, visible_column.column);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::updateData()
+{
+  // Takes over a changed number of rows or columns
+
+  const auto columns = getColumnCount();
+
+  if ( column_widths.size() != columns )
+    column_widths.resize(columns, 0);
+
+  dirty_cells.clear();
+  clampPositions();
+
+  if ( isShown() )
+    redraw();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::scrollTo (int x, int y)
+{
+  x = std::max(0, std::min(x, getMaxXOffset()));
+  y = std::max(0, std::min(y, getMaxYOffset()));
+  const bool changeX( x != xoffset );
+  const bool changeY( y != yoffset );
+
+  if ( ! (changeX || changeY) )
+    return;
+
+  xoffset = x;
+  yoffset = y;
+
+  if ( ! isShown() )
+    return;
+
+  if ( update_scrollbar && changeX )
+  {
+    hbar->setValue(xoffset);
+    hbar->drawBar();
+  }
+
+  if ( update_scrollbar && changeY )
+  {
+    vbar->setValue(yoffset);
+    vbar->drawBar();
+  }
+
+  drawCells();
+
+  if ( changeX )
+    drawHeader();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::onKeyPress (FKeyEvent* ev)
+{
+  const auto& iter = key_map.find(ev->key());
+
+  if ( iter != key_map.end() )
+  {
+    iter->second();
+    ev->accept();
+  }
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::onMouseDown (FMouseEvent* ev)
+{
+  if ( ev->getButton() != MouseButton::Left )
+    return;
+
+  setWidgetFocus(this);
+  const auto& mouse_pos = ev->getPos();
+  const auto* visible_column = findColumnAt(mouse_pos.getX());
+
+  if ( ! visible_column )
+    return;
+
+  const auto column = visible_column->column;
+
+  if ( mouse_pos.getY() == 1 )  // Click on the column header
+  {
+    const bool descending = column == sort_column
+                         && sort_order == SortOrder::Ascending;
+    sortByColumn ( column
+                 , descending ? SortOrder::Descending : SortOrder::Ascending );
+    return;
+  }
+
+  const int line = mouse_pos.getY() - 2 + nf_offset;
+
+  if ( line < 0 || line >= int(getTextHeight()) )
+    return;
+
+  const auto row = getLineRow(std::size_t(line));
+
+  if ( row != not_visible )
+    setCurrentCell (row, column);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::onMouseDoubleClick (FMouseEvent* ev)
+{
+  if ( ev->getButton() != MouseButton::Left )
+    return;
+
+  const int line = ev->getY() - 2 + nf_offset;
+
+  if ( line >= 0 && line < int(getTextHeight())
+    && getLineRow(std::size_t(line)) == current_row
+    && findColumnAt(ev->getX()) )
+    processClick();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::onWheel (FWheelEvent* ev)
+{
+  static constexpr int distance = 4;
+  const auto& wheel = ev->getWheel();
+
+  if ( wheel == MouseWheel::Up )
+    scrollBy (0, -distance);
+  else if ( wheel == MouseWheel::Down )
+    scrollBy (0, distance);
+  else if ( wheel == MouseWheel::Left )
+    scrollBy (-1, 0);
+  else if ( wheel == MouseWheel::Right )
+    scrollBy (1, 0);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::onTimer (FTimerEvent* ev)
+{
+  if ( ev->getTimerId() != update_timer )
+    return;
+
+  drawDirtyCells();
+  updateFrameTimer();  // Stops the timer
+}
+
+
+// protected methods of FDataGrid
+//----------------------------------------------------------------------
+void FDataGrid::initLayout()
+{
+  nf_offset = FVTerm::getFOutput()->isNewFont() ? 1 : 0;
+  setTopPadding(1);
+  setLeftPadding(1);
+  setBottomPadding(1);
+  setRightPadding(1 + nf_offset);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::adjustSize()
+{
+  FWidget::adjustSize();
+  changeOnResize();
+  clampPositions();
+  layoutColumns();
+  updateScrollbars();
+}
+
+
+// private methods of FDataGrid
+//----------------------------------------------------------------------
+inline auto FDataGrid::getTextHeight() const -> std::size_t
+{
+  return getHeight() - 2 + std::size_t(nf_offset);
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getTextWidth() const -> std::size_t
+{
+  return getWidth() - 2 - std::size_t(nf_offset);
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getVisibleFrozenRows() const -> std::size_t
+{
+  return std::min({frozen_rows, getRowCount(), getTextHeight()});
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getScrollableRows() const -> std::size_t
+{
+  return getRowCount() - std::min(frozen_rows, getRowCount());
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getScrollableColumns() const -> std::size_t
+{
+  return getColumnCount() - std::min(frozen_columns, getColumnCount());
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getMaxXOffset() const -> int
+{
+  return std::max(0, int(getScrollableColumns()) - 1);
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getMaxYOffset() const -> int
+{
+  const auto page = int(getTextHeight() - getVisibleFrozenRows());
+  return std::max(0, int(getScrollableRows()) - page);
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::getLineRow (std::size_t line) const -> std::size_t
+{
+  // Returns the row that is shown in the given text line
+
+  const auto visible_frozen_rows = getVisibleFrozenRows();
+
+  if ( line < visible_frozen_rows )
+    return line;
+
+  const auto rows = getRowCount();
+  const auto row = std::min(frozen_rows, rows) + std::size_t(yoffset)
+                 + line - visible_frozen_rows;
+  return ( row < rows ) ? row : not_visible;
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::getRowLine (std::size_t row) const -> std::size_t
+{
+  // Returns the text line of a row or not_visible
+
+  const auto rows = getRowCount();
+
+  if ( row >= rows )
+    return not_visible;
+
+  const auto visible_frozen_rows = getVisibleFrozenRows();
+  const auto first_row = std::min(frozen_rows, rows);
+
+  if ( row < first_row )
+    return ( row < visible_frozen_rows ) ? row : not_visible;
+
+  if ( row < first_row + std::size_t(yoffset) )
+    return not_visible;
+
+  const auto line = visible_frozen_rows + row - first_row - std::size_t(yoffset);
+  return ( line < getTextHeight() ) ? line : not_visible;
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::findVisibleColumn (std::size_t column) const -> const FVisibleColumn*
+{
+  const auto iter = std::find_if ( visible_columns.cbegin()
+                                 , visible_columns.cend()
+                                 , [column] (const FVisibleColumn& visible)
+                                   {
+                                     return visible.column == column;
+                                   } );
+  return ( iter != visible_columns.cend() ) ? &*iter : nullptr;
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::findColumnAt (int x) const -> const FVisibleColumn*
+{
+  const auto iter = std::find_if ( visible_columns.cbegin()
+                                 , visible_columns.cend()
+                                 , [x] (const FVisibleColumn& visible)
+                                   {
+                                     return x >= visible.x
+                                         && x <= visible.x + int(visible.width);
+                                   } );
+  return ( iter != visible_columns.cend() ) ? &*iter : nullptr;
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::isHorizontallyScrollable() const -> bool
+{
+  if ( xoffset > 0 )
+    return true;
+
+  if ( visible_columns.empty() )
+    return false;
+
+  const auto& last = visible_columns.back();
+  return last.column + 1 < getColumnCount()
+      || last.width < column_widths[last.column];
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::isVerticallyScrollable() const -> bool
+{
+  return getMaxYOffset() > 0;
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::init()
+{
+  initScrollbar (vbar, Orientation::Vertical, this, &FDataGrid::cb_vbarChange);
+  initScrollbar (hbar, Orientation::Horizontal, this, &FDataGrid::cb_hbarChange);
+  setMinimumSize (FSize{5, 4});
+  FDataGrid::resetColors();
+  mapKeyFunctions();
+}
+
+//----------------------------------------------------------------------
+inline void FDataGrid::mapKeyFunctions()
+{
+  key_map =
+  {
+    { FKey::Up        , [this] { moveCurrentCell (0, -1); } },
+    { FKey::Down      , [this] { moveCurrentCell (0, 1); } },
+    { FKey::Left      , [this] { moveCurrentCell (-1, 0); } },
+    { FKey::Right     , [this] { moveCurrentCell (1, 0); } },
+    { FKey::Page_up   , [this] { moveCurrentCell (0, -int(getTextHeight())); } },
+    { FKey::Page_down , [this] { moveCurrentCell (0, int(getTextHeight())); } },
+    { FKey::Home      , [this] { setCurrentCell (0, current_column); } },
+    { FKey::End       , [this] { setCurrentCell (getRowCount(), current_column); } },
+    { FKey::Return    , [this] { processClick(); } },
+    { FKey::Enter     , [this] { processClick(); } }
+  };
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::draw()
+{
+  layoutColumns();
+  updateScrollbars();
+  setColor();
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    setReverse(true);
+
+  drawBorder();
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    setReverse(false);
+
+  drawScrollbars();
+  drawCells();
+  drawHeader();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawBorder()
+{
+  const FRect box{FPoint{1, 1}, getSize()};
+  finalcut::drawListBorder (this, box);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawScrollbars() const
+{
+  if ( ! hbar->isShown() && isHorizontallyScrollable() )
+    hbar->show();
+  else
+    hbar->redraw();
+
+  if ( ! vbar->isShown() && isVerticallyScrollable() )
+    vbar->show();
+  else
+    vbar->redraw();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawHeader()
+{
+  // Prints the column titles into the top border
+
+  if ( ! model || getHeight() <= 2 || getWidth() <= 4 )
+    return;
+
+  const auto& wc = getColorTheme();
+  const auto text_end = 2 + int(getTextWidth());
+  int x{2};
+  print() << FPoint{2, 1};
+
+  for (const auto& visible_column : visible_columns)
+  {
+    const auto column = visible_column.column;
+    const bool has_sort_indicator = sort_order != SortOrder::Unsorted
+                                 && column == sort_column;
+    const auto max_width = visible_column.width
+                         - std::size_t(has_sort_indicator && visible_column.width > 1);
+    const auto title = getColumnSubString(model->getColumnText(column), 1, max_width);
+    auto length = finalcut::getColumnWidth(title);
+    setColor();
+    print (' ');
+
+    if ( isEnabled() )
+      setColor (wc->label.emphasis_fg, wc->label.bg);
+    else
+      setColor (wc->label.inactive_fg, wc->label.inactive_bg);
+
+    print (title);
+    setColor();
+
+    if ( has_sort_indicator && length < visible_column.width )
+    {
+      if ( sort_order == SortOrder::Ascending )
+        print (UniChar::BlackUpPointingTriangle);    // ▲
+      else
+        print (UniChar::BlackDownPointingTriangle);  // ▼
+
+      length++;
+    }
+
+    if ( length < visible_column.width )
+    {
+      print (' ');  // trailing space
+      length++;
+    }
+
+    print (FString{visible_column.width - length, UniChar::BoxDrawingsHorizontal});
+    x += 1 + int(visible_column.width);
+  }
+
+  if ( x < text_end )
+    print (FString{std::size_t(text_end - x), UniChar::BoxDrawingsHorizontal});
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawCells()
+{
+  if ( getHeight() <= 2 || getWidth() <= 2 )
+    return;
+
+  layoutColumns();
+  dirty_cells.clear();  // All cells are drawn
+
+  for (std::size_t line{0}; line < getTextHeight(); line++)
+    printRow (line);
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    setReverse(false);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawRow (std::size_t row)
+{
+  const auto line = getRowLine(row);
+
+  if ( line != not_visible )
+    printRow (line);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::printRow (std::size_t line)
+{
+  const auto row = model ? getLineRow(line) : not_visible;
+  const auto y = 2 - nf_offset + int(line);
+  const auto text_end = 2 + int(getTextWidth());
+  int x{2};
+
+  if ( row != not_visible )
+  {
+    for (const auto& visible_column : visible_columns)
+    {
+      printCell (row, line, visible_column);
+      x = visible_column.x + 1 + int(visible_column.width);
+    }
+  }
+
+  if ( x >= text_end )
+    return;
+
+  setCellColor (not_visible, not_visible);
+  print() << FPoint{x, y} << FString{std::size_t(text_end - x), L' '};
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::printCell ( std::size_t row, std::size_t line
+                          , const FVisibleColumn& visible_column )
+{
+  const auto column = visible_column.column;
+  const bool is_first_scrollable = frozen_columns > 0
+      && column == std::min(frozen_columns, getColumnCount()) + std::size_t(xoffset);
+  print() << FPoint{visible_column.x, 2 - nf_offset + int(line)};
+  setCellColor (row, not_visible);
+
+  if ( is_first_scrollable )
+    print (UniChar::BoxDrawingsVertical);  // Separates the frozen columns
+  else
+    print (' ');
+
+  setCellColor (row, column);
+  print (getCellText ( model->getData(row, column)
+                     , visible_column.width
+                     , model->getColumnAlignment(column) ));
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::setCellColor (std::size_t row, std::size_t column) const
+{
+  const auto& wc = getColorTheme();
+  const bool is_focus = hasFocus();
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    setReverse(row != current_row);
+
+  if ( row == current_row && column == current_column )
+  {
+    if ( is_focus )
+      setColor ( wc->current_element.selected_focus_fg
+               , wc->current_element.selected_focus_bg );
+    else
+      setColor ( wc->current_element.selected_fg
+               , wc->current_element.selected_bg );
+  }
+  else if ( row == current_row )
+  {
+    if ( is_focus )
+      setColor ( wc->current_element.focus_fg
+               , wc->current_element.focus_bg );
+    else
+      setColor ( wc->current_element.fg
+               , wc->current_element.bg );
+  }
+  else if ( row < frozen_rows || column < frozen_columns )
+    setColor (wc->label.emphasis_fg, wc->list.bg);
+  else
+    setColor (wc->list.fg, wc->list.bg);
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::getCellText ( const FString& text, std::size_t width
+                            , Align alignment ) const -> FString
+{
+  // Fits the text into the column width
+
+  static constexpr std::size_t ellipsis_length = 2;
+  FString cell{text};
+  auto length = finalcut::getColumnWidth(cell);
+
+  if ( length > width )
+  {
+    if ( width > ellipsis_length )
+      cell = getColumnSubString(text, 1, width - ellipsis_length) + "..";
+    else
+      cell = getColumnSubString(text, 1, width);
+
+    length = finalcut::getColumnWidth(cell);
+  }
+
+  const auto space = width - std::min(length, width);
+  std::size_t leading_space{0};
+
+  if ( alignment == Align::Right )
+    leading_space = space;
+  else if ( alignment == Align::Center )
+    leading_space = space / 2;
+
+  return FString{leading_space, L' '} + cell
+       + FString{space - leading_space, L' '};
+}
+
+//----------------------------------------------------------------------
+auto FDataGrid::measureColumn (std::size_t column) -> std::size_t
+{
+  // Determines the column width from the title and the visible cells
+
+  std::size_t width = finalcut::getColumnWidth(model->getColumnText(column));
+
+  if ( model->isSortable(column) )
+    width++;  // Space for the sort indicator
+
+  for (std::size_t line{0}; line < getTextHeight(); line++)
+  {
+    const auto row = getLineRow(line);
+
+    if ( row == not_visible )
+      break;
+
+    width = std::max(width, finalcut::getColumnWidth(model->getData(row, column)));
+  }
+
+  return std::max(std::size_t(1), std::min(width, max_column_width));
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::resetColumnWidths()
+{
+  column_widths.assign(getColumnCount(), 0);
+  visible_columns.clear();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::layoutColumns()
+{
+  // Determines the position and width of the visible columns.
+  // Each column begins with a separator character.
+
+  visible_columns.clear();
+
+  if ( ! model )
+    return;
+
+  const auto text_end = 2 + int(getTextWidth());
+  const auto columns = getColumnCount();
+  const auto frozen = std::min(frozen_columns, columns);
+  int x{2};
+
+  auto add_column = [this, &x, text_end] (std::size_t column)
+  {
+    const int space = text_end - x - 1;
+
+    if ( space < 1 )
+      return false;
+
+    const auto width = std::min(getColumnWidth(column), std::size_t(space));
+    visible_columns.push_back({column, x, width});
+    x += 1 + int(width);
+    return true;
+  };
+
+  for (std::size_t column{0}; column < frozen; column++)
+    if ( ! add_column(column) )
+      return;
+
+  for (auto column = frozen + std::size_t(xoffset); column < columns; column++)
+    if ( ! add_column(column) )
+      return;
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::drawDirtyCells()
+{
+  for (const auto key : dirty_cells)
+  {
+    const auto row = std::size_t(key >> 32);
+    const auto column = std::size_t(key & 0xffffffff);
+    const auto line = getRowLine(row);
+    const auto* visible_column = findVisibleColumn(column);
+
+    if ( line != not_visible && visible_column )
+      printCell (row, line, *visible_column);
+  }
+
+  if ( FVTerm::getFOutput()->isMonochron() )
+    setReverse(false);
+
+  dirty_cells.clear();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::updateFrameTimer()
+{
+  // The frame timer only runs while changed cells are waiting
+
+  const bool needed = ! dirty_cells.empty();
+
+  if ( needed && ! update_timer )
+    update_timer = addTimer(FRAME_INTERVAL);
+  else if ( ! needed && update_timer )
+  {
+    delTimer (update_timer);
+    update_timer = 0;
+  }
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::moveCurrentCell (int dx, int dy)
+{
+  const auto row = int(current_row) + dy;
+  const auto column = int(current_column) + dx;
+  setCurrentCell (std::size_t(std::max(0, row)), std::size_t(std::max(0, column)));
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::scrollToCurrentCell()
+{
+  int x{xoffset};
+  int y{yoffset};
+  const auto first_row = std::min(frozen_rows, getRowCount());
+  const auto first_column = std::min(frozen_columns, getColumnCount());
+
+  if ( current_row >= first_row )
+  {
+    const auto row = int(current_row - first_row);
+    const auto page = int(getTextHeight() - getVisibleFrozenRows());
+
+    if ( row < y )
+      y = row;
+    else if ( page > 0 && row >= y + page )
+      y = row - page + 1;
+  }
+
+  if ( current_column >= first_column )
+  {
+    const auto column = int(current_column - first_column);
+
+    if ( column < x )
+      x = column;
+    else
+    {
+      // Scrolls until the current column fits into the free space
+      int space = int(getTextWidth());
+
+      for (std::size_t c{0}; c < first_column; c++)
+        space -= 1 + int(getColumnWidth(c));
+
+      int used{0};
+
+      for (auto c = x; c <= column; c++)
+        used += 1 + int(getColumnWidth(first_column + std::size_t(c)));
+
+      while ( used > space && x < column )
+      {
+        used -= 1 + int(getColumnWidth(first_column + std::size_t(x)));
+        x++;
+      }
+    }
+  }
+
+  scrollTo (x, y);
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::clampPositions()
+{
+  const auto rows = getRowCount();
+  const auto columns = getColumnCount();
+  current_row = ( rows > 0 ) ? std::min(current_row, rows - 1) : 0;
+  current_column = ( columns > 0 ) ? std::min(current_column, columns - 1) : 0;
+  xoffset = std::max(0, std::min(xoffset, getMaxXOffset()));
+  yoffset = std::max(0, std::min(yoffset, getMaxYOffset()));
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::updateScrollbars() const
+{
+  const auto page = int(getTextHeight() - getVisibleFrozenRows());
+  const auto visible_scrollable_columns = std::count_if
+  (
+    visible_columns.cbegin(), visible_columns.cend(),
+    [this] (const FVisibleColumn& visible)
+    {
+      return visible.column >= frozen_columns;
+    }
+  );
+
+  vbar->setMaximum (getMaxYOffset());
+  vbar->setPageSize (int(getScrollableRows()), std::max(1, page));
+  vbar->setValue (yoffset);
+  vbar->calculateSliderValues();
+  hbar->setMaximum (getMaxXOffset());
+  hbar->setPageSize ( int(getScrollableColumns())
+                    , std::max(1, int(visible_scrollable_columns)) );
+  hbar->setValue (xoffset);
+  hbar->calculateSliderValues();
+
+  if ( isHorizontallyScrollable() )
+    hbar->show();
+  else
+    hbar->hide();
+
+  if ( isVerticallyScrollable() )
+    vbar->show();
+  else
+    vbar->hide();
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::processRowChanged() const
+{
+  emitCallback("row-changed");
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::processClick() const
+{
+  emitCallback("clicked");
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::changeOnResize() const
+{
+  const std::size_t width  = getWidth();
+  const std::size_t height = getHeight();
+
+  if ( FVTerm::getFOutput()->isNewFont() )
+  {
+    vbar->setGeometry (FPoint{int(width), 1}, FSize{2, height - 1});
+    hbar->setGeometry (FPoint{1, int(height)}, FSize{width - 2, 1});
+  }
+  else
+  {
+    vbar->setGeometry (FPoint{int(width), 2}, FSize{1, height - 2});
+    hbar->setGeometry (FPoint{2, int(height)}, FSize{width - 2, 1});
+  }
+
+  vbar->resize();
+  hbar->resize();
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::shouldUpdateScrollbar (FScrollbar::ScrollType scroll_type) const -> bool
+{
+  return scroll_type >= FScrollbar::ScrollType::StepBackward;
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getVerticalScrollDistance (const FScrollbar::ScrollType scroll_type) const -> int
+{
+  if ( scroll_type == FScrollbar::ScrollType::PageBackward
+    || scroll_type == FScrollbar::ScrollType::PageForward )
+  {
+    return std::max(1, int(getTextHeight() - getVisibleFrozenRows()));
+  }
+
+  return 1;
+}
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getHorizontalScrollDistance (const FScrollbar::ScrollType scroll_type) const -> int
+{
+  if ( scroll_type == FScrollbar::ScrollType::PageBackward
+    || scroll_type == FScrollbar::ScrollType::PageForward )
+  {
+    return std::max(1, int(visible_columns.size()) - int(frozen_columns));
+  }
+
+  return 1;
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::cb_vbarChange (const FWidget*)
+{
+  const auto scroll_type = vbar->getScrollType();
+  update_scrollbar = shouldUpdateScrollbar(scroll_type);
+  static constexpr int wheel_distance = 4;
+  int distance = getVerticalScrollDistance(scroll_type);
+
+  switch ( scroll_type )
+  {
+    case FScrollbar::ScrollType::PageBackward:
+    case FScrollbar::ScrollType::StepBackward:
+      scrollBy (0, -distance);
+      break;
+
+    case FScrollbar::ScrollType::PageForward:
+    case FScrollbar::ScrollType::StepForward:
+      scrollBy (0, distance);
+      break;
+
+    case FScrollbar::ScrollType::Jump:
+      scrollToY (vbar->getValue());
+      break;
+
+    case FScrollbar::ScrollType::WheelUp:
+    case FScrollbar::ScrollType::WheelLeft:
+      scrollBy (0, -wheel_distance);
+      break;
+
+    case FScrollbar::ScrollType::WheelDown:
+    case FScrollbar::ScrollType::WheelRight:
+      scrollBy (0, wheel_distance);
+      break;
+
+    default:
+      throw std::invalid_argument{"Invalid scroll type"};
+  }
+
+  update_scrollbar = true;
+}
+
+//----------------------------------------------------------------------
+void FDataGrid::cb_hbarChange (const FWidget*)
+{
+  const auto scroll_type = hbar->getScrollType();
+  update_scrollbar = shouldUpdateScrollbar(scroll_type);
+  int distance = getHorizontalScrollDistance(scroll_type);
+
+  switch ( scroll_type )
+  {
+    case FScrollbar::ScrollType::PageBackward:
+    case FScrollbar::ScrollType::StepBackward:
+      scrollBy (-distance, 0);
+      break;
+
+    case FScrollbar::ScrollType::PageForward:
+    case FScrollbar::ScrollType::StepForward:
+      scrollBy (distance, 0);
+      break;
+
+    case FScrollbar::ScrollType::Jump:
+      scrollToX (hbar->getValue());
+      break;
+
+    case FScrollbar::ScrollType::WheelUp:
+    case FScrollbar::ScrollType::WheelLeft:
+      scrollBy (-1, 0);
+      break;
+
+    case FScrollbar::ScrollType::WheelDown:
+    case FScrollbar::ScrollType::WheelRight:
+      scrollBy (1, 0);
+      break;
+
+    default:
+      throw std::invalid_argument{"Invalid scroll type"};
+  }
+
+  update_scrollbar = true;
+}
+
+}  // namespace finalcut
@@ -0,0 +1,421 @@
+/***********************************************************************
+* fdatagrid.h - Widget FDataGrid (a table with a row/column model)     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▏
+ * ▕ FVTerm  ▏ ▕ FObject ▏
+ * ▕▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▏
+ *      ▲           ▲
+ *      │           │
+ *      └─────┬─────┘
+ *            │
+ *       ▕▔▔▔▔▔▔▔▔▔▏
+ *       ▕ FWidget ▏
+ *       ▕▁▁▁▁▁▁▁▁▁▏
+ *            ▲
+ *            │
+ *      ▕▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *      ▕ FDataGrid ▏- - - -▕ FDataGridModel ▏
+ *      ▕▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                                   ▲
+ *                                   │
+ *                          ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                          ▕ FDataGridTable ▏
+ *                          ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FDATAGRID_H
+#define FDATAGRID_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "final/fwidget.h"
+#include "final/util/fstring.h"
+#include "final/widget/fscrollbar.h"
+
+namespace finalcut
+{
+
+// class forward declaration
+class FScrollbar;
+
+// Global using-declaration
+using FScrollbarPtr = std::shared_ptr<FScrollbar>;
+
+//----------------------------------------------------------------------
+// class FDataGridModel
+//----------------------------------------------------------------------
+
+// Data source of a data grid. The grid only requests the cells it
+// shows. Sorting and filtering are done by the model, the row numbers
+// always refer to the sorted and filtered rows.
+
+class FDataGridModel
+{
+  public:
+    // Constructor
+    FDataGridModel() = default;
+
+    // Destructor
+    virtual ~FDataGridModel() noexcept;
+
+    // Accessors
+    virtual auto getClassName() const -> FString;
+    virtual auto getRowCount() const -> std::size_t = 0;
+    virtual auto getColumnCount() const -> std::size_t = 0;
+    virtual auto getData (std::size_t, std::size_t) const -> FString = 0;
+    virtual auto getColumnText (std::size_t) const -> FString;
+    virtual auto getColumnAlignment (std::size_t) const -> Align;
+
+    // Inquiry
+    virtual auto isSortable (std::size_t) const -> bool;
+
+    // Methods
+    virtual void sort (std::size_t, SortOrder);
+    virtual void filter (const FString&);
+};
+
+//----------------------------------------------------------------------
+// class FDataGridTable
+//----------------------------------------------------------------------
+
+// Model that keeps the table in memory. Sorting and filtering only
+// change the order of the row numbers.
+
+class FDataGridTable final : public FDataGridModel
+{
+  public:
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getRowCount() const -> std::size_t override;
+    auto getColumnCount() const -> std::size_t override;
+    auto getData (std::size_t, std::size_t) const -> FString override;
+    auto getColumnText (std::size_t) const -> FString override;
+    auto getColumnAlignment (std::size_t) const -> Align override;
+
+    // Mutator
+    void setData (std::size_t, std::size_t, const FString&);
+
+    // Inquiry
+    auto isSortable (std::size_t) const -> bool override;
+
+    // Methods
+    void addColumn (const FString&, Align = Align::Left);
+    void addRow (const FStringList&);
+    void clear();
+    void sort (std::size_t, SortOrder) override;
+    void filter (const FString&) override;
+
+  private:
+    struct Column
+    {
+      FString text{};
+      Align   alignment{Align::Left};
+    };
+
+    struct SortKey
+    {
+      double value{0.0};
+      bool   is_number{false};
+    };
+
+    // Accessors
+    auto getSortCell (std::size_t) const -> const FString&;
+    static auto getSortKey (const FString&) -> SortKey;
+
+    // Inquiry
+    auto isMatching (std::size_t) const -> bool;
+    auto isLess (std::size_t, std::size_t) const -> bool;
+
+    // Method
+    void updateRows();
+
+    // Data members
+    std::vector<Column>      columns{};
+    std::vector<FStringList> data{};
+    std::vector<std::size_t> rows{};  // Data index of the shown rows
+    std::vector<SortKey>     sort_keys{};  // Per data index (when sorted)
+    std::wstring             filter_key{};
+    std::size_t              sort_column{0};
+    SortOrder                sort_order{SortOrder::Unsorted};
+};
+
+//----------------------------------------------------------------------
+// class FDataGrid
+//----------------------------------------------------------------------
+
+// Shows the cells of a data grid model. Only the visible rows and
+// columns are requested from the model. The column widths are measured
+// once from the visible cells and cached. Changed cells are collected
+// and redrawn individually with the next frame.
+
+class FDataGrid : public FWidget
+{
+  public:
+    // Using-declaration
+    using FWidget::setGeometry;
+
+    // Constructor
+    explicit FDataGrid (FWidget* = nullptr);
+
+    // Destructor
+    ~FDataGrid() noexcept override;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getModel() const -> FDataGridModel*;
+    auto getRowCount() const -> std::size_t;
+    auto getColumnCount() const -> std::size_t;
+    auto getCurrentRow() const noexcept -> std::size_t;
+    auto getCurrentColumn() const noexcept -> std::size_t;
+    auto getColumnWidth (std::size_t) -> std::size_t;
+    auto getFrozenRows() const noexcept -> std::size_t;
+    auto getFrozenColumns() const noexcept -> std::size_t;
+    auto getSortColumn() const noexcept -> std::size_t;
+    auto getSortOrder() const noexcept -> SortOrder;
+    auto getScrollPos() const -> FPoint;
+
+    // Mutators
+    void setSize (const FSize&, bool = true) override;
+    void setGeometry (const FPoint&, const FSize&, bool = true) override;
+    void resetColors() override;
+    void setModel (FDataGridModel*);
+    void unsetModel();
+    void setColumnWidth (std::size_t, std::size_t);
+    void setFrozenRows (std::size_t);
+    void setFrozenColumns (std::size_t);
+    void setCurrentCell (std::size_t, std::size_t);
+    void setFilterText (const FString&);
+
+    // Inquiry
+    auto hasModel() const -> bool;
+
+    // Methods
+    void hide() override;
+    void sortByColumn (std::size_t, SortOrder = SortOrder::Ascending);
+    void updateCell (std::size_t, std::size_t);
+    void updateRow (std::size_t);
+    void updateData();
+    void scrollToX (int);
+    void scrollToY (int);
+    void scrollTo (const FPoint&);
+    void scrollTo (int, int);
+    void scrollBy (int, int);
+
+    // Event handlers
+    void onKeyPress (FKeyEvent*) override;
+    void onMouseDown (FMouseEvent*) override;
+    void onMouseDoubleClick (FMouseEvent*) override;
+    void onWheel (FWheelEvent*) override;
+    void onTimer (FTimerEvent*) override;
+
+  protected:
+    // Methods
+    void initLayout() override;
+    void adjustSize() override;
+
+  private:
+    // Constant
+    static constexpr int FRAME_INTERVAL = 20;  // Cell update (ms)
+
+    struct FVisibleColumn
+    {
+      std::size_t column{};
+      int         x{};      // Position of the leading separator
+      std::size_t width{};  // Shown cell width
+    };
+
+    // Using-declarations
+    using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
+    using FVisibleColumns = std::vector<FVisibleColumn>;
+    using FDirtyCells = std::unordered_set<uInt64>;
+
+    // Accessors
+    auto getTextHeight() const -> std::size_t;
+    auto getTextWidth() const -> std::size_t;
+    auto getVisibleFrozenRows() const -> std::size_t;
+    auto getScrollableRows() const -> std::size_t;
+    auto getScrollableColumns() const -> std::size_t;
+    auto getMaxXOffset() const -> int;
+    auto getMaxYOffset() const -> int;
+    auto getLineRow (std::size_t) const -> std::size_t;
+    auto getRowLine (std::size_t) const -> std::size_t;
+    auto findVisibleColumn (std::size_t) const -> const FVisibleColumn*;
+    auto findColumnAt (int) const -> const FVisibleColumn*;
+
+    // Inquiries
+    auto isHorizontallyScrollable() const -> bool;
+    auto isVerticallyScrollable() const -> bool;
+
+    // Methods
+    void init();
+    void mapKeyFunctions();
+    void draw() override;
+    void drawBorder() override;
+    void drawScrollbars() const;
+    void drawHeader();
+    void drawCells();
+    void drawRow (std::size_t);
+    void printRow (std::size_t);
+    void printCell (std::size_t, std::size_t, const FVisibleColumn&);
+    void setCellColor (std::size_t, std::size_t) const;
+    auto getCellText (const FString&, std::size_t, Align) const -> FString;
+    auto measureColumn (std::size_t) -> std::size_t;
+    void resetColumnWidths();
+    void layoutColumns();
+    void drawDirtyCells();
+    void updateFrameTimer();
+    void moveCurrentCell (int, int);
+    void scrollToCurrentCell();
+    void clampPositions();
+    void updateScrollbars() const;
+    void processRowChanged() const;
+    void processClick() const;
+    void changeOnResize() const;
+    auto shouldUpdateScrollbar (FScrollbar::ScrollType) const -> bool;
+    auto getVerticalScrollDistance (const FScrollbar::ScrollType) const -> int;
+    auto getHorizontalScrollDistance (const FScrollbar::ScrollType) const -> int;
+
+    // Callback methods
+    void cb_vbarChange (const FWidget*);
+    void cb_hbarChange (const FWidget*);
+
+    // Data members
+    FDataGridModel*          model{nullptr};
+    std::vector<std::size_t> column_widths{};  // 0 = not measured yet
+    FVisibleColumns          visible_columns{};
+    FDirtyCells              dirty_cells{};
+    FScrollbarPtr            vbar{nullptr};
+    FScrollbarPtr            hbar{nullptr};
+    KeyMap                   key_map{};
+    std::size_t              current_row{0};
+    std::size_t              current_column{0};
+    std::size_t              frozen_rows{0};
+    std::size_t              frozen_columns{0};
+    std::size_t              sort_column{0};
+    SortOrder                sort_order{SortOrder::Unsorted};
+    int                      xoffset{0};  // First scrollable column
+    int                      yoffset{0};  // First scrollable row
+    int                      update_timer{0};
+    int                      nf_offset{0};
+    bool                     update_scrollbar{true};
+};
+
+// FDataGridTable inline functions
+//----------------------------------------------------------------------
+inline auto FDataGridTable::getClassName() const -> FString
+{ return "FDataGridTable"; }
+
+//----------------------------------------------------------------------
+inline auto FDataGridTable::getRowCount() const -> std::size_t
+{ return rows.size(); }
+
+//----------------------------------------------------------------------
+inline auto FDataGridTable::getColumnCount() const -> std::size_t
+{ return columns.size(); }
+
+//----------------------------------------------------------------------
+inline auto FDataGridTable::isSortable (std::size_t column) const -> bool
+{ return column < columns.size(); }
+
+// FDataGrid inline functions
+//----------------------------------------------------------------------
+inline auto FDataGrid::getClassName() const -> FString
+{ return "FDataGrid"; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getModel() const -> FDataGridModel*
+{ return model; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getRowCount() const -> std::size_t
+{ return model ? model->getRowCount() : 0; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getColumnCount() const -> std::size_t
+{ return model ? model->getColumnCount() : 0; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getCurrentRow() const noexcept -> std::size_t
+{ return current_row; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getCurrentColumn() const noexcept -> std::size_t
+{ return current_column; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getFrozenRows() const noexcept -> std::size_t
+{ return frozen_rows; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getFrozenColumns() const noexcept -> std::size_t
+{ return frozen_columns; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getSortColumn() const noexcept -> std::size_t
+{ return sort_column; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getSortOrder() const noexcept -> SortOrder
+{ return sort_order; }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::getScrollPos() const -> FPoint
+{ return {xoffset, yoffset}; }
+
+//----------------------------------------------------------------------
+inline void FDataGrid::unsetModel()
+{ setModel(nullptr); }
+
+//----------------------------------------------------------------------
+inline auto FDataGrid::hasModel() const -> bool
+{ return model != nullptr; }
+
+//----------------------------------------------------------------------
+inline void FDataGrid::scrollToX (int x)
+{ scrollTo (x, yoffset); }
+
+//----------------------------------------------------------------------
+inline void FDataGrid::scrollToY (int y)
+{ scrollTo (xoffset, y); }
+
+//----------------------------------------------------------------------
+inline void FDataGrid::scrollTo (const FPoint& pos)
+{ scrollTo (pos.getX(), pos.getY()); }
+
+//----------------------------------------------------------------------
+inline void FDataGrid::scrollBy (int dx, int dy)
+{ scrollTo (xoffset + dx, yoffset + dy); }
+
+}  // namespace finalcut
+
+#endif  // FDATAGRID_H
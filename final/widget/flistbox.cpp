@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -21,12 +21,15 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <cwctype>
 #include <memory>
+#include <numeric>
 
 #include "final/fapplication.h"
 #include "final/fevent.h"
 #include "final/fwidgetcolors.h"
 #include "final/util/fstring.h"
+#include "final/util/fworkerpool.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/widget/flistbox.h"
 #include "final/widget/fstatusbar.h"
@@ -34,6 +37,28 @@
 namespace finalcut
 {
 
+// Function prototype
+auto getListSearchKey (const FString&) -> std::wstring;
+
+// Lists from this size are filtered in parallel
+constexpr std::size_t parallel_filter_size = 16384;
+
+// Function
+//----------------------------------------------------------------------
+auto getListSearchKey (const FString& str) -> std::wstring
+{
+  // Case-folded text for the incremental search and the filter
+
+  std::wstring key{};
+  key.reserve(str.getLength());
+
+  for (const auto& ch : str)
+    key.push_back(wchar_t(std::towlower(std::wint_t(ch))));
+
+  return key;
+}
+
+
 //----------------------------------------------------------------------
 // class FListBox
 //----------------------------------------------------------------------
@@ -59,17 +84,20 @@ FListBox::~FListBox()  // destructor
 //----------------------------------------------------------------------
 void FListBox::setCurrentItem (std::size_t index)
 {
-  if ( index == selection.current )
+  // A hidden item selects the next visible row
+  const std::size_t row = itemToRow(index);
+
+  if ( row == selection.current )
     return;
 
-  const std::size_t element_count = getCount();
+  const std::size_t element_count = getVisibleCount();
 
-  if ( index > element_count )
+  if ( row > element_count )
     selection.current = element_count;
-  else if ( index < 1 )
+  else if ( row < 1 )
     selection.current = 1;
   else
-    selection.current = index;
+    selection.current = row;
 
   scroll.xoffset = 0;
   scroll.yoffset = 0;
@@ -85,17 +113,51 @@ void FListBox::setCurrentItem (FListBoxItems::iterator iter)
   setCurrentItem(index);
 }
 
+//----------------------------------------------------------------------
+void FListBox::selectItem (std::size_t index)
+{
+  if ( ! isVirtual() )
+  {
+    index2iterator(index - 1)->selected = true;
+    return;
+  }
+
+  auto state = getVirtualState(index - 1);
+  state.selected = true;
+  setVirtualState (index - 1, state);
+}
+
+//----------------------------------------------------------------------
+void FListBox::unselectItem (std::size_t index)
+{
+  if ( ! isVirtual() )
+  {
+    index2iterator(index - 1)->selected = false;
+    return;
+  }
+
+  auto state = getVirtualState(index - 1);
+  state.selected = false;
+  setVirtualState (index - 1, state);
+}
+
 //----------------------------------------------------------------------
 void FListBox::showInsideBrackets ( const std::size_t index
                                   , BracketType b )
 {
-  auto iter = index2iterator(index - 1);
-  iter->brackets = b;
+  if ( isVirtual() )
+  {
+    auto state = getVirtualState(index - 1);
+    state.brackets = b;
+    setVirtualState (index - 1, state);
+  }
+  else
+    index2iterator(index - 1)->brackets = b;
 
   if ( b == BracketType::None )
     return;
 
-  const auto column_width = getColumnWidth(iter->getText()) + 2;
+  const auto column_width = getColumnWidth(getItemText(index - 1)) + 2;
 
   if ( column_width <= max_line_width )
     return;
@@ -113,6 +175,20 @@ void FListBox::showInsideBrackets ( const std::size_t index
   }
 }
 
+//----------------------------------------------------------------------
+void FListBox::showNoBrackets (std::size_t index)
+{
+  if ( ! isVirtual() )
+  {
+    index2iterator(index - 1)->brackets = BracketType::None;
+    return;
+  }
+
+  auto state = getVirtualState(index - 1);
+  state.brackets = BracketType::None;
+  setVirtualState (index - 1, state);
+}
+
 //----------------------------------------------------------------------
 void FListBox::setSize (const FSize& size, bool adjust)
 {
@@ -134,6 +210,58 @@ void FListBox::setText (const FString& txt)
   data.text.setString(txt);
 }
 
+//----------------------------------------------------------------------
+void FListBox::setSearchIndex (bool enable)
+{
+  // The index is built with the next search
+
+  search.index = enable;
+
+  if ( enable )
+    return;
+
+  search.order.clear();
+  search.order.shrink_to_fit();
+  search.sorted = 0;
+
+  if ( isFiltered() )
+    return;  // The filter still needs the keys
+
+  search.keys.clear();
+  search.keys.shrink_to_fit();
+  search.keys_valid = false;
+}
+
+//----------------------------------------------------------------------
+void FListBox::setFilterText (const FString& text)
+{
+  // Shows only the items that contain the text (ignoring the case)
+
+  const auto item_before = currentItem();
+  changeFilter (text, false);
+
+  if ( item_before != currentItem() )
+    processRowChanged();
+}
+
+//----------------------------------------------------------------------
+auto FListBox::isSelected (std::size_t index) const -> bool
+{
+  if ( isVirtual() )
+    return getVirtualState(index - 1).selected;
+
+  return index2iterator(index - 1)->selected;
+}
+
+//----------------------------------------------------------------------
+auto FListBox::hasBrackets (std::size_t index) const -> bool
+{
+  if ( isVirtual() )
+    return getVirtualState(index - 1).brackets != BracketType::None;
+
+  return index2iterator(index - 1)->brackets != BracketType::None;
+}
+
 //----------------------------------------------------------------------
 void FListBox::hide()
 {
@@ -144,35 +272,46 @@ void FListBox::hide()
 //----------------------------------------------------------------------
 void FListBox::insert (const FListBoxItem& listItem)
 {
+  if ( isVirtual() )  // The source container defines the items
+    return;
+
   const auto column_width = getColumnWidth(listItem.text);
   const bool has_brackets(listItem.brackets != BracketType::None);
   recalculateHorizontalBar (column_width, has_brackets);
 
   data.itemlist.push_back (listItem);
+  addSearchKey (getCount() - 1);
 
-  if ( selection.current == 0 )
+  if ( selection.current == 0 && getVisibleCount() > 0 )
     selection.current = 1;
 
-  recalculateVerticalBar (getCount());
+  recalculateVerticalBar (getVisibleCount());
   processChanged();
 }
 
 //----------------------------------------------------------------------
 void FListBox::remove (std::size_t item)
 {
-  if ( item > getCount() )
+  if ( item > getCount() || isVirtual() )
     return;
 
+  const auto row = removeSearchKey(item);
   data.itemlist.erase (data.itemlist.cbegin() + int(item) - 1);
 
   recalculateMaximumLineWidth();
-  updateScrollBarAfterRemoval (item);
+  updateScrollBarAfterRemoval (row);
   processChanged();
 }
 
 //----------------------------------------------------------------------
 auto FListBox::findItem (const FString& search_text) -> FListBoxItems::iterator
 {
+  if ( isVirtual() )  // No iterators without an item list
+    return data.itemlist.end();
+
+  if ( search.index )
+    return findIndexedItem(search_text);
+
   auto iter = data.itemlist.begin();
 
   while ( iter != data.itemlist.end() )
@@ -189,8 +328,20 @@ auto FListBox::findItem (const FString& search_text) -> FListBoxItems::iterator
 //----------------------------------------------------------------------
 void FListBox::clear()
 {
+  if ( isVirtual() )
+  {
+    conv_type = ConvertType::None;
+    virtual_list.cache.clear();
+    virtual_list.states.clear();
+    virtual_list.count = 0;
+  }
+
   data.itemlist.clear();
   data.itemlist.shrink_to_fit();
+  search.keys.clear();
+  search.order.clear();
+  search.rows.clear();
+  search.sorted = 0;
   selection.current = 0;
   scroll.xoffset = 0;
   scroll.yoffset = 0;
@@ -216,23 +367,38 @@ void FListBox::clear()
   if ( size == 0 )
     return;
 
-  for (auto y{0}; y < int(getHeight()) - 2; y++)
-  {
-    print() << FPoint{2, 2 + y} << FString{size, L' '};
-  }
-
+  fillRect (FRect{FPoint{2, 2}, FPoint{int(getWidth()) - 1, int(getHeight()) - 1}});
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FListBox::clearSearchIndex()
+{
+  // Drops the search keys, e.g. after the item texts have been changed
+
+  search.keys.clear();
+  search.keys.shrink_to_fit();
+  search.order.clear();
+  search.order.shrink_to_fit();
+  search.sorted = 0;
+  search.keys_valid = false;
+
+  if ( ! isFiltered() )
+    return;
+
+  search.filter_key.clear();  // Filter all items again
+  changeFilter (search.filter_text, false);
+}
+
 //----------------------------------------------------------------------
 void FListBox::onKeyPress (FKeyEvent* ev)
 {
-  const std::size_t current_before = selection.current;
+  const std::size_t current_before = currentItem();
   const int xoffset_before = scroll.xoffset;
   const int yoffset_before = scroll.yoffset;
   processKeyAction(ev);  // Process the keystrokes
 
-  if ( current_before != selection.current )
+  if ( current_before != currentItem() )
     processRowChanged();
 
   if ( ev->isAccepted() )
@@ -290,7 +456,7 @@ void FListBox::onMouseDoubleClick (FMouseEvent* ev)
     || ! isWithinListBounds(ev->getPos()) )
     return;
 
-  if ( scroll.yoffset + ev->getY() - 1 > int(getCount()) )
+  if ( scroll.yoffset + ev->getY() - 1 > int(getVisibleCount()) )
     return;
 
   processClick();
@@ -416,7 +582,7 @@ void FListBox::adjustYOffset (std::size_t element_count)
 void FListBox::adjustSize()
 {
   FWidget::adjustSize();
-  const std::size_t element_count = getCount();
+  const std::size_t element_count = getVisibleCount();
   const std::size_t width = getClientWidth();
   const std::size_t height = getClientHeight();
   adjustYOffset (element_count);
@@ -430,6 +596,7 @@ void FListBox::adjustSize()
   scroll.hbar->setY (int(getHeight()));
   scroll.hbar->setWidth (width, false);
   scroll.hbar->resize();
+  updateVirtualCacheSize();
 
   if ( isHorizontallyScrollable() )
     scroll.hbar->show();
@@ -445,9 +612,9 @@ void FListBox::adjustSize()
 
 // private methods of FListBox
 //----------------------------------------------------------------------
-inline auto FListBox::getString (FListBoxItems::iterator iter) -> FString
+inline auto FListBox::getString (const FListBoxItem& item) -> FString
 {
-  return iter->getText();
+  return item.getText();
 }
 
 //----------------------------------------------------------------------
@@ -557,6 +724,7 @@ void FListBox::draw()
   }
 
   drawHeadline();
+  drawFilterText();
 
   if ( FVTerm::getFOutput()->isMonochron() )
     setReverse(false);
@@ -617,14 +785,14 @@ void FListBox::drawHeadline()
 //----------------------------------------------------------------------
 inline auto FListBox::canSkipDrawing() const -> bool
 {
-  return data.itemlist.empty() || getHeight() <= 2 || getWidth() <= 4;
+  return getVisibleCount() == 0 || getHeight() <= 2 || getWidth() <= 4;
 }
 
 //----------------------------------------------------------------------
 inline auto FListBox::calculateNumberItemsToDraw() const -> std::size_t
 {
   std::size_t num{getHeight() - 2};
-  return std::min(num, getCount());
+  return std::min(num, getVisibleCount());
 }
 
 //----------------------------------------------------------------------
@@ -665,31 +833,33 @@ void FListBox::drawList()
   if ( canRedrawPartialList() )
     updateRedrawParameters(start, num);
 
-  auto iter = index2iterator(start + std::size_t(scroll.yoffset));
+  const std::size_t element_count = getVisibleCount();
 
-  for (std::size_t y = start; y < num && iter != data.itemlist.end() ; y++)
+  for (std::size_t y = start; y < num ; y++)
   {
-    bool serach_mark{false};
-    const bool line_has_brackets = hasBrackets(iter);
+    const auto row = y + std::size_t(scroll.yoffset) + 1;
+
+    if ( row > element_count )
+      break;
 
     // Import data via lazy conversion
-    lazyConvert (iter, y);
+    const auto& item = getListItem(rowToItem(row) - 1);
+    bool serach_mark{false};
+    const bool line_has_brackets = item.brackets != BracketType::None;
 
     // Set screen position and attributes
-    setLineAttributes ( int(y), isSelected(iter), line_has_brackets
+    setLineAttributes ( int(y), item.isSelected(), line_has_brackets
                       , serach_mark );
 
     // print the entry
     if ( line_has_brackets )
     {
-      drawListBracketsLine (int(y), iter, serach_mark);
+      drawListBracketsLine (int(y), item, serach_mark);
     }
     else  // line has no brackets
     {
-      drawListLine (int(y), iter, serach_mark);
+      drawListLine (int(y), item, serach_mark);
     }
-
-    ++iter;
   }
 
   finalizeDrawing();
@@ -697,14 +867,14 @@ void FListBox::drawList()
 
 //----------------------------------------------------------------------
 inline void FListBox::drawListLine ( int y
-                                   , FListBoxItems::iterator iter
+                                   , const FListBoxItem& item
                                    , bool serach_mark )
 {
   const std::size_t inc_len = data.inc_search.getLength();
   const auto& wc = getColorTheme();
   const std::size_t first = std::size_t(scroll.xoffset) + 1;
   const std::size_t max_width = getMaxWidth();
-  const FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(item), first, max_width));
   auto column_width = getColumnWidth(element);
   printLeftCurrentLineArrow(y);
 
@@ -742,7 +912,7 @@ inline void FListBox::printRightBracket (BracketType bracket_type)
 
 //----------------------------------------------------------------------
 inline void FListBox::drawListBracketsLine ( int y
-                                           , FListBoxItems::iterator iter
+                                           , const FListBoxItem& item
                                            , bool serach_mark )
 {
   printLeftCurrentLineArrow(y);
@@ -750,11 +920,11 @@ inline void FListBox::drawListBracketsLine ( int y
   std::size_t bracket_space = (scroll.xoffset == 0) ? 1 : 0;
 
   if ( scroll.xoffset == 0 )
-    printLeftBracket (iter->brackets);
+    printLeftBracket (item.brackets);
 
   const auto first = std::size_t(scroll.xoffset);
   const std::size_t max_width = getMaxWidth() - bracket_space;
-  const FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(item), first, max_width));
   const std::size_t inc_len = data.inc_search.getLength();
   const auto& wc = getColorTheme();
 
@@ -771,7 +941,7 @@ inline void FListBox::drawListBracketsLine ( int y
     print (element[i]);
   }
 
-  const std::size_t text_width = getColumnWidth(getString(iter));
+  const std::size_t text_width = getColumnWidth(getString(item));
   auto column_width = getColumnWidth(element);
   std::size_t i = element.getLength();
 
@@ -782,7 +952,7 @@ inline void FListBox::drawListBracketsLine ( int y
       setColor ( wc->current_element.focus_fg
                , wc->current_element.focus_bg );
 
-    printRightBracket (iter->brackets);
+    printRightBracket (item.brackets);
     column_width++;
   }
 
@@ -1014,18 +1184,20 @@ void FListBox::recalculateVerticalBar (std::size_t element_count) const
 //----------------------------------------------------------------------
 void FListBox::multiSelection (std::size_t pos)
 {
-  if ( ! isMultiSelection() )
+  if ( ! isMultiSelection() || pos == 0 )
     return;
 
-  if ( isSelected(pos) )
+  const auto index = rowToItem(pos);
+
+  if ( isSelected(index) )
   {
     selection.mouse_select = false;
-    unselectItem(pos);
+    unselectItem(index);
   }
   else
   {
     selection.mouse_select = true;
-    selectItem(pos);
+    selectItem(index);
   }
 
   processSelect();
@@ -1056,12 +1228,12 @@ void FListBox::multiSelectionUpTo (std::size_t pos)
   {
     if ( selection.mouse_select )
     {
-      selectItem(i);
+      selectItem(rowToItem(i));
       processSelect();
     }
     else
     {
-      unselectItem(i);
+      unselectItem(rowToItem(i));
       processSelect();
     }
   }
@@ -1092,7 +1264,7 @@ void FListBox::wheelUp (int pagesize)
 //----------------------------------------------------------------------
 void FListBox::wheelDown (int pagesize)
 {
-  const auto& element_count = getCount();
+  const auto& element_count = getVisibleCount();
   auto yoffset_end = int(element_count - getClientHeight());
 
   if ( yoffset_end < 0 )
@@ -1155,7 +1327,7 @@ auto FListBox::dragScrollUp() -> bool
 //----------------------------------------------------------------------
 auto FListBox::dragScrollDown() -> bool
 {
-  const auto& element_count = getCount();
+  const auto& element_count = getVisibleCount();
 
   if ( selection.current == element_count )
   {
@@ -1199,7 +1371,7 @@ void FListBox::dragDown (MouseButton mouse_button)
     && scroll.distance < int(getClientHeight()) )
     scroll.distance++;
 
-  if ( ! scroll.timer && selection.current < getCount() )
+  if ( ! scroll.timer && selection.current < getVisibleCount() )
   {
     scroll.timer = true;
     addTimer(scroll.repeat);
@@ -1210,7 +1382,7 @@ void FListBox::dragDown (MouseButton mouse_button)
       drag_scroll = DragScrollMode::Downward;
   }
 
-  if ( selection.current == getCount() )
+  if ( selection.current == getVisibleCount() )
   {
     delOwnTimers();
     drag_scroll = DragScrollMode::None;
@@ -1249,7 +1421,7 @@ void FListBox::prevListItem (int distance)
 //----------------------------------------------------------------------
 void FListBox::nextListItem (int distance)
 {
-  const auto& element_count = getCount();
+  const auto& element_count = getVisibleCount();
   const auto yoffset_end = int(element_count - getClientHeight());
 
   if ( selection.current == element_count )
@@ -1290,7 +1462,7 @@ void FListBox::scrollToX (int val)
 //----------------------------------------------------------------------
 void FListBox::scrollToY (int val)
 {
-  const std::size_t element_count = getCount();
+  const std::size_t element_count = getVisibleCount();
   const auto yoffset_end = int(element_count - getClientHeight());
 
   if ( scroll.yoffset == val )
@@ -1399,7 +1571,7 @@ inline void FListBox::firstPos()
 //----------------------------------------------------------------------
 inline void FListBox::lastPos()
 {
-  const auto& element_count = getCount();
+  const auto& element_count = getVisibleCount();
   const auto yoffset_end = int(element_count - getClientHeight());
   selection.current = element_count;
 
@@ -1421,6 +1593,12 @@ inline auto FListBox::isWithinListBounds (const FPoint& pos) const -> bool
 //----------------------------------------------------------------------
 inline auto FListBox::skipIncrementalSearch() -> bool
 {
+  if ( isTypeAheadFilter() && isFiltered() )
+  {
+    changeFilter (FString{}, false);
+    return true;
+  }
+
   if ( data.inc_search.getLength() > 0 )
   {
     data.inc_search.clear();
@@ -1455,7 +1633,7 @@ void FListBox::handleMouseWithinListBounds ( const FMouseEvent* ev,
     return;
 
   selection.click_on_list = true;
-  const std::size_t element_count = getCount();
+  const std::size_t element_count = getVisibleCount();
   selection.current = std::size_t(scroll.yoffset + ev->getY() - 1);
 
   if ( selection.current > element_count )
@@ -1506,38 +1684,31 @@ inline auto FListBox::spacebarProcessing() -> bool
 {
   const auto& inc_len = data.inc_search.getLength();
 
-  if ( inc_len > 0 )  // Enter a spacebar for incremental search
+  if ( isTypeAheadFilter() && isFiltered() )  // Space in the filter text
+  {
+    filterInput(L' ');
+  }
+  else if ( inc_len > 0 )  // Enter a spacebar for incremental search
   {
     data.inc_search += L' ';
-    bool inc_found{false};
-    auto iter = data.itemlist.begin();
-
-    while ( iter != data.itemlist.end() )
-    {
-      if ( ! inc_found
-        && data.inc_search.toLower()
-        == iter->getText().left(inc_len + 1).toLower() )
-      {
-        setCurrentItem(iter);
-        inc_found = true;
-        break;
-      }
-
-      ++iter;
-    }
+    const auto row = findPrefixRow(data.inc_search);
 
-    if ( ! inc_found )
+    if ( row == 0 )
     {
       data.inc_search.remove(inc_len, 1);
       return false;
     }
+
+    setCurrentItem(rowToItem(row));
   }
-  else if ( isMultiSelection() )  // Change selection
+  else if ( isMultiSelection() && getVisibleCount() > 0 )  // Change selection
   {
-    if ( isSelected(selection.current) )
-      unselectItem(selection.current);
+    const auto index = currentItem();
+
+    if ( isSelected(index) )
+      unselectItem(index);
     else
-      selectItem(selection.current);
+      selectItem(index);
 
     processSelect();
     data.inc_search.clear();
@@ -1549,14 +1720,15 @@ inline auto FListBox::spacebarProcessing() -> bool
 //----------------------------------------------------------------------
 inline auto FListBox::changeSelectionAndPosition() -> bool
 {
-  if ( isMultiSelection() )
+  if ( isMultiSelection() && getVisibleCount() > 0 )
   {
-    const auto& element_count = getCount();
+    const auto& element_count = getVisibleCount();
+    const auto index = currentItem();
 
-    if ( isSelected(selection.current) )
-      unselectItem(selection.current);
+    if ( isSelected(index) )
+      unselectItem(index);
     else
-      selectItem(selection.current);
+      selectItem(index);
 
     processSelect();
     selection.current++;
@@ -1577,6 +1749,9 @@ inline auto FListBox::changeSelectionAndPosition() -> bool
 //----------------------------------------------------------------------
 inline auto FListBox::deletePreviousCharacter() -> bool
 {
+  if ( isTypeAheadFilter() )
+    return deleteFilterCharacter();
+
   const auto& inc_len = data.inc_search.getLength();
 
   if ( inc_len == 0 )
@@ -1586,19 +1761,10 @@ inline auto FListBox::deletePreviousCharacter() -> bool
 
   if ( inc_len > 1 )
   {
-    auto iter = data.itemlist.begin();
+    const auto row = findPrefixRow(data.inc_search);
 
-    while ( iter != data.itemlist.end() )
-    {
-      if ( data.inc_search.toLower()
-           == iter->getText().left(inc_len - 1).toLower() )
-      {
-        setCurrentItem(iter);
-        break;
-      }
-
-      ++iter;
-    }
+    if ( row > 0 )
+      setCurrentItem(rowToItem(row));
   }
 
   return true;
@@ -1610,6 +1776,9 @@ inline auto FListBox::keyIncSearchInput (FKey key) -> bool
   if ( key <= 0x20 || key > 0x10fff )
     return false;
 
+  if ( isTypeAheadFilter() )
+    return filterInput(wchar_t(key));
+
   // incremental search
   if ( data.inc_search.getLength() == 0 )
     data.inc_search = wchar_t(key);
@@ -1617,29 +1786,15 @@ inline auto FListBox::keyIncSearchInput (FKey key) -> bool
     data.inc_search += wchar_t(key);
 
   const auto& inc_len = data.inc_search.getLength();
-  bool inc_found{false};
-  auto iter = data.itemlist.begin();
-
-  while ( iter != data.itemlist.end() )
-  {
-    if ( ! inc_found
-      && data.inc_search.toLower()
-      == iter->getText().left(inc_len).toLower() )
-    {
-      setCurrentItem(iter);
-      inc_found = true;
-      break;
-    }
-
-    ++iter;
-  }
+  const auto row = findPrefixRow(data.inc_search);
 
-  if ( ! inc_found )
+  if ( row == 0 )
   {
     data.inc_search.remove(inc_len - 1, 1);
     return inc_len != 1;
   }
 
+  setCurrentItem(rowToItem(row));
   return true;
 }
 
@@ -1691,14 +1846,15 @@ inline void FListBox::updateScrollBarAfterRemoval (std::size_t item)
   if ( scroll.hbar->isShown() && isHorizontallyScrollable() )
     scroll.hbar->hide();
 
-  const std::size_t element_count = getCount();
+  const std::size_t element_count = getVisibleCount();
   scroll.vbar->setMaximum (getScrollBarMaxVertical());
   scroll.vbar->setPageSize (int(element_count), int(getHeight()) - 2);
 
   if ( scroll.vbar->isShown() && isVerticallyScrollable() )
     scroll.vbar->hide();
 
-  if ( selection.current >= item && selection.current > 1 )
+  // item is the row of the removed item (0 = not visible)
+  if ( item > 0 && selection.current >= item && selection.current > 1 )
     selection.current--;
 
   selection.current = std::min(selection.current, element_count);
@@ -1717,7 +1873,7 @@ inline auto FListBox::getScrollBarMaxHorizontal() const noexcept -> int
 //----------------------------------------------------------------------
 inline auto FListBox::getScrollBarMaxVertical() const noexcept -> int
 {
-  const auto element_count = getCount();
+  const auto element_count = getVisibleCount();
   return element_count + 2 > getHeight()
          ? int(element_count - getHeight()) + 2
          : 0;
@@ -1736,12 +1892,13 @@ inline void FListBox::recalculateMaximumLineWidth()
 }
 
 //----------------------------------------------------------------------
-void FListBox::lazyConvert(FListBoxItems::iterator iter, std::size_t y)
+void FListBox::lazyConvert (FListBoxItems::iterator iter)
 {
   if ( conv_type != ConvertType::Lazy || ! iter->getText().isEmpty() )
     return;
 
-  lazy_inserter (*iter, data.source_container, y + std::size_t(scroll.yoffset));
+  const auto index = std::size_t(std::distance(data.itemlist.begin(), iter));
+  lazy_inserter (*iter, data.source_container, index);
   const auto column_width = getColumnWidth(iter->text);
   recalculateHorizontalBar (column_width, hasBrackets(iter));
 
@@ -1749,6 +1906,573 @@ void FListBox::lazyConvert(FListBoxItems::iterator iter, std::size_t y)
     scroll.hbar->redraw();
 }
 
+//----------------------------------------------------------------------
+auto FListBox::getListItem (std::size_t pos) -> const FListBoxItem&
+{
+  // Returns the converted item at the 0-based position pos
+
+  if ( ! isVirtual() )
+  {
+    auto iter = index2iterator(pos);
+    lazyConvert (iter);
+    return *iter;
+  }
+
+  if ( auto item = virtual_list.cache.find(pos) )
+    return *item;
+
+  const auto& item = getVirtualItem(pos);
+  const auto column_width = getColumnWidth(item.text);
+  recalculateHorizontalBar (column_width, item.brackets != BracketType::None);
+
+  if ( scroll.hbar->isShown() )
+    scroll.hbar->redraw();
+
+  return item;
+}
+
+//----------------------------------------------------------------------
+auto FListBox::getVirtualItem (std::size_t pos) const -> const FListBoxItem&
+{
+  // Converts the item from the source on a cache miss
+
+  if ( auto item = virtual_list.cache.find(pos) )
+    return *item;
+
+  FListBoxItem item{};
+  lazy_inserter (item, data.source_container, pos);
+  const auto state = getVirtualState(pos);
+  item.brackets = state.brackets;
+  item.selected = state.selected;
+  return virtual_list.cache.insert(pos, std::move(item));
+}
+
+//----------------------------------------------------------------------
+auto FListBox::getItemText (std::size_t pos) -> FString
+{
+  // Item text for the search without filling the virtual item cache
+
+  if ( ! isVirtual() )
+    return getListItem(pos).getText();
+
+  if ( auto item = virtual_list.cache.find(pos) )
+    return item->getText();
+
+  FListBoxItem item{};
+  lazy_inserter (item, data.source_container, pos);
+  return item.getText();
+}
+
+//----------------------------------------------------------------------
+auto FListBox::getVirtualState (std::size_t pos) const -> VirtualItemState
+{
+  const auto iter = virtual_list.states.find(pos);
+
+  if ( iter == virtual_list.states.end() )
+    return {};
+
+  return iter->second;
+}
+
+//----------------------------------------------------------------------
+void FListBox::setVirtualState (std::size_t pos, const VirtualItemState& state)
+{
+  // Only items with a non-default state are stored
+
+  if ( state.brackets == BracketType::None && ! state.selected )
+    virtual_list.states.erase(pos);
+  else
+    virtual_list.states[pos] = state;
+
+  if ( auto item = virtual_list.cache.find(pos) )
+  {
+    item->brackets = state.brackets;
+    item->selected = state.selected;
+  }
+}
+
+//----------------------------------------------------------------------
+void FListBox::updateVirtualCacheSize()
+{
+  // The cache holds the visible page and the pages above and below
+
+  static constexpr std::size_t min_cache_size = 64;
+  const auto size = 3 * std::size_t(std::max(int(getHeight()) - 2, 0));
+  virtual_list.cache.setCapacity (std::max(size, min_cache_size));
+}
+
+//----------------------------------------------------------------------
+auto FListBox::itemToRow (std::size_t index) const -> std::size_t
+{
+  // Converts an item number into a visible row. A hidden item
+  // is mapped to the next visible row.
+
+  if ( ! isFiltered() || index == 0 )
+    return index;
+
+  const auto& rows = search.rows;
+  const auto iter = std::lower_bound (rows.cbegin(), rows.cend(), index - 1);
+  return std::size_t(iter - rows.cbegin()) + 1;
+}
+
+//----------------------------------------------------------------------
+auto FListBox::isVisiblePosition (std::size_t pos) const -> bool
+{
+  // pos is the 0-based position in the item list
+
+  if ( ! isFiltered() )
+    return pos < getCount();
+
+  return std::binary_search (search.rows.cbegin(), search.rows.cend(), pos);
+}
+
+//----------------------------------------------------------------------
+void FListBox::buildSearchKeys()
+{
+  // Creates the case-folded key of each item on first use.
+  // Items added or removed via getData() change the item count
+  // and invalidate the keys.
+
+  const auto size = getCount();
+
+  if ( (search.keys_valid && search.keys.size() == size) || isVirtual() )
+    return;
+
+  if ( conv_type == ConvertType::Lazy )
+  {
+    // The lazy converter is not required to be thread-safe
+    for (auto iter = data.itemlist.begin(); iter != data.itemlist.end(); ++iter)
+    {
+      if ( ! iter->getText().isEmpty() )
+        continue;
+
+      const auto index = std::size_t(std::distance(data.itemlist.begin(), iter));
+      lazy_inserter (*iter, data.source_container, index);
+      recalculateHorizontalBar (getColumnWidth(iter->text), hasBrackets(iter));
+    }
+  }
+
+  search.order.clear();  // Sorted again with the new keys
+  search.sorted = 0;
+  search.keys.resize(size);
+  const auto build = [this] (std::size_t begin, std::size_t end)
+  {
+    for (auto i = begin; i < end; i++)
+      search.keys[i] = getListSearchKey(data.itemlist[i].getText());
+  };
+
+  auto pool = ( size >= parallel_filter_size )
+            ? FWorkerPool::getSharedPool()
+            : nullptr;
+
+  if ( pool )
+    pool->parallelFor (0, size, parallel_filter_size / 4, build);
+  else
+    build (0, size);
+
+  search.keys_valid = true;
+}
+
+//----------------------------------------------------------------------
+void FListBox::buildSearchIndex()
+{
+  // Sorts the item positions by key. Appended items are sorted
+  // separately and merged into the already sorted part.
+
+  buildSearchKeys();
+  auto& order = search.order;
+  const auto& keys = search.keys;
+
+  if ( order.size() != keys.size() )
+  {
+    order.resize(keys.size());
+    std::iota (order.begin(), order.end(), std::size_t(0));
+    search.sorted = 0;
+  }
+
+  if ( search.sorted == order.size() )
+    return;
+
+  const auto cmp = [&keys] (std::size_t lhs, std::size_t rhs)
+  {
+    const int result = keys[lhs].compare(keys[rhs]);
+    return result < 0 || (result == 0 && lhs < rhs);
+  };
+
+  const auto middle = order.begin() + std::ptrdiff_t(search.sorted);
+  std::sort (middle, order.end(), cmp);
+  std::inplace_merge (order.begin(), middle, order.end(), cmp);
+  search.sorted = order.size();
+}
+
+//----------------------------------------------------------------------
+void FListBox::addSearchKey (std::size_t pos)
+{
+  // Updates the search data after appending the item at pos
+
+  if ( ! search.keys_valid || search.keys.size() != pos )
+  {
+    if ( isFiltered() )  // The filter needs all keys
+      resetSearchKeys();
+
+    return;
+  }
+
+  lazyConvert (data.itemlist.begin() + std::ptrdiff_t(pos));
+  search.keys.push_back(getListSearchKey(data.itemlist[pos].getText()));
+
+  if ( ! search.order.empty() )
+    search.order.push_back(pos);  // Merged with the next search
+
+  if ( isFiltered()
+    && search.keys.back().find(search.filter_key) != std::wstring::npos )
+    search.rows.push_back(pos);
+}
+
+//----------------------------------------------------------------------
+auto FListBox::removeSearchKey (std::size_t index) -> std::size_t
+{
+  // Updates the search data before removing an item and returns
+  // its visible row (0 = not visible)
+
+  const auto pos = index - 1;
+  std::size_t row{0};
+
+  if ( ! isFiltered() )
+    row = index;
+  else
+  {
+    auto& rows = search.rows;
+    auto iter = std::lower_bound (rows.begin(), rows.end(), pos);
+
+    if ( iter != rows.end() && *iter == pos )
+    {
+      row = std::size_t(iter - rows.begin()) + 1;
+      iter = rows.erase(iter);
+    }
+
+    std::for_each (iter, rows.end(), [] (std::size_t& p) { p--; });
+  }
+
+  if ( ! search.keys_valid )
+    return row;
+
+  if ( search.keys.size() != getCount() )
+  {
+    // The item list was changed via getData()
+    search.keys.clear();
+    search.order.clear();
+    search.sorted = 0;
+    search.keys_valid = false;
+    return row;
+  }
+
+  search.keys.erase (search.keys.begin() + std::ptrdiff_t(pos));
+
+  if ( search.order.empty() )
+    return row;
+
+  // Keeps the order of the remaining positions
+  FItemPositions order{};
+  order.reserve(search.order.size() - 1);
+  std::size_t sorted{0};
+
+  for (std::size_t i{0}; i < search.order.size(); i++)
+  {
+    const auto p = search.order[i];
+
+    if ( p == pos )
+      continue;
+
+    order.push_back(( p > pos ) ? p - 1 : p);
+
+    if ( i < search.sorted )
+      sorted++;
+  }
+
+  search.order.swap(order);
+  search.sorted = sorted;
+  return row;
+}
+
+//----------------------------------------------------------------------
+void FListBox::resetSearchKeys()
+{
+  search.keys.clear();
+  search.order.clear();
+  search.sorted = 0;
+  search.keys_valid = false;
+
+  if ( ! isFiltered() )
+    return;
+
+  search.filter_key.clear();  // Filter all items again
+  changeFilter (search.filter_text, false);
+}
+
+//----------------------------------------------------------------------
+auto FListBox::findPrefixRow (const FString& prefix) -> std::size_t
+{
+  // Returns the first visible row whose text starts with
+  // the prefix (ignoring the case), or 0 if there is none
+
+  const auto key = getListSearchKey(prefix);
+  const auto len = prefix.getLength();
+
+  if ( ! search.index || isVirtual() )
+  {
+    const auto element_count = getVisibleCount();
+
+    for (std::size_t row{1}; row <= element_count; row++)
+    {
+      const auto text = getItemText(rowToItem(row) - 1);
+
+      if ( getListSearchKey(text.left(len)) == key )
+        return row;
+    }
+
+    return 0;
+  }
+
+  buildSearchIndex();
+  const auto& keys = search.keys;
+  const auto& order = search.order;
+  const auto first = std::lower_bound ( order.cbegin(), order.cend(), key
+                                      , [&keys] (std::size_t pos, const std::wstring& k)
+                                        {
+                                          return keys[pos] < k;
+                                        } );
+  const auto last = std::partition_point ( first, order.cend()
+                                         , [&keys, &key] (std::size_t pos)
+                                           {
+                                             return keys[pos].compare(0, key.length(), key) == 0;
+                                           } );
+  std::size_t min_pos{getCount()};
+
+  for (auto iter = first; iter != last; ++iter)
+    if ( *iter < min_pos && isVisiblePosition(*iter) )
+      min_pos = *iter;
+
+  if ( min_pos == getCount() )
+    return 0;
+
+  return itemToRow(min_pos + 1);
+}
+
+//----------------------------------------------------------------------
+auto FListBox::findIndexedItem (const FString& search_text) -> FListBoxItems::iterator
+{
+  // Binary search in the sorted keys followed by an exact comparison
+
+  buildSearchIndex();
+  const auto key = getListSearchKey(search_text);
+  const auto& keys = search.keys;
+  const auto& order = search.order;
+  auto iter = std::lower_bound ( order.cbegin(), order.cend(), key
+                               , [&keys] (std::size_t pos, const std::wstring& k)
+                                 {
+                                   return keys[pos] < k;
+                                 } );
+  std::size_t min_pos{getCount()};
+
+  while ( iter != order.cend() && keys[*iter] == key )
+  {
+    if ( *iter < min_pos && data.itemlist[*iter].getText() == search_text )
+      min_pos = *iter;
+
+    ++iter;
+  }
+
+  if ( min_pos == getCount() )
+    return data.itemlist.end();
+
+  return data.itemlist.begin() + std::ptrdiff_t(min_pos);
+}
+
+//----------------------------------------------------------------------
+auto FListBox::filterItems (const std::wstring& key) -> FItemPositions
+{
+  // Returns the positions of all items that contain the key.
+  // An extended filter text only narrows the current rows.
+
+  const bool narrow = isFiltered()
+                   && ! search.filter_key.empty()
+                   && key.compare(0, search.filter_key.length(), search.filter_key) == 0;
+  const auto& rows = search.rows;
+  FItemPositions result{};
+
+  if ( isVirtual() )
+  {
+    // Converts each item without keeping the search keys
+    const auto size = narrow ? rows.size() : getCount();
+
+    for (std::size_t i{0}; i < size; i++)
+    {
+      const auto pos = narrow ? rows[i] : i;
+
+      if ( getListSearchKey(getItemText(pos)).find(key) != std::wstring::npos )
+        result.push_back(pos);
+    }
+
+    return result;
+  }
+
+  buildSearchKeys();
+  const auto& keys = search.keys;
+  const auto size = narrow ? rows.size() : keys.size();
+  const auto scan = [&keys, &rows, &key, narrow] ( std::size_t begin
+                                                 , std::size_t end
+                                                 , FItemPositions& result )
+  {
+    for (auto i = begin; i < end; i++)
+    {
+      const auto pos = narrow ? rows[i] : i;
+
+      if ( keys[pos].find(key) != std::wstring::npos )
+        result.push_back(pos);
+    }
+  };
+
+  auto pool = ( size >= parallel_filter_size )
+            ? FWorkerPool::getSharedPool()
+            : nullptr;
+
+  if ( ! pool )
+  {
+    scan (0, size, result);
+    return result;
+  }
+
+  // Every band collects its matches, which are joined in order
+  const auto bands = pool->getThreadCount() + 1;  // Workers + caller
+  std::vector<FItemPositions> band_result(bands);
+  pool->parallelFor ( 0, bands, 1
+                    , [&band_result, &scan, size, bands] (std::size_t begin, std::size_t end)
+                      {
+                        for (auto band = begin; band < end; band++)
+                          scan ( size * band / bands
+                               , size * (band + 1) / bands
+                               , band_result[band] );
+                      } );
+  std::size_t count{0};
+
+  for (const auto& band : band_result)
+    count += band.size();
+
+  result.reserve(count);
+
+  for (const auto& band : band_result)
+    result.insert (result.end(), band.cbegin(), band.cend());
+
+  return result;
+}
+
+//----------------------------------------------------------------------
+auto FListBox::changeFilter (const FString& text, bool keep_on_empty) -> bool
+{
+  // Replaces the filter. With keep_on_empty, a filter text
+  // without any match is rejected.
+
+  const auto item_before = currentItem();
+
+  if ( text.isEmpty() )
+  {
+    if ( ! isFiltered() )
+      return true;
+
+    search.rows.clear();
+    search.rows.shrink_to_fit();
+    search.filter_text.clear();
+    search.filter_key.clear();
+  }
+  else
+  {
+    const auto key = getListSearchKey(text);
+    auto rows = filterItems(key);
+
+    if ( rows.empty() && keep_on_empty )
+      return false;
+
+    search.rows.swap(rows);
+    search.filter_text = text;
+    search.filter_key = key;
+  }
+
+  // Keeps the current item when it is still visible
+  if ( item_before > 0 && isVisiblePosition(item_before - 1) )
+    selection.current = itemToRow(item_before);
+  else
+    selection.current = ( getVisibleCount() > 0 ) ? 1 : 0;
+
+  data.inc_search.clear();
+  scroll.yoffset = 0;
+  scroll.last_yoffset = -1;
+  selection.last_current = -1;
+  adjustSize();
+  scroll.vbar->setValue (scroll.yoffset);
+
+  if ( isShown() )
+  {
+    // Clears the lines below the last visible row
+    const auto& wc = getColorTheme();
+    setColor (wc->list.fg, wc->list.bg);
+
+    fillRect (FRect{FPoint{2, 2}, FPoint{int(getWidth()) - 1, int(getHeight()) - 1}});
+
+    redraw();
+    forceTerminalUpdate();
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FListBox::filterInput (wchar_t ch) -> bool
+{
+  FString text{search.filter_text};
+  text += ch;
+
+  if ( changeFilter(text, true) )
+    return true;
+
+  return isFiltered();  // A character without a match is swallowed
+}
+
+//----------------------------------------------------------------------
+auto FListBox::deleteFilterCharacter() -> bool
+{
+  const auto len = search.filter_text.getLength();
+
+  if ( len == 0 )
+    return false;
+
+  changeFilter (search.filter_text.left(len - 1), false);
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FListBox::drawFilterText()
+{
+  // Shows the filter text in the bottom border
+
+  if ( ! isFiltered() || scroll.hbar->isShown() || getWidth() <= 6 )
+    return;
+
+  const auto& wc = getColorTheme();
+  const FString txt{" " + search.filter_text + " "};
+  print() << FPoint{2, int(getHeight())};
+
+  if ( isEnabled() )
+    setColor(wc->label.emphasis_fg, wc->label.bg);
+  else
+    setColor(wc->label.inactive_fg, wc->label.inactive_bg);
+
+  if ( getColumnWidth(txt) <= getClientWidth() )
+    print (txt);
+  else
+    print (getColumnSubString(txt, 1, getClientWidth()));
+}
+
 //----------------------------------------------------------------------
 inline void FListBox::handleSelectionChange (const std::size_t current_before)
 {
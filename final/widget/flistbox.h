@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -49,12 +49,14 @@
 #endif
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "final/fwidget.h"
 #include "final/util/fdata.h"
+#include "final/util/flrucache.h"
 #include "final/widget/fscrollbar.h"
 
 namespace finalcut
@@ -97,7 +99,7 @@ class FListBoxItem
     using FDataAccessPtr = std::shared_ptr<FDataAccess>;
 
     // Methods
-    auto stringFilter(const FString&) const -> FString;
+    static auto stringFilter (const FString&) -> FString;
 
     // Data members
     FString         text{};
@@ -156,7 +158,7 @@ inline void FListBoxItem::clear()
 { text.clear(); }
 
 //----------------------------------------------------------------------
-inline auto FListBoxItem::stringFilter (const FString& txt) const -> FString
+inline auto FListBoxItem::stringFilter (const FString& txt) -> FString
 {
   return txt.rtrim()
             .expandTabs(FVTerm::getFOutput()->getTabstop())
@@ -204,6 +206,7 @@ class FListBox : public FWidget
     // Accessors
     auto getClassName() const -> FString override;
     auto getCount() const -> std::size_t;
+    auto getVisibleCount() const -> std::size_t;
     auto getItem (std::size_t) & -> FListBoxItem&;
     auto getItem (std::size_t) const & -> const FListBoxItem&;
     auto getItem (FListBoxItems::iterator) & -> FListBoxItem&;
@@ -212,6 +215,7 @@ class FListBox : public FWidget
     auto getData() & -> FListBoxItems&;
     auto getData() const & -> const FListBoxItems&;
     auto getText() & -> FString&;
+    auto getFilterText() const -> FString;
 
     // Mutators
     void setCurrentItem (std::size_t);
@@ -229,13 +233,22 @@ class FListBox : public FWidget
     void unsetMultiSelection ();
     void setDisable() override;
     void setText (const FString&);
+    void setSearchIndex (bool = true);
+    void unsetSearchIndex();
+    void setTypeAheadFilter (bool = true);
+    void unsetTypeAheadFilter();
+    void setFilterText (const FString&);
 
     // Inquiries
     auto isSelected (std::size_t) const -> bool;
     auto isSelected (FListBoxItems::iterator) const -> bool;
     auto isMultiSelection() const -> bool;
+    auto isTypeAheadFilter() const -> bool;
+    auto isFiltered() const -> bool;
     auto hasBrackets (std::size_t) const -> bool;
     auto hasBrackets (FListBoxItems::iterator) const -> bool;
+    auto hasSearchIndex() const -> bool;
+    auto isVirtual() const -> bool;
 
     // Methods
     void hide() override;
@@ -248,6 +261,9 @@ class FListBox : public FWidget
     template <typename Container
             , typename LazyConverter>
     void insert (Container*, LazyConverter&&);
+    template <typename Container
+            , typename LazyConverter>
+    void insertVirtual (const Container&, LazyConverter&&);
     void insert (const FListBoxItem&);
     template <typename T
             , typename DT = std::nullptr_t>
@@ -265,6 +281,8 @@ class FListBox : public FWidget
     auto findItem (const FString&) -> FListBoxItems::iterator;
     void reserve (std::size_t);
     void clear();
+    void clearFilter();
+    void clearSearchIndex();
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
@@ -288,6 +306,8 @@ class FListBox : public FWidget
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
     using KeyMapResult = std::unordered_map<FKey, std::function<bool()>, EnumHash<FKey>>;
     using LazyInsert = std::function<void(FListBoxItem&, FDataAccess*, std::size_t)>;
+    using FItemPositions = std::vector<std::size_t>;
+    using FItemCache = FLruCache<std::size_t, FListBoxItem>;
 
     struct ListBoxData
     {
@@ -299,6 +319,35 @@ class FListBox : public FWidget
       KeyMapResult   key_map_result{};
     };
 
+    struct SearchState
+    {
+      std::vector<std::wstring>  keys{};  // Case-folded item texts
+      FItemPositions             order{};  // Item positions sorted by key
+      FItemPositions             rows{};  // Item positions of the filtered rows
+      FString                    filter_text{};
+      std::wstring               filter_key{};
+      std::size_t                sorted{0};  // Sorted part of order
+      bool                       keys_valid{false};
+      bool                       index{false};
+      bool                       type_ahead{false};
+    };
+
+    struct VirtualItemState
+    {
+      BracketType  brackets{BracketType::None};
+      bool         selected{false};
+    };
+
+    using FItemStates = std::unordered_map<std::size_t, VirtualItemState>;
+
+    struct VirtualList
+    {
+      mutable FItemCache  cache{};  // Converted items around the viewport
+      FItemStates         states{};  // Selected items and items in brackets
+      FListBoxItem        item_copy{};  // Item returned by the mutable getItem()
+      std::size_t         count{0};  // Number of items in the source
+    };
+
     struct SelectionState
     {
       std::size_t current{0};
@@ -324,13 +373,14 @@ class FListBox : public FWidget
     // Enumeration
     enum class ConvertType
     {
-      None   = 0,
-      Direct = 1,
-      Lazy   = 2
+      None    = 0,
+      Direct  = 1,
+      Lazy    = 2,
+      Virtual = 3
     };
 
     // Accessors
-    static auto getString (FListBoxItems::iterator) -> FString;
+    static auto getString (const FListBoxItem&) -> FString;
 
     // Inquiry
     auto isHorizontallyScrollable() const -> bool;
@@ -353,10 +403,10 @@ class FListBox : public FWidget
     void updateRedrawParameters (std::size_t&, std::size_t&) const;
     void finalizeDrawing();
     void drawList();
-    void drawListLine (int, FListBoxItems::iterator, bool);
+    void drawListLine (int, const FListBoxItem&, bool);
     void printLeftBracket (BracketType);
     void printRightBracket (BracketType);
-    void drawListBracketsLine (int, FListBoxItems::iterator, bool);
+    void drawListBracketsLine (int, const FListBoxItem&, bool);
     auto getMaxWidth() const ->  std::size_t;
     void printLeftCurrentLineArrow (int);
     void printRightCurrentLineArrow (int);
@@ -415,9 +465,31 @@ class FListBox : public FWidget
     auto getScrollBarMaxHorizontal() const noexcept -> int;
     auto getScrollBarMaxVertical() const noexcept -> int;
     void recalculateMaximumLineWidth();
-    void lazyConvert (FListBoxItems::iterator, std::size_t);
+    void lazyConvert (FListBoxItems::iterator);
+    auto getListItem (std::size_t) -> const FListBoxItem&;
+    auto getVirtualItem (std::size_t) const -> const FListBoxItem&;
+    auto getItemText (std::size_t) -> FString;
+    auto getVirtualState (std::size_t) const -> VirtualItemState;
+    void setVirtualState (std::size_t, const VirtualItemState&);
+    void updateVirtualCacheSize();
     auto index2iterator (std::size_t) -> FListBoxItems::iterator;
     auto index2iterator (std::size_t index) const -> FListBoxItems::const_iterator;
+    auto row2iterator (std::size_t) -> FListBoxItems::iterator;
+    auto rowToItem (std::size_t) const noexcept -> std::size_t;
+    auto itemToRow (std::size_t) const -> std::size_t;
+    auto isVisiblePosition (std::size_t) const -> bool;
+    void buildSearchKeys();
+    void buildSearchIndex();
+    void addSearchKey (std::size_t);
+    auto removeSearchKey (std::size_t) -> std::size_t;
+    void resetSearchKeys();
+    auto findPrefixRow (const FString&) -> std::size_t;
+    auto findIndexedItem (const FString&) -> FListBoxItems::iterator;
+    auto filterItems (const std::wstring&) -> FItemPositions;
+    auto changeFilter (const FString&, bool) -> bool;
+    auto filterInput (wchar_t) -> bool;
+    auto deleteFilterCharacter() -> bool;
+    void drawFilterText();
     void handleSelectionChange (const std::size_t);
     void handleXOffsetChange (const int);
     void handleVerticalScrollBarUpdate (const FScrollbar::ScrollType, const int) const;
@@ -436,6 +508,8 @@ class FListBox : public FWidget
     std::size_t     nf_offset{0};
     std::size_t     max_line_width{0};
     ListBoxData     data{};
+    SearchState     search{};
+    VirtualList     virtual_list{};
     ScrollingState  scroll{};
     SelectionState  selection{};
     ConvertType     conv_type{ConvertType::None};
@@ -492,11 +566,28 @@ inline auto FListBox::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline auto FListBox::getCount() const -> std::size_t
-{ return data.itemlist.size(); }
+{ return isVirtual() ? virtual_list.count : data.itemlist.size(); }
+
+//----------------------------------------------------------------------
+inline auto FListBox::getVisibleCount() const -> std::size_t
+{ return isFiltered() ? search.rows.size() : getCount(); }
 
 //----------------------------------------------------------------------
 inline auto FListBox::getItem (std::size_t index) & -> FListBoxItem&
 {
+  // In virtual mode, the items only exist in a cache of limited size.
+  // The returned item is then a copy that is valid until the next
+  // getItem() call, and changes to it are not stored. Use selectItem(),
+  // unselectItem(), showInsideBrackets() and showNoBrackets() to change
+  // the item state. Changed item texts require a call
+  // to clearSearchIndex().
+
+  if ( isVirtual() )
+  {
+    virtual_list.item_copy = getVirtualItem(index - 1);
+    return virtual_list.item_copy;
+  }
+
   auto iter = index2iterator(index - 1);
   return *iter;
 }
@@ -504,6 +595,12 @@ inline auto FListBox::getItem (std::size_t index) & -> FListBoxItem&
 //----------------------------------------------------------------------
 inline auto FListBox::getItem (std::size_t index) const & -> const FListBoxItem&
 {
+  // In virtual mode, the reference points into the item cache
+  // and is only valid until the next item access
+
+  if ( isVirtual() )
+    return getVirtualItem(index - 1);
+
   auto iter = index2iterator(index - 1);
   return *iter;
 }
@@ -518,11 +615,16 @@ inline auto FListBox::getItem (FListBoxItems::const_iterator iter) const & -> co
 
 //----------------------------------------------------------------------
 inline auto FListBox::currentItem() const noexcept -> std::size_t
-{ return selection.current; }
+{ return rowToItem(selection.current); }
 
 //----------------------------------------------------------------------
 inline auto FListBox::getData() & -> FListBoxItems&
-{ return data.itemlist; }
+{
+  // Added or removed items are detected by the search index.
+  // Changed item texts require a call to clearSearchIndex().
+
+  return data.itemlist;
+}
 
 //----------------------------------------------------------------------
 inline auto FListBox::getData() const & -> const FListBoxItems&
@@ -533,25 +635,17 @@ inline auto FListBox::getText() & -> FString&
 { return data.text; }
 
 //----------------------------------------------------------------------
-inline void FListBox::selectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = true; }
+inline auto FListBox::getFilterText() const -> FString
+{ return search.filter_text; }
 
 //----------------------------------------------------------------------
 inline void FListBox::selectItem (FListBoxItems::iterator iter) const
 { iter->selected = true; }
 
-//----------------------------------------------------------------------
-inline void FListBox::unselectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = false; }
-
 //----------------------------------------------------------------------
 inline void FListBox::unselectItem (FListBoxItems::iterator iter) const
 { iter->selected = false; }
 
-//----------------------------------------------------------------------
-inline void FListBox::showNoBrackets (std::size_t index)
-{ index2iterator(index - 1)->brackets = BracketType::None; }
-
 //----------------------------------------------------------------------
 inline void FListBox::showNoBrackets (FListBoxItems::iterator iter) const
 { iter->brackets = BracketType::None; }
@@ -569,8 +663,16 @@ inline void FListBox::setDisable()
 { setEnable(false); }
 
 //----------------------------------------------------------------------
-inline auto FListBox::isSelected (std::size_t index) const -> bool
-{ return index2iterator(index - 1)->selected; }
+inline void FListBox::unsetSearchIndex()
+{ setSearchIndex(false); }
+
+//----------------------------------------------------------------------
+inline void FListBox::setTypeAheadFilter (bool enable)
+{ search.type_ahead = enable; }
+
+//----------------------------------------------------------------------
+inline void FListBox::unsetTypeAheadFilter()
+{ setTypeAheadFilter(false); }
 
 //----------------------------------------------------------------------
 inline auto FListBox::isSelected (FListBoxItems::iterator iter) const -> bool
@@ -581,17 +683,33 @@ inline auto FListBox::isMultiSelection() const -> bool
 { return selection.multi_select; }
 
 //----------------------------------------------------------------------
-inline auto FListBox::hasBrackets(std::size_t index) const -> bool
-{ return index2iterator(index - 1)->brackets != BracketType::None; }
+inline auto FListBox::isTypeAheadFilter() const -> bool
+{ return search.type_ahead; }
+
+//----------------------------------------------------------------------
+inline auto FListBox::isFiltered() const -> bool
+{ return ! search.filter_text.isEmpty(); }
 
 //----------------------------------------------------------------------
 inline auto FListBox::hasBrackets(FListBoxItems::iterator iter) const -> bool
 { return iter->brackets != BracketType::None; }
 
+//----------------------------------------------------------------------
+inline auto FListBox::hasSearchIndex() const -> bool
+{ return search.index; }
+
+//----------------------------------------------------------------------
+inline auto FListBox::isVirtual() const -> bool
+{ return conv_type == ConvertType::Virtual; }
+
 //----------------------------------------------------------------------
 inline void FListBox::reserve (std::size_t new_cap)
 { data.itemlist.reserve(new_cap); }
 
+//----------------------------------------------------------------------
+inline void FListBox::clearFilter()
+{ setFilterText(FString{}); }
+
 //----------------------------------------------------------------------
 template <typename Iterator
         , typename InsertConverter>
@@ -621,7 +739,8 @@ void FListBox::insert (const Container& container, LazyConverter&& converter)
   if ( size > 0 )
     data.itemlist.resize(size);
 
-  recalculateVerticalBar(size);
+  resetSearchKeys();
+  recalculateVerticalBar(getVisibleCount());
 }
 
 //----------------------------------------------------------------------
@@ -632,6 +751,30 @@ void FListBox::insert (Container* container, LazyConverter&& converter)
   insert (*container, std::forward<LazyConverter>(converter));
 }
 
+//----------------------------------------------------------------------
+template <typename Container
+        , typename LazyConverter>
+void FListBox::insertVirtual (const Container& container, LazyConverter&& converter)
+{
+  // Only the converted items around the viewport are kept in memory.
+  // The selection and the brackets are stored for the changed items.
+
+  conv_type = ConvertType::Virtual;
+  delete data.source_container;
+  data.source_container = makeFData(container);
+  lazy_inserter = std::forward<LazyConverter>(converter);
+  data.itemlist.clear();
+  data.itemlist.shrink_to_fit();
+  virtual_list.cache.clear();
+  virtual_list.states.clear();
+  virtual_list.count = container.size();
+  selection.current = ( virtual_list.count > 0 ) ? 1 : 0;
+  scroll.yoffset = 0;
+  updateVirtualCacheSize();
+  resetSearchKeys();
+  recalculateVerticalBar(getVisibleCount());
+}
+
 //----------------------------------------------------------------------
 template <typename T
         , typename DT>
@@ -669,7 +812,7 @@ inline auto FListBox::isHorizontallyScrollable() const -> bool
 
 //----------------------------------------------------------------------
 inline auto FListBox::isVerticallyScrollable() const -> bool
-{ return getCount() > getClientHeight(); }
+{ return getVisibleCount() > getClientHeight(); }
 
 //----------------------------------------------------------------------
 inline auto FListBox::isCurrentLine (int y) const -> bool
@@ -699,6 +842,21 @@ inline auto \
   return iter;
 }
 
+//----------------------------------------------------------------------
+inline auto FListBox::row2iterator (std::size_t row) -> FListBoxItems::iterator
+{ return index2iterator(rowToItem(row) - 1); }
+
+//----------------------------------------------------------------------
+inline auto FListBox::rowToItem (std::size_t row) const noexcept -> std::size_t
+{
+  // Converts a visible row into an item number (both start at 1)
+
+  if ( ! isFiltered() )
+    return row;
+
+  return ( row > 0 && row <= search.rows.size() ) ? search.rows[row - 1] + 1 : 0;
+}
+
 }  // namespace finalcut
 
 #endif  // FLISTBOX_H
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2017-2024 Markus Gans                                      *
+* Copyright 2017-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -32,6 +32,7 @@
 #include "final/fwidgetcolors.h"
 #include "final/util/emptyfstring.h"
 #include "final/util/fstring.h"
+#include "final/util/fworkerpool.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fvtermbuffer.h"
 #include "final/widget/flistview.h"
@@ -48,6 +49,14 @@ auto sortDescendingByName (const FObject*, const FObject*) -> bool;
 auto sortByNumber (const FObject* lhs, const FObject* rhs) -> int;
 auto sortAscendingByNumber (const FObject*, const FObject*) -> bool;
 auto sortDescendingByNumber (const FObject*, const FObject*) -> bool;
+auto getNameSortKey (const FString&) -> std::wstring;
+template <typename T, typename Compare>
+void parallelSort (std::vector<T>&, Compare, FWorkerPool*);
+template <typename KeyT, typename GetKey>
+void sortByKey (FObject::FObjectList&, GetKey, SortOrder, FWorkerPool*);
+
+// Lists from this size are sorted in parallel
+constexpr std::size_t parallel_sort_size = 16384;
 
 // non-member functions
 //----------------------------------------------------------------------
@@ -168,6 +177,306 @@ auto sortDescendingByNumber (const FObject* lhs, const FObject* rhs) -> bool
   return sortByNumber(lhs, rhs) > 0;
 }
 
+//----------------------------------------------------------------------
+auto getNameSortKey (const FString& str) -> std::wstring
+{
+  // Case-folded key with the same order as FStringCaseCompare()
+
+  std::wstring key{};
+  key.reserve(str.getLength());
+
+  for (const auto& ch : str)
+    key.push_back(wchar_t(std::tolower(ch)));
+
+  return key;
+}
+
+//----------------------------------------------------------------------
+template <typename T, typename Compare>
+void parallelSort (std::vector<T>& list, Compare cmp, FWorkerPool* pool)
+{
+  // Sorts the bands of a large list concurrently
+  // and merges them pairwise into a sorted list
+
+  const auto size = list.size();
+  const std::size_t bands = ( pool && size >= parallel_sort_size )
+                          ? pool->getThreadCount() + 1  // Workers + caller
+                          : 1;
+
+  if ( bands < 2 )
+  {
+    std::sort (list.begin(), list.end(), cmp);
+    return;
+  }
+
+  std::vector<std::size_t> bounds(bands + 1);
+
+  for (std::size_t band{0}; band <= bands; band++)
+    bounds[band] = band * size / bands;
+
+  const auto first = list.begin();
+  const auto at = [&first, &bounds] (std::size_t band)
+  {
+    return first + std::ptrdiff_t(bounds[band]);
+  };
+
+  pool->parallelFor ( 0, bands, 1
+                    , [&at, &cmp] (std::size_t begin, std::size_t end)
+                      {
+                        for (auto band = begin; band < end; band++)
+                          std::sort (at(band), at(band + 1), cmp);
+                      } );
+
+  for (std::size_t width{1}; width < bands; width *= 2)
+  {
+    const auto pairs = (bands + 2 * width - 1) / (2 * width);
+    pool->parallelFor ( 0, pairs, 1
+                      , [&at, &cmp, bands, width] (std::size_t begin, std::size_t end)
+                        {
+                          for (auto pair = begin; pair < end; pair++)
+                          {
+                            const auto lo = pair * 2 * width;
+                            const auto mid = std::min(lo + width, bands);
+                            const auto hi = std::min(lo + 2 * width, bands);
+
+                            if ( mid < hi )
+                              std::inplace_merge (at(lo), at(mid), at(hi), cmp);
+                          }
+                        } );
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename KeyT, typename GetKey>
+void sortByKey ( FObject::FObjectList& list, GetKey get_key
+               , SortOrder order, FWorkerPool* pool )
+{
+  // The sort key of each item is extracted only once before sorting
+
+  using Entry = std::pair<KeyT, FObject*>;
+  const auto size = list.size();
+
+  if ( size < 2 )
+    return;
+
+  if ( size < parallel_sort_size )
+    pool = nullptr;
+
+  std::vector<Entry> entries(size);
+  const auto extract = [&list, &entries, &get_key] ( std::size_t begin
+                                                    , std::size_t end )
+  {
+    for (auto i = begin; i < end; i++)
+    {
+      const auto item = static_cast<const FListViewItem*>(list[i]);
+      entries[i] = Entry{get_key(item), list[i]};
+    }
+  };
+
+  if ( pool )
+    pool->parallelFor (0, size, parallel_sort_size / 4, extract);
+  else
+    extract (0, size);
+
+  if ( order == SortOrder::Descending )
+    parallelSort ( entries
+                 , [] (const Entry& lhs, const Entry& rhs)
+                   { return lhs.first > rhs.first; }
+                 , pool );
+  else
+    parallelSort ( entries
+                 , [] (const Entry& lhs, const Entry& rhs)
+                   { return lhs.first < rhs.first; }
+                 , pool );
+
+  for (std::size_t i{0}; i < size; i++)
+    list[i] = entries[i].second;
+}
+
+
+//----------------------------------------------------------------------
+// class FListViewModel
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FListViewModel::~FListViewModel() noexcept = default;
+
+// public methods of FListViewModel
+//----------------------------------------------------------------------
+auto FListViewModel::getClassName() const -> FString
+{
+  return "FListViewModel";
+}
+
+//----------------------------------------------------------------------
+auto FListViewModel::getColorPair (std::size_t, int) const -> FColorPair
+{
+  return FColorPair{};  // Default colors use the list colors
+}
+
+//----------------------------------------------------------------------
+auto FListViewModel::getChildCount (std::size_t) const -> std::size_t
+{
+  return 0;
+}
+
+//----------------------------------------------------------------------
+auto FListViewModel::getDepth (std::size_t) const -> uInt
+{
+  return 0;
+}
+
+//----------------------------------------------------------------------
+auto FListViewModel::isExpand (std::size_t) const -> bool
+{
+  return false;
+}
+
+//----------------------------------------------------------------------
+void FListViewModel::expand (std::size_t)
+{ }
+
+//----------------------------------------------------------------------
+void FListViewModel::collapse (std::size_t)
+{ }
+
+//----------------------------------------------------------------------
+void FListViewModel::sort (int, SortOrder)
+{ }
+
+
+//----------------------------------------------------------------------
+// class FListViewLineIndex
+//----------------------------------------------------------------------
+
+// public methods of FListViewLineIndex
+//----------------------------------------------------------------------
+auto FListViewLineIndex::getOffset ( const FObjectList& list
+                                   , const FListViewItem* item ) -> std::size_t
+{
+  // Returns the number of visible lines in front of the item
+
+  if ( ! isIndexOf(list, item) )
+    build(list);
+
+  return sum(item->list_index);
+}
+
+//----------------------------------------------------------------------
+auto FListViewLineIndex::find ( const FObjectList& list
+                              , std::size_t offset ) -> LinePosition
+{
+  // Returns the list index of the item that contains the line
+  // offset and the remaining line offset within this item
+
+  if ( tree.size() != list.size() )
+    build(list);
+
+  const std::size_t size = tree.size();
+  std::size_t index{0};
+  std::size_t step{1};
+
+  while ( (step << 1) <= size )
+    step <<= 1;
+
+  for (; step > 0; step >>= 1)
+  {
+    const auto next = index + step;
+
+    if ( next <= size && tree[next - 1] <= offset )
+    {
+      index = next;
+      offset -= tree[next - 1];
+    }
+  }
+
+  return { index, offset };
+}
+
+//----------------------------------------------------------------------
+void FListViewLineIndex::append (const FObjectList& list, FListViewItem* item)
+{
+  // The item was added to the end of the list
+
+  const std::size_t size = tree.size();
+
+  if ( size + 1 != list.size() )
+  {
+    clear();  // Rebuild on the next access
+    return;
+  }
+
+  const std::size_t node = size + 1;
+  const std::size_t range = node & (~node + 1);
+  tree.push_back (item->visible_lines + sum(size) - sum(node - range));
+  item->list_index = size;
+}
+
+//----------------------------------------------------------------------
+void FListViewLineIndex::update ( const FObjectList& list
+                                , const FListViewItem* item
+                                , std::ptrdiff_t diff )
+{
+  // The number of visible lines of the item has changed by diff
+
+  if ( ! isIndexOf(list, item) )
+  {
+    clear();  // Rebuild on the next access
+    return;
+  }
+
+  for (auto node = item->list_index + 1; node <= tree.size(); node += node & (~node + 1))
+    tree[node - 1] += std::size_t(diff);
+}
+
+
+// private methods of FListViewLineIndex
+//----------------------------------------------------------------------
+auto FListViewLineIndex::isIndexOf ( const FObjectList& list
+                                   , const FListViewItem* item ) const -> bool
+{
+  return tree.size() == list.size()
+      && item->list_index < list.size()
+      && list[item->list_index] == item;
+}
+
+//----------------------------------------------------------------------
+void FListViewLineIndex::build (const FObjectList& list)
+{
+  const std::size_t size = list.size();
+  tree.resize(size);
+
+  for (std::size_t i{0}; i < size; i++)
+  {
+    auto item = static_cast<FListViewItem*>(list[i]);
+    item->list_index = i;
+    tree[i] = item->visible_lines;
+  }
+
+  // Add every node to its parent node in linear time
+  for (std::size_t node{1}; node <= size; node++)
+  {
+    const auto parent = node + (node & (~node + 1));
+
+    if ( parent <= size )
+      tree[parent - 1] += tree[node - 1];
+  }
+}
+
+//----------------------------------------------------------------------
+auto FListViewLineIndex::sum (std::size_t count) const -> std::size_t
+{
+  // Sum of the visible lines of the first count items
+
+  std::size_t result{0};
+
+  for (auto node = count; node > 0; node -= node & (~node + 1))
+    result += tree[node - 1];
+
+  return result;
+}
+
 
 //----------------------------------------------------------------------
 // class FListViewItem
@@ -185,11 +494,11 @@ FListViewItem::FListViewItem (const FListViewItem& item)
   if ( ! parent )
     return;
 
-  if ( parent->isInstanceOf("FListView") )
+  if ( parent->isInstanceOf<FListView>() )
   {
     static_cast<FListView*>(parent)->insert (this);
   }
-  else if ( parent->isInstanceOf("FListViewItem") )
+  else if ( parent->isInstanceOf<FListViewItem>() )
   {
     static_cast<FListViewItem*>(parent)->insert (this);
   }
@@ -214,11 +523,11 @@ FListViewItem::~FListViewItem()  // destructor
 
   try
   {
-    if ( parent->isInstanceOf("FListView") )
+    if ( parent->isInstanceOf<FListView>() )
     {
       static_cast<FListView*>(parent)->remove (this);
     }
-    else if ( parent->isInstanceOf("FListViewItem") )
+    else if ( parent->isInstanceOf<FListViewItem>() )
     {
       static_cast<FListViewItem*>(parent)->remove (this);
     }
@@ -260,7 +569,7 @@ auto FListViewItem::getDepth() const -> uInt
 {
   const auto& parent = getParent();
 
-  if ( parent && parent->isInstanceOf("FListViewItem") )
+  if ( parent && parent->isInstanceOf<FListViewItem>() )
   {
     const auto& parent_item = static_cast<FListViewItem*>(parent);
     return parent_item->getDepth() + 1;
@@ -281,7 +590,7 @@ void FListViewItem::setText (int column, const FString& text)
   const auto index = std::size_t(column - 1);
   auto parent = getParent();
 
-  if ( parent && parent->isInstanceOf("FListView") )
+  if ( parent && parent->isInstanceOf<FListView>() )
   {
     auto listview = static_cast<FListView*>(parent);
 
@@ -295,6 +604,13 @@ void FListViewItem::setText (int column, const FString& text)
   }
 
   column_list[index] = text;
+
+  // The item may no longer be at its sorted position
+  while ( parent && parent->isInstanceOf<FListViewItem>() )
+    parent = parent->getParent();
+
+  if ( parent && parent->isInstanceOf<FListView>() )
+    static_cast<FListView*>(parent)->sorting.is_sorted = false;
 }
 
 //----------------------------------------------------------------------
@@ -316,14 +632,14 @@ auto FListViewItem::insert ( FListViewItem* child
 
   if ( *parent_iter )
   {
-    if ( (*parent_iter)->isInstanceOf("FListView") )
+    if ( (*parent_iter)->isInstanceOf<FListView>() )
     {
       // Add FListViewItem to a FListView parent
       auto parent = static_cast<FListView*>(*parent_iter);
       return parent->insert (child);
     }
 
-    if ( (*parent_iter)->isInstanceOf("FListViewItem") )
+    if ( (*parent_iter)->isInstanceOf<FListViewItem>() )
     {
       // Add FListViewItem to a FListViewItem parent
       auto parent = static_cast<FListViewItem*>(*parent_iter);
@@ -343,7 +659,7 @@ void FListViewItem::remove (FListViewItem* item) const
   auto parent = item->getParent();
 
   // Search for a FListView parent in my object tree
-  while ( parent && ! parent->isInstanceOf("FListView") )
+  while ( parent && ! parent->isInstanceOf<FListView>() )
   {
     parent = parent->getParent();
   }
@@ -351,23 +667,15 @@ void FListViewItem::remove (FListViewItem* item) const
   if ( parent == nullptr )
     return;
 
-  if ( parent->isInstanceOf("FListView") )
+  if ( parent->isInstanceOf<FListView>() )
   {
     auto listview = static_cast<FListView*>(parent);
     listview->remove(item);
   }
   else
   {
-    parent = item->getParent();
-    parent->delChild(item);
-    auto parent_item = static_cast<FListViewItem*>(parent);
-    parent_item->visible_lines--;
-
-    if ( ! parent_item->hasChildren() )
-    {
-      parent_item->expandable = false;
-      parent_item->is_expand = false;
-    }
+    auto parent_item = static_cast<FListViewItem*>(item->getParent());
+    parent_item->removeChildItem(item);
   }
 }
 
@@ -377,8 +685,9 @@ void FListViewItem::expand()
   if ( isExpand() || ! hasChildren() )
     return;
 
-  resetVisibleLineCounter();
   is_expand = true;
+  visible_lines += child_lines;
+  changeVisibleLines (std::ptrdiff_t(child_lines));
 }
 
 //----------------------------------------------------------------------
@@ -387,14 +696,15 @@ void FListViewItem::collapse()
   if ( ! isExpand() )
     return;
 
-  resetVisibleLineCounter();
   is_expand = false;
+  visible_lines -= child_lines;
+  changeVisibleLines (-std::ptrdiff_t(child_lines));
 }
 
 // private methods of FListView
 //----------------------------------------------------------------------
-template <typename Compare>
-void FListViewItem::sort (Compare cmp)
+template <typename Sorter>
+void FListViewItem::sort (Sorter sort_list)
 {
   if ( ! isExpandable() )
     return;
@@ -403,20 +713,23 @@ void FListViewItem::sort (Compare cmp)
   auto& children = getChildren();
 
   if ( ! children.empty() )
-    std::sort(children.begin(), children.end(), cmp);
+    sort_list(children);
+
+  line_index.clear();  // Rebuild on the next access
 
   // Sort the sublevels
   for (auto&& item : children)
-    static_cast<FListViewItem*>(item)->sort(cmp);
+    static_cast<FListViewItem*>(item)->sort(sort_list);
 }
 
 //----------------------------------------------------------------------
 auto FListViewItem::appendItem (FListViewItem* child) -> FObject::iterator
 {
   expandable = true;
-  resetVisibleLineCounter();
   child->root = root;
   addChild (child);
+  line_index.append (getChildren(), child);
+  addChildLines (std::ptrdiff_t(child->visible_lines));
   // Return iterator to child/last element
   return --FObject::end();
 }
@@ -435,52 +748,68 @@ void FListViewItem::replaceControlCodes()
 }
 
 //----------------------------------------------------------------------
-auto FListViewItem::getVisibleLines() -> std::size_t
+void FListViewItem::setCheckable (bool enable)
 {
-  if ( visible_lines > 1 )
-    return visible_lines;
+  checkable = enable;
 
-  visible_lines = 1;
+  if ( *root )
+  {
+    auto root_obj = static_cast<FListView*>(*root);
 
-  if ( ! isExpand() || ! hasChildren() )
-    return visible_lines;
+    if ( ! root_obj->hasCheckableItems() && isCheckable() )
+      root_obj->has_checkable_items = true;
+  }
+}
 
-  auto iter = FObject::cbegin();
+//----------------------------------------------------------------------
+void FListViewItem::removeChildItem (FListViewItem* item)
+{
+  delChild(item);
+  line_index.clear();  // Rebuild on the next access
+  addChildLines (-std::ptrdiff_t(item->visible_lines));
 
-  while ( iter != FObject::cend() )
-  {
-    const auto& child = static_cast<FListViewItem*>(*iter);
-    visible_lines += child->getVisibleLines();
-    ++iter;
-  }
+  if ( hasChildren() )
+    return;
 
-  return visible_lines;
+  expandable = false;
+  is_expand = false;
 }
 
 //----------------------------------------------------------------------
-void FListViewItem::setCheckable (bool enable)
+void FListViewItem::addChildLines (std::ptrdiff_t diff)
 {
-  checkable = enable;
+  // The number of visible lines of a child item has changed
 
-  if ( *root )
-  {
-    auto root_obj = static_cast<FListView*>(*root);
+  child_lines += std::size_t(diff);
 
-    if ( ! root_obj->hasCheckableItems() && isCheckable() )
-      root_obj->has_checkable_items = true;
-  }
+  if ( ! isExpand() )
+    return;
+
+  visible_lines += std::size_t(diff);
+  changeVisibleLines (diff);
 }
 
 //----------------------------------------------------------------------
-void FListViewItem::resetVisibleLineCounter()
+void FListViewItem::changeVisibleLines (std::ptrdiff_t diff)
 {
-  visible_lines = 0;
+  // Passes a change in the number of visible lines to the parent
+
   auto parent = getParent();
 
-  if ( parent && parent->isInstanceOf("FListViewItem") )
+  if ( ! parent || diff == 0 )
+    return;
+
+  if ( parent->isInstanceOf<FListView>() )
+  {
+    auto& listdata = static_cast<FListView*>(parent)->data;
+    listdata.visible_lines += std::size_t(diff);
+    listdata.line_index.update (listdata.itemlist, this, diff);
+  }
+  else if ( parent->isInstanceOf<FListViewItem>() )
   {
     auto parent_item = static_cast<FListViewItem*>(parent);
-    return parent_item->resetVisibleLineCounter();
+    parent_item->line_index.update (parent_item->getChildren(), this, diff);
+    parent_item->addChildLines (diff);
   }
 }
 
@@ -495,6 +824,12 @@ FListViewIterator::FListViewIterator (Iterator iter)
   : node{iter}
 { }
 
+//----------------------------------------------------------------------
+FListViewIterator::FListViewIterator (int row)
+  : position{row}
+  , row_only{true}
+{ }
+
 // FListViewIterator operators
 //----------------------------------------------------------------------
 auto FListViewIterator::operator = (Iterator iter) -> FListViewIterator&
@@ -502,13 +837,18 @@ auto FListViewIterator::operator = (Iterator iter) -> FListViewIterator&
   iter_path = IteratorStack{};
   node = iter;
   position = 0;
+  row_only = false;
   return *this;
 }
 
 //----------------------------------------------------------------------
 auto FListViewIterator::operator ++ () -> FListViewIterator&  // prefix
 {
-  nextElement(node);
+  if ( row_only )
+    position++;
+  else
+    nextElement(node);
+
   return *this;
 }
 
@@ -523,7 +863,11 @@ auto FListViewIterator::operator ++ (int) -> FListViewIterator  // postfix
 //----------------------------------------------------------------------
 auto FListViewIterator::operator -- () -> FListViewIterator&  // prefix
 {
-  prevElement(node);
+  if ( row_only )
+    position--;
+  else
+    prevElement(node);
+
   return *this;
 }
 
@@ -538,6 +882,15 @@ auto FListViewIterator::operator -- (int) -> FListViewIterator  // postfix
 //----------------------------------------------------------------------
 auto FListViewIterator::operator += (int n) -> FListViewIterator&
 {
+  if ( row_only )
+  {
+    position += n;
+    return *this;
+  }
+
+  if ( n > 1 && seek(n) )
+    return *this;
+
   for (int i = n; i > 0 ; i--)
     nextElement(node);
 
@@ -547,6 +900,22 @@ auto FListViewIterator::operator += (int n) -> FListViewIterator&
 //----------------------------------------------------------------------
 auto FListViewIterator::operator -= (int n) -> FListViewIterator&
 {
+  if ( row_only )
+  {
+    position -= n;
+    return *this;
+  }
+
+  if ( n > 1 )
+  {
+    prevElement(node);  // The node could be the end of the list
+
+    if ( seek(1 - n) )
+      return *this;
+
+    n--;
+  }
+
   for (int i = n; i > 0 ; i--)
     prevElement(node);
 
@@ -628,6 +997,64 @@ void FListViewIterator::prevElement (Iterator& iter)
   }
 }
 
+//----------------------------------------------------------------------
+auto FListViewIterator::seek (int distance) -> bool
+{
+  // Moves the iterator by distance lines in O(depth * log n) time
+  // with the line indexes of the list view and its parent items
+
+  const auto* item = static_cast<FListViewItem*>(*node);
+
+  if ( ! item )
+    return false;
+
+  // Determine the line offset of the current node
+  const FListViewItem* child = item;
+  auto parent = item->getParent();
+  std::size_t offset{0};
+
+  while ( parent && parent->isInstanceOf<FListViewItem>() )
+  {
+    auto parent_item = static_cast<FListViewItem*>(parent);
+    offset += 1 + parent_item->line_index.getOffset ( parent_item->getChildren()
+                                                    , child );
+    child = parent_item;
+    parent = parent_item->getParent();
+  }
+
+  if ( ! parent || ! parent->isInstanceOf<FListView>() )
+    return false;
+
+  auto& listdata = static_cast<FListView*>(parent)->data;
+  offset += listdata.line_index.getOffset (listdata.itemlist, child);
+  const auto count = std::ptrdiff_t(listdata.visible_lines);
+  auto target = std::ptrdiff_t(offset) + distance;
+  target = std::max(std::min(target, count), std::ptrdiff_t(0));
+  position += int(target - std::ptrdiff_t(offset));
+  iter_path = IteratorStack{};
+
+  if ( target == count )
+  {
+    node = listdata.itemlist.end();
+    return true;
+  }
+
+  // Descend into the subtree that contains the target line
+  auto found = listdata.line_index.find (listdata.itemlist, std::size_t(target));
+  node = listdata.itemlist.begin() + std::ptrdiff_t(found.first);
+
+  while ( found.second > 0 )
+  {
+    auto parent_item = static_cast<FListViewItem*>(*node);
+    iter_path.push(node);
+    found = parent_item->line_index.find ( parent_item->getChildren()
+                                         , found.second - 1 );
+    node = parent_item->begin() + std::ptrdiff_t(found.first);
+  }
+
+  return true;
+}
+
 //----------------------------------------------------------------------
 void FListViewIterator::parentElement()
 {
@@ -663,15 +1090,10 @@ FListView::~FListView()  // destructor
 //----------------------------------------------------------------------
 auto FListView::getCount() const -> std::size_t
 {
-  std::size_t n{0};
+  if ( hasModel() )
+    return model->getRowCount();
 
-  for (auto&& item : data.itemlist)
-  {
-    const auto& listitem = static_cast<FListViewItem*>(item);
-    n += listitem->getVisibleLines();
-  }
-
-  return n;
+  return data.visible_lines;
 }
 
 //----------------------------------------------------------------------
@@ -782,6 +1204,7 @@ void FListView::setColumnSortType (int column, SortType type)
     sorting.type.resize(size);
 
   sorting.type[uInt(column)] = type;
+  sorting.is_sorted = false;
 }
 
 //----------------------------------------------------------------------
@@ -794,6 +1217,23 @@ void FListView::setColumnSort (int column, SortOrder order)
 
   sorting.column = column;
   sorting.order = order;
+  sorting.is_sorted = false;
+}
+
+//----------------------------------------------------------------------
+void FListView::setModel (FListViewModel* list_model)
+{
+  // Sets the data source of a virtual list view. The list view does not
+  // take ownership of the model. A nullptr returns to the item list.
+
+  if ( model == list_model )
+    return;
+
+  model = list_model;
+  resetView();
+  sort();  // Sort by the active sort column
+  updateLayout();
+  processChanged();
 }
 
 //----------------------------------------------------------------------
@@ -869,6 +1309,7 @@ auto FListView::removeColumn (int column) -> int
   }
 
   data.header.erase (data.header.begin() + column - 1);
+  sorting.is_sorted = false;
   max_line_width = 0;
   auto iter = data.itemlist.begin();
 
@@ -881,8 +1322,8 @@ auto FListView::removeColumn (int column) -> int
     ++iter;
   }
 
-  selection.current_iter = data.itemlist.begin();
-  scroll.first_visible_line = data.itemlist.begin();
+  selection.current_iter = getListBegin();
+  scroll.first_visible_line = getListBegin();
   adjustScrollbars(getCount());
   drawList();
   drawBorder();
@@ -927,13 +1368,13 @@ auto FListView::insert ( FListViewItem* item
   }
   else if ( *parent_iter )
   {
-    if ( (*parent_iter)->isInstanceOf("FListView") )
+    if ( (*parent_iter)->isInstanceOf<FListView>() )
     {
       // Add FListViewItem to a FListView parent
       auto parent = static_cast<FListView*>(*parent_iter);
       item_iter = parent->appendItem (item);
     }
-    else if ( (*parent_iter)->isInstanceOf("FListViewItem") )
+    else if ( (*parent_iter)->isInstanceOf<FListViewItem>() )
     {
       // Add FListViewItem to a FListViewItem parent
       auto parent = static_cast<FListViewItem*>(*parent_iter);
@@ -945,7 +1386,8 @@ auto FListView::insert ( FListViewItem* item
   else
     item_iter = getNullIterator();
 
-  afterInsertion();  // post-processing
+  if ( item_iter != getNullIterator() )
+    afterInsertion(item);  // post-processing
   return item_iter;
 }
 
@@ -955,8 +1397,16 @@ void FListView::remove (FListViewItem* item)
   if ( ! item || isItemListEmpty() )
     return;
 
+  if ( hasModel() )
+  {
+    // The items are not shown in model mode
+    removeItemFromParent (item);
+    return;
+  }
+
   adjustListBeforeRemoval (item);
   removeItemFromParent (item);
+  selection.current_iter.getPosition()--;
   updateListAfterRemoval();
   processChanged();
 }
@@ -964,7 +1414,19 @@ void FListView::remove (FListViewItem* item)
 //----------------------------------------------------------------------
 void FListView::clear()
 {
+  // Detaches all items at once and frees them
+  auto items = std::move(data.itemlist);
   data.itemlist.clear();
+  data.line_index.clear();
+  data.visible_lines = 0;
+  delChildren(items);
+
+  for (auto&& item : items)
+    delete item;
+
+  if ( hasModel() )
+    return;
+
   selection.current_iter = getNullIterator();
   scroll.first_visible_line = getNullIterator();
   scroll.last_visible_line = getNullIterator();
@@ -979,42 +1441,98 @@ void FListView::clear()
 }
 
 //----------------------------------------------------------------------
-void FListView::sort()
+void FListView::rowsInserted (std::size_t row, std::size_t count)
 {
-  // Sorts the list view according to the specified setting
+  // The model has inserted count rows before the given row
 
-  if ( sorting.column < 1 || sorting.column > int(data.header.size()) )
+  if ( ! hasModel() || count == 0 )
+    return;
+
+  if ( getCount() == count )  // The list was empty
+    resetView();
+  else
+  {
+    for (auto* iter : { &selection.current_iter
+                      , &scroll.first_visible_line
+                      , &scroll.last_visible_line })
+    {
+      if ( iter->getPosition() >= int(row) )
+        *iter += int(count);
+    }
+  }
+
+  updateModelView();
+}
+
+//----------------------------------------------------------------------
+void FListView::rowsRemoved (std::size_t row, std::size_t count)
+{
+  // The model has removed count rows starting at the given row
+
+  if ( ! hasModel() || count == 0 )
     return;
 
-  SortType column_sort_type = getColumnSortType(sorting.column);
-  std::function<bool(const FObject*, const FObject*)> comparator;
+  const auto last_row = std::max(int(getCount()) - 1, 0);
 
-  switch ( column_sort_type )
+  for (auto* iter : { &selection.current_iter
+                    , &scroll.first_visible_line
+                    , &scroll.last_visible_line })
   {
-    case SortType::Unknown:
-    case SortType::Name:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? sortAscendingByName
-                 : sortDescendingByName;
-      break;
+    const int position = iter->getPosition();
 
-    case SortType::Number:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? sortAscendingByNumber
-                 : sortDescendingByNumber;
-      break;
+    if ( position >= int(row + count) )
+      *iter -= int(count);
+    else if ( position > int(row) )
+      *iter -= position - int(row);
 
-    case SortType::UserDefined:
-      comparator = ( sorting.order == SortOrder::Ascending )
-                 ? user_defined_ascending
-                 : user_defined_descending;
-      break;
+    if ( iter->getPosition() > last_row )
+      *iter = FListViewIterator{last_row};
+  }
 
-    default:
-      throw std::invalid_argument{"Invalid sort type"};
+  updateModelView();
+}
+
+//----------------------------------------------------------------------
+void FListView::rowsChanged (std::size_t row, std::size_t count)
+{
+  // The model has changed the data of count rows
+
+  if ( ! hasModel() || count == 0 )
+    return;
+
+  const auto first = std::size_t(scroll.first_visible_line.getPosition());
+  const auto last = std::size_t(scroll.last_visible_line.getPosition());
+
+  if ( row > last || row + count <= first )  // Not visible
+  {
+    processChanged();
+    return;
+  }
+
+  if ( isShown() )
+    drawList();
+
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FListView::sort()
+{
+  // Sorts the list view according to the specified setting
+
+  if ( sorting.column < 1 || sorting.column > int(data.header.size()) )
+    return;
+
+  if ( hasModel() )
+  {
+    model->sort (sorting.column, sorting.order);
+    resetView();
+    processChanged();
+    return;
   }
 
-  sort(std::move(comparator));
+  sort(getListSorter());
+  sorting.is_sorted = true;
   selection.current_iter = data.itemlist.begin();
   scroll.first_visible_line = data.itemlist.begin();
   processChanged();
@@ -1057,7 +1575,7 @@ void FListView::onMouseDown (FMouseEvent* ev)
   {
     selection.clicked_header_pos = ev->getPos();  // Handle events in the header
   }
-  else if ( isWithinListBounds(ev->getPos()) && ! isItemListEmpty() )
+  else if ( isWithinListBounds(ev->getPos()) && ! isListEmpty() )
   {
     handleListEvent(ev);  // Handle events in the list
   }
@@ -1088,7 +1606,7 @@ void FListView::onMouseUp (FMouseEvent* ev)
     return;
   }
 
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   handleTreeExpanderClick(ev);
@@ -1147,14 +1665,12 @@ void FListView::onMouseDoubleClick (FMouseEvent* ev)
     if ( scroll.first_visible_line.getPosition() + ev->getY() - 1 > int(getCount()) )
       return;
 
-    if ( isItemListEmpty() )
+    if ( isListEmpty() )
       return;
 
-    auto item = getCurrentItem();
-
-    if ( isTreeView() && item->isExpandable() )
+    if ( isTreeView() && isCurrentExpandable() )
     {
-      toggleItemExpandState(item);
+      toggleExpandState();
       adjustScrollbars (getCount());  // after expand or collapse
 
       if ( isShown() )
@@ -1249,7 +1765,7 @@ void FListView::adjustViewport (const int element_count)
 
   if ( element_count < height )
   {
-    scroll.first_visible_line = data.itemlist.begin();
+    scroll.first_visible_line = getListBegin();
     scroll.last_visible_line = scroll.first_visible_line + element_count - 1;
   }
 
@@ -1403,15 +1919,92 @@ void FListView::processKeyAction (FKeyEvent* ev)
 }
 
 //----------------------------------------------------------------------
-template <typename Compare>
-void FListView::sort (Compare cmp)
+template <typename Sorter>
+void FListView::sort (Sorter sort_list)
+{
+  // Sort the top level
+  sort_list(data.itemlist);
+  data.line_index.clear();  // Rebuild on the next access
+
+  // Sort the sublevels
+  for (auto&& item : data.itemlist)
+    static_cast<FListViewItem*>(item)->sort(sort_list);
+}
+
+//----------------------------------------------------------------------
+auto FListView::getItemComparator() const
+    -> std::function<bool(const FObject*, const FObject*)>
+{
+  // Returns the item comparison function of the sort column
+
+  const bool ascending = sorting.order == SortOrder::Ascending;
+
+  switch ( getColumnSortType(sorting.column) )
+  {
+    case SortType::Unknown:
+    case SortType::Name:
+      return ascending ? sortAscendingByName : sortDescendingByName;
+
+    case SortType::Number:
+      return ascending ? sortAscendingByNumber : sortDescendingByNumber;
+
+    case SortType::UserDefined:
+      return ascending ? user_defined_ascending : user_defined_descending;
+
+    default:
+      throw std::invalid_argument{"Invalid sort type"};
+  }
+}
+
+//----------------------------------------------------------------------
+auto FListView::getListSorter() const -> std::function<void(FObjectList&)>
 {
-  // Sort the top level
-  std::sort(data.itemlist.begin(), data.itemlist.end(), cmp);
+  // Returns a function that sorts a list of sibling items.
+  // Name and number columns sort by precomputed keys.
 
-  // Sort the sublevels
-  for (auto&& item : data.itemlist)
-    static_cast<FListViewItem*>(item)->sort(cmp);
+  const int column = sorting.column;
+  const auto order = ( sorting.order == SortOrder::Ascending )
+                   ? SortOrder::Ascending
+                   : SortOrder::Descending;
+
+  switch ( getColumnSortType(column) )
+  {
+    case SortType::Unknown:
+    case SortType::Name:
+      return [column, order] (FObjectList& list)
+             {
+               sortByKey<std::wstring> ( list
+                                       , [column] (const FListViewItem* item)
+                                         {
+                                           return getNameSortKey(item->getText(column));
+                                         }
+                                       , order, FWorkerPool::getSharedPool() );
+             };
+
+    case SortType::Number:
+      return [column, order] (FObjectList& list)
+             {
+               sortByKey<uInt64> ( list
+                                 , [column] (const FListViewItem* item)
+                                   {
+                                     return firstNumberFromString(item->getText(column));
+                                   }
+                                 , order, FWorkerPool::getSharedPool() );
+             };
+
+    case SortType::UserDefined:
+    {
+      // The user-defined comparison is not required to be thread-safe
+      auto cmp = getItemComparator();
+      return [cmp] (FObjectList& list)
+             {
+               std::sort (list.begin(), list.end(), cmp);
+             };
+    }
+
+    default:
+      throw std::invalid_argument{"Invalid sort type"};
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1443,7 +2036,7 @@ auto FListView::getListEnd (const FListViewItem* item) -> FObject::iterator
   if ( this == parent )
     return data.itemlist.end();
 
-  if ( parent->isInstanceOf("FListViewItem") )
+  if ( parent->isInstanceOf<FListViewItem>() )
     return static_cast<FListViewItem*>(parent)->end();
 
   return getNullIterator();
@@ -1452,7 +2045,7 @@ auto FListView::getListEnd (const FListViewItem* item) -> FObject::iterator
 //----------------------------------------------------------------------
 void FListView::draw()
 {
-  if ( selection.current_iter.getPosition() < 1 )
+  if ( ! hasModel() && selection.current_iter.getPosition() < 1 )
     selection.current_iter = data.itemlist.begin();
 
   useParentWidgetColor();
@@ -1537,6 +2130,12 @@ void FListView::drawList()
   if ( canSkipListDrawing() )
     return;
 
+  if ( hasModel() )
+  {
+    drawModelList();
+    return;
+  }
+
   int y{0};
   const auto page_height = int(getHeight()) - 2;
   const auto& itemlist_end = data.itemlist.end();
@@ -1554,7 +2153,7 @@ void FListView::drawList()
     drawListLine (item, getFlags().focus.focus, is_current_line);
 
     // Place the input cursor at the beginning of the line
-    setInputCursor (item, y, is_current_line);
+    setInputCursor (item->getDepth(), item->isCheckable(), y, is_current_line);
 
     scroll.last_visible_line = iter;
     y++;
@@ -1565,20 +2164,46 @@ void FListView::drawList()
 }
 
 //----------------------------------------------------------------------
-inline void FListView::setInputCursor ( const FListViewItem* item
+void FListView::drawModelList()
+{
+  // Only the visible rows are requested from the model
+
+  int y{0};
+  const auto page_height = int(getHeight()) - 2;
+  const auto row_count = int(model->getRowCount());
+  const int current_row = selection.current_iter.getPosition();
+  int row = scroll.first_visible_line.getPosition();
+
+  while ( row < row_count && y < page_height )
+  {
+    const auto is_current_line = bool( row == current_row );
+    print() << FPoint{2, 2 + y};
+    drawModelLine (std::size_t(row), getFlags().focus.focus, is_current_line);
+    setInputCursor ( model->getDepth(std::size_t(row)), false
+                   , y, is_current_line );
+    y++;
+    row++;
+  }
+
+  scroll.last_visible_line = FListViewIterator{std::max(row - 1, 0)};
+  finalizeListDrawing(y);
+}
+
+//----------------------------------------------------------------------
+inline void FListView::setInputCursor ( uInt depth, bool is_checkable
                                       , int y, bool is_current_line )
 {
   if ( ! (getFlags().focus.focus && is_current_line) )
     return;
 
-  const int tree_offset = isTreeView() ? int(item->getDepth() << 1u) + 1 : 0;
-  const int checkbox_offset = item->isCheckable() ? 1 : 0;
+  const int tree_offset = isTreeView() ? int(depth << 1u) + 1 : 0;
+  const int checkbox_offset = is_checkable ? 1 : 0;
   int xpos = 3 + tree_offset + checkbox_offset - scroll.xoffset;
 
   if ( xpos < 2 )  // Hide the cursor
     xpos = -9999;  // by moving it outside the visible area
 
-  setVisibleCursor (item->isCheckable());
+  setVisibleCursor (is_checkable);
   setCursorPos ({xpos, 2 + y});  // first character
 }
 
@@ -1592,12 +2217,8 @@ inline void FListView::finalizeListDrawing (int y)
     setReverse(true);
 
   // Clean empty space after last element
-  while ( y < int(getClientHeight()) )
-  {
-    print() << FPoint{2, 2 + y}
-            << FString{std::size_t(getClientWidth()), ' '};
-    y++;
-  }
+  fillRect (FRect{ FPoint{2, 2 + y}
+                 , FPoint{1 + int(getClientWidth()), 1 + int(getClientHeight())} });
 }
 
 //----------------------------------------------------------------------
@@ -1626,6 +2247,42 @@ void FListView::drawListLine ( const FListViewItem* item
   printColumnsString (line);
 }
 
+//----------------------------------------------------------------------
+void FListView::drawModelLine ( std::size_t row
+                              , bool is_focus
+                              , bool is_current )
+{
+  setLineAttributes (is_current, is_focus);
+  FStringList column_list{};
+  column_list.reserve(data.header.size());
+
+  for (std::size_t col{0}; col < data.header.size(); col++)
+    column_list.emplace_back(model->getText(row, int(col + 1)));
+
+  const uInt depth = model->getDepth(row);
+  const std::size_t indent = std::size_t(depth) << 1u;  // indent = 2 * depth
+  const bool expandable = model->getChildCount(row) > 0;
+  FString line{getLinePrefix (indent, expandable, model->isExpand(row))};
+  std::vector<std::size_t> column_starts{};
+  appendColumns (line, column_list, indent, false, &column_starts);
+  CellColors cell_colors{};
+
+  // The current line keeps the highlight colors
+  if ( ! is_current && ! FVTerm::getFOutput()->isMonochron() )
+  {
+    for (std::size_t col{0}; col < column_starts.size(); col++)
+    {
+      if ( column_starts[col] == NOT_SET )
+        continue;
+
+      const auto pair = model->getColorPair(row, int(col + 1));
+      cell_colors.emplace_back(column_starts[col], pair);
+    }
+  }
+
+  printColumnsString (line, cell_colors);
+}
+
 //----------------------------------------------------------------------
 auto FListView::createColumnsString (const FListViewItem* item) -> FString
 {
@@ -1635,17 +2292,36 @@ auto FListView::createColumnsString (const FListViewItem* item) -> FString
   // Get prefix
   const std::size_t indent = item->getDepth() << 1u;  // indent = 2 * depth
   FString line{getLinePrefix (item, indent)};
+  appendColumns (line, item->column_list, indent, item->isCheckable());
+  return line;
+}
+
+//----------------------------------------------------------------------
+void FListView::appendColumns ( FString& line
+                              , const FStringList& column_list
+                              , std::size_t indent
+                              , bool is_checkable
+                              , std::vector<std::size_t>* column_starts )
+{
+  // Appends the aligned column texts to the line. The optional
+  // column_starts receives the display position of each column.
 
-  for (std::size_t col{0}; col < item->column_list.size(); )
+  for (std::size_t col{0}; col < column_list.size(); )
   {
     if ( ! data.header[col].visible )
     {
+      if ( column_starts )
+        column_starts->push_back(std::size_t(NOT_SET));
+
       col++;
       continue;
     }
 
+    if ( column_starts )
+      column_starts->push_back(getColumnWidth(line));
+
     static constexpr std::size_t ellipsis_length = 2;
-    const auto& text = item->column_list[col];
+    const auto& text = column_list[col];
     auto width = std::size_t(data.header[col].width);
     const std::size_t column_width = getColumnWidth(text);
     // Increment the value of col for the column position
@@ -1655,7 +2331,7 @@ auto FListView::createColumnsString (const FListViewItem* item) -> FString
     const std::size_t align_offset = getAlignOffset (align, column_width, width);
 
     if ( isTreeView() && col == 1 )
-      adjustWidthForTreeView (width, indent, item->isCheckable());
+      adjustWidthForTreeView (width, indent, is_checkable);
 
     // Insert alignment spaces
     if ( align_offset > 0 )
@@ -1684,22 +2360,30 @@ auto FListView::createColumnsString (const FListViewItem* item) -> FString
       line += FString {L".. "};
     }
   }
-
-  return line;
 }
 
 //----------------------------------------------------------------------
-void FListView::printColumnsString (FString& line)
+void FListView::printColumnsString (FString& line, const CellColors& colors)
 {
   const std::size_t width = getWidth() - nf_offset - 2;
   line = getColumnSubString (line, std::size_t(scroll.xoffset) + 1, width);
   const std::size_t len = line.getLength();
   std::size_t char_width{0};
+  auto color_iter = colors.cbegin();
 
   for (std::size_t i{0}; i < len; i++)
   {
     try
     {
+      // Switch the cell color at the column start
+      const auto column = std::size_t(scroll.xoffset) + char_width;
+
+      while ( color_iter != colors.cend() && color_iter->first <= column )
+      {
+        setCellColor (color_iter->second);
+        ++color_iter;
+      }
+
       char_width += getColumnWidth(line[i]);
       print() << line[i];
     }
@@ -1709,10 +2393,25 @@ void FListView::printColumnsString (FString& line)
     }
   }
 
+  if ( ! colors.empty() )
+    setCellColor (FColorPair{});
+
   for (std::size_t i = char_width; i < width; i++)
     print (' ');
 }
 
+//----------------------------------------------------------------------
+inline void FListView::setCellColor (const FColorPair& pair) const
+{
+  // The default color uses the list color
+
+  const auto& wc = getColorTheme();
+  const auto fg = pair.getForegroundColor();
+  const auto bg = pair.getBackgroundColor();
+  setColor ( fg == FColor::Default ? wc->list.fg : fg
+           , bg == FColor::Default ? wc->list.bg : bg );
+}
+
 //----------------------------------------------------------------------
 void FListView::clearList()
 {
@@ -1727,11 +2426,7 @@ void FListView::clearList()
   if ( size == 0 )
     return;
 
-  for (auto y{0}; y < int(getHeight()) - 2; y++)
-  {
-    print() << FPoint{2, 2 + y} << FString{size, L' '};
-  }
-
+  fillRect (FRect{FPoint{2, 2}, FPoint{int(getWidth()) - 1, int(getHeight()) - 1}});
   drawScrollbars();
 }
 
@@ -1806,6 +2501,19 @@ inline auto FListView::getCheckBox (const FListViewItem* item) const -> FString
 //----------------------------------------------------------------------
 inline auto FListView::getLinePrefix ( const FListViewItem* item
                                      , std::size_t indent ) const -> FString
+{
+  FString line{getLinePrefix (indent, item->isExpandable(), item->isExpand())};
+
+  if ( item->isCheckable() )
+    line += getCheckBox(item);
+
+  return line;
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::getLinePrefix ( std::size_t indent
+                                     , bool is_expandable
+                                     , bool is_expand ) const -> FString
 {
   FString line{""};
 
@@ -1814,9 +2522,9 @@ inline auto FListView::getLinePrefix ( const FListViewItem* item
     if ( indent > 0 )
       line = FString{indent, L' '};
 
-    if ( item->isExpandable()  )
+    if ( is_expandable )
     {
-      if ( item->isExpand() )
+      if ( is_expand )
       {
         line += UniChar::BlackDownPointingTriangle;  // ▼
         line += L' ';
@@ -1833,9 +2541,6 @@ inline auto FListView::getLinePrefix ( const FListViewItem* item
   else
     line.setString(" ");
 
-  if ( item->isCheckable() )
-    line += getCheckBox(item);
-
   return line;
 }
 
@@ -2058,6 +2763,10 @@ void FListView::updateLayout()
                     recalculateHorizontalBar (line_width);
                   }
                 );
+
+  if ( hasModel() )
+    recalculateHorizontalBar (getHeaderLineWidth());
+
   adjustScrollbars(getCount());
   drawList();
   drawBorder();
@@ -2087,14 +2796,9 @@ void FListView::updateDrawing (bool draw_vbar, bool draw_hbar)
 //----------------------------------------------------------------------
 auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
 {
-  std::size_t padding_space = 1;
-  std::size_t line_width = padding_space;  // leading space
   std::size_t column_idx{0};
   const auto entries = std::size_t(item->column_list.size());
 
-  if ( hasCheckableItems() )
-    line_width += checkbox_space;
-
   for (auto&& header_item : data.header)
   {
     const auto width = std::size_t(header_item.width);
@@ -2111,19 +2815,73 @@ auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
         header_item.width = int(len);
     }
 
+    column_idx++;
+  }
+
+  return getHeaderLineWidth();
+}
+
+//----------------------------------------------------------------------
+auto FListView::getHeaderLineWidth() const -> std::size_t
+{
+  std::size_t padding_space = 1;
+  std::size_t line_width = padding_space;  // leading space
+
+  if ( hasCheckableItems() )
+    line_width += checkbox_space;
+
+  for (auto&& header_item : data.header)
+  {
     if ( &header_item == &data.header.back() )  // Last column
       padding_space = 0;
 
     // width + trailing space
     if ( header_item.visible )
       line_width += std::size_t(header_item.width) + padding_space;
-
-    column_idx++;
   }
 
   return line_width;
 }
 
+//----------------------------------------------------------------------
+void FListView::resetView()
+{
+  // Moves the selection and the visible area to the first line
+
+  scroll.xoffset = 0;
+  scroll.first_line_position_before = -1;
+
+  if ( ! hasModel() && isItemListEmpty() )
+  {
+    selection.current_iter = getNullIterator();
+    scroll.first_visible_line = getNullIterator();
+    scroll.last_visible_line = getNullIterator();
+    return;
+  }
+
+  selection.current_iter = getListBegin();
+  scroll.first_visible_line = getListBegin();
+  scroll.last_visible_line = getListBegin();
+}
+
+//----------------------------------------------------------------------
+void FListView::updateModelView()
+{
+  // Updates the view after a change in the number of model rows
+
+  const std::size_t element_count = getCount();
+  adjustViewport (int(element_count));
+  adjustScrollbars (element_count);
+
+  if ( isShown() )
+  {
+    drawList();
+    drawScrollbars();
+  }
+
+  processChanged();
+}
+
 //----------------------------------------------------------------------
 inline void FListView::beforeInsertion (FListViewItem* item)
 {
@@ -2132,8 +2890,11 @@ inline void FListView::beforeInsertion (FListViewItem* item)
 }
 
 //----------------------------------------------------------------------
-inline void FListView::afterInsertion()
+inline void FListView::afterInsertion (FListViewItem* item)
 {
+  if ( hasModel() )  // The items are not shown in model mode
+    return;
+
   if ( data.itemlist.size() == 1 )  // Select first item on insert
     selection.current_iter = data.itemlist.begin();
 
@@ -2141,13 +2902,54 @@ inline void FListView::afterInsertion()
   scroll.first_visible_line = data.itemlist.begin();
 
   // Sort list by a column (only if activated)
-  sort();
+  if ( sorting.is_sorted )
+    sortInsertedItem (item);
+  else
+    sort();
 
   const std::size_t element_count = getCount();
   recalculateVerticalBar (element_count);
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FListView::sortInsertedItem (FListViewItem* item)
+{
+  // Moves the appended item to its sorted position by binary
+  // search instead of sorting the whole list again
+
+  auto parent = item->getParent();
+  FObjectList* list{nullptr};
+  FListViewLineIndex* line_index{nullptr};
+
+  if ( parent == this )
+  {
+    list = &data.itemlist;
+    line_index = &data.line_index;
+  }
+  else if ( parent && parent->isInstanceOf<FListViewItem>() )
+  {
+    auto parent_item = static_cast<FListViewItem*>(parent);
+    list = &parent_item->getChildren();
+    line_index = &parent_item->line_index;
+  }
+
+  if ( ! list || list->empty() || list->back() != item )
+  {
+    sort();
+    return;
+  }
+
+  const auto last = list->end() - 1;
+  const auto pos = std::upper_bound ( list->begin(), last
+                                    , item, getItemComparator() );
+  std::rotate (pos, last, list->end());
+  line_index->clear();  // Rebuild on the next access
+  item->sort(getListSorter());  // Sort the sublevels of the new item
+  selection.current_iter = data.itemlist.begin();
+  scroll.first_visible_line = data.itemlist.begin();
+}
+
 //----------------------------------------------------------------------
 void FListView::adjustListBeforeRemoval (const FListViewItem* item)
 {
@@ -2184,23 +2986,21 @@ void FListView::removeItemFromParent (FListViewItem* item)
 
   if ( this == parent )
   {
-    auto last = std::remove (data.itemlist.begin(), data.itemlist.end(), item);
-    data.itemlist.erase(last, data.itemlist.end());
+    auto iter = std::find (data.itemlist.begin(), data.itemlist.end(), item);
+
+    if ( iter != data.itemlist.end() )
+    {
+      data.itemlist.erase(iter);
+      data.line_index.clear();  // Rebuild on the next access
+      data.visible_lines -= item->getVisibleLines();
+    }
+
     delChild(item);
-    selection.current_iter.getPosition()--;
     return;
   }
 
-  parent->delChild(item);
   auto parent_item = static_cast<FListViewItem*>(parent);
-  parent_item->visible_lines--;
-  selection.current_iter.getPosition()--;
-
-  if ( parent_item->hasChildren() )
-    return;
-
-  parent_item->expandable = false;
-  parent_item->is_expand = false;
+  parent_item->removeChildItem(item);
 }
 
 //----------------------------------------------------------------------
@@ -2316,14 +3116,12 @@ void FListView::mouseHeaderClicked()
 //----------------------------------------------------------------------
 void FListView::handleTreeExpanderClick (const FMouseEvent* ev)
 {
-  const auto& item = getCurrentItem();
-
   if ( ! isTreeView()
-    || ! item->isExpandable()
+    || ! isCurrentExpandable()
     || selection.clicked_expander_pos != ev->getPos() )
     return;
 
-  toggleItemExpandState(item);
+  toggleExpandState();
   adjustScrollbars (getCount());
 
   if ( isShown() )
@@ -2333,12 +3131,14 @@ void FListView::handleTreeExpanderClick (const FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::handleCheckboxClick (const FMouseEvent* ev)
 {
+  if ( ! hasCheckableItems() )
+    return;
+
   const auto& item = getCurrentItem();
   int indent = isTreeView() ? int(item->getDepth() << 1u)  // indent = 2 * depth
                             : 0;
 
-  if ( ! ( hasCheckableItems()
-        && selection.clicked_checkbox_item == item
+  if ( ! ( selection.clicked_checkbox_item == item
         && isCheckboxClicked(ev->getX(), indent) ) )
     return;
 
@@ -2351,7 +3151,7 @@ void FListView::handleCheckboxClick (const FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::wheelUp (int pagesize)
 {
-  if ( isItemListEmpty() || selection.current_iter.getPosition() == 0 )
+  if ( isListEmpty() || selection.current_iter.getPosition() == 0 )
     return;
 
   if ( scroll.first_visible_line.getPosition() >= pagesize )
@@ -2375,7 +3175,7 @@ void FListView::wheelUp (int pagesize)
 //----------------------------------------------------------------------
 void FListView::wheelDown (int pagesize)
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   const auto element_count = int(getCount());
@@ -2404,7 +3204,7 @@ void FListView::wheelDown (int pagesize)
 //----------------------------------------------------------------------
 void FListView::wheelLeft (int pagesize)
 {
-  if ( isItemListEmpty() || scroll.xoffset == 0 )
+  if ( isListEmpty() || scroll.xoffset == 0 )
     return;
 
   const int xoffset_before = scroll.xoffset;
@@ -2416,7 +3216,7 @@ void FListView::wheelLeft (int pagesize)
 //----------------------------------------------------------------------
 void FListView::wheelRight (int pagesize)
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   const int xoffset_before = scroll.xoffset;
@@ -2513,14 +3313,71 @@ inline void FListView::stopDragScroll()
 }
 
 //----------------------------------------------------------------------
-inline void FListView::toggleItemExpandState (FListViewItem* item) const
+inline void FListView::toggleExpandState()
 {
-  if ( item->isExpand() )
-    item->collapse();
+  if ( isCurrentExpand() )
+    collapseCurrent();
   else
+    expandCurrent();
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::isCurrentExpandable() -> bool
+{
+  if ( hasModel() )
+    return model->getChildCount(getCurrentRow()) > 0;
+
+  const auto item = getCurrentItem();
+  return item && item->isExpandable();
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::isCurrentExpand() -> bool
+{
+  if ( hasModel() )
+    return model->isExpand(getCurrentRow());
+
+  const auto item = getCurrentItem();
+  return item && item->isExpand();
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::getCurrentDepth() -> uInt
+{
+  if ( hasModel() )
+    return model->getDepth(getCurrentRow());
+
+  const auto item = getCurrentItem();
+  return item ? item->getDepth() : 0;
+}
+
+//----------------------------------------------------------------------
+inline void FListView::expandCurrent()
+{
+  if ( hasModel() )
+    model->expand(getCurrentRow());
+  else if ( auto item = getCurrentItem() )
     item->expand();
 }
 
+//----------------------------------------------------------------------
+inline void FListView::collapseCurrent()
+{
+  if ( hasModel() )
+    model->collapse(getCurrentRow());
+  else if ( auto item = getCurrentItem() )
+    item->collapse();
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::getListBegin() -> FListViewIterator
+{
+  if ( hasModel() )
+    return FListViewIterator{0};
+
+  return FListViewIterator{data.itemlist.begin()};
+}
+
 //----------------------------------------------------------------------
 inline auto FListView::isCheckboxClicked (int mouse_x, int indent) const -> bool
 {
@@ -2562,6 +3419,8 @@ auto FListView::appendItem (FListViewItem* item) -> FObject::iterator
   item->root = data.root;
   addChild (item);
   data.itemlist.push_back (item);
+  data.line_index.append (data.itemlist, item);
+  data.visible_lines += item->getVisibleLines();
   return --data.itemlist.end();
 }
 
@@ -2574,18 +3433,18 @@ void FListView::handleListEvent (const FMouseEvent* ev)
   if ( new_pos < int(getCount()) )
     setRelativePosition (ev->getY() - 2);
 
-  const auto& item = getCurrentItem();
-
   if ( isTreeView() )  // Handle tree view events
   {
-    indent = int(item->getDepth() << 1u);  // indent = 2 * depth
+    indent = int(getCurrentDepth() << 1u);  // indent = 2 * depth
 
-    if ( item->isExpandable() && ev->getX() - 2 == indent - scroll.xoffset )
+    if ( isCurrentExpandable() && ev->getX() - 2 == indent - scroll.xoffset )
       selection.clicked_expander_pos = ev->getPos();
   }
 
   if ( hasCheckableItems() )  // Handle checkable item events
   {
+    const auto& item = getCurrentItem();
+
     if ( isTreeView() )
       indent++;  // Plus one space
 
@@ -2610,7 +3469,7 @@ void FListView::handleListEvent (const FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FListView::processClick() const
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   emitCallback("clicked");
@@ -2651,16 +3510,14 @@ inline void FListView::toggleCheckbox()
 
   const auto item = getCurrentItem();
 
-  if ( item->isCheckable() )
+  if ( item && item->isCheckable() )
     toggleItemCheckState(item);
 }
 
 //----------------------------------------------------------------------
 inline void FListView::collapseAndScrollLeft()
 {
-  const auto item = getCurrentItem();
-
-  if ( scroll.xoffset != 0 || ! item || isItemListEmpty() )
+  if ( scroll.xoffset != 0 || isListEmpty() )
   {
     if ( scroll.xoffset > 0 )  // Scroll left
       scroll.xoffset--;
@@ -2668,10 +3525,10 @@ inline void FListView::collapseAndScrollLeft()
     return;
   }
 
-  if ( isTreeView() && item->isExpandable() && item->isExpand() )
+  if ( isTreeView() && isCurrentExpandable() && isCurrentExpand() )
   {
     // Collapse element
-    item->collapse();
+    collapseCurrent();
     adjustSize();
     scroll.vbar->calculateSliderValues();
     // Force vertical scrollbar redraw
@@ -2679,18 +3536,40 @@ inline void FListView::collapseAndScrollLeft()
     return;
   }
 
-  jumpToParentElement(item);
+  jumpToParentElement();
 }
 
 //----------------------------------------------------------------------
-inline void FListView::jumpToParentElement (const FListViewItem* item)
+inline void FListView::jumpToParentElement()
 {
-  if ( ! item->hasParent()
-    || ! item->getParent()->isInstanceOf("FListViewItem") )
-    return;
-
   const int position_before = selection.current_iter.getPosition();
-  selection.current_iter.parentElement();  // Set the iterator to the parent
+
+  if ( hasModel() )
+  {
+    // The parent is the previous row with a lower depth
+    const auto depth = getCurrentDepth();
+
+    if ( depth == 0 )
+      return;
+
+    int row = position_before;
+
+    while ( row > 0 && model->getDepth(std::size_t(row)) >= depth )
+      row--;
+
+    selection.current_iter = FListViewIterator{row};
+  }
+  else
+  {
+    const auto item = getCurrentItem();
+
+    if ( ! item
+      || ! item->hasParent()
+      || ! item->getParent()->isInstanceOf<FListViewItem>() )
+      return;
+
+    selection.current_iter.parentElement();  // Set the iterator to the parent
+  }
 
   if ( selection.current_iter.getPosition() >= scroll.first_line_position_before )
     return;
@@ -2714,13 +3593,11 @@ inline void FListView::jumpToParentElement (const FListViewItem* item)
 inline void FListView::expandAndScrollRight()
 {
   const int xoffset_end = int(max_line_width) - int(getClientWidth());
-  const auto item = getCurrentItem();
-
-  if ( isTreeView() && ! isItemListEmpty() && item
-    && item->isExpandable() && ! item->isExpand() )
+  if ( isTreeView() && ! isListEmpty()
+    && isCurrentExpandable() && ! isCurrentExpand() )
   {
     // Expand element
-    item->expand();
+    expandCurrent();
     adjustScrollbars (getCount());
     // Force vertical scrollbar redraw
     scroll.first_line_position_before = -1;
@@ -2739,7 +3616,7 @@ inline void FListView::expandAndScrollRight()
 //----------------------------------------------------------------------
 inline void FListView::firstPos()
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   selection.current_iter -= selection.current_iter.getPosition();
@@ -2751,7 +3628,7 @@ inline void FListView::firstPos()
 //----------------------------------------------------------------------
 inline void FListView::lastPos()
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   const auto element_count = int(getCount());
@@ -2764,14 +3641,12 @@ inline void FListView::lastPos()
 //----------------------------------------------------------------------
 inline auto FListView::expandSubtree() -> bool
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return false;
 
-  auto item = getCurrentItem();
-
-  if ( isTreeView() && item->isExpandable() && ! item->isExpand() )
+  if ( isTreeView() && isCurrentExpandable() && ! isCurrentExpand() )
   {
-    item->expand();
+    expandCurrent();
     adjustScrollbars (getCount());
     return true;
   }
@@ -2782,14 +3657,12 @@ inline auto FListView::expandSubtree() -> bool
 //----------------------------------------------------------------------
 inline auto FListView::collapseSubtree() -> bool
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return false;
 
-  auto item = getCurrentItem();
-
-  if ( isTreeView() && item->isExpandable() && item->isExpand() )
+  if ( isTreeView() && isCurrentExpandable() && isCurrentExpand() )
   {
-    item->collapse();
+    collapseCurrent();
     adjustScrollbars (getCount());
     return true;
   }
@@ -2806,6 +3679,12 @@ void FListView::setRelativePosition (int ry)
 //----------------------------------------------------------------------
 void FListView::stepForward()
 {
+  if ( hasModel() )
+  {
+    stepForward(1);
+    return;
+  }
+
   if ( isItemListEmpty() )
     return;
 
@@ -2828,6 +3707,12 @@ void FListView::stepForward()
 //----------------------------------------------------------------------
 void FListView::stepBackward()
 {
+  if ( hasModel() )
+  {
+    stepBackward(1);
+    return;
+  }
+
   if ( isItemListEmpty() )
     return;
 
@@ -2845,7 +3730,7 @@ void FListView::stepBackward()
 //----------------------------------------------------------------------
 void FListView::stepForward (int distance)
 {
-  if ( isItemListEmpty() )
+  if ( isListEmpty() )
     return;
 
   const auto element_count = int(getCount());
@@ -2881,7 +3766,7 @@ void FListView::stepForward (int distance)
 //----------------------------------------------------------------------
 void FListView::stepBackward (int distance)
 {
-  if ( isItemListEmpty() || selection.current_iter.getPosition() == 0 )
+  if ( isListEmpty() || selection.current_iter.getPosition() == 0 )
     return;
 
   if ( selection.current_iter.getPosition() - distance >= 0 )
@@ -2934,7 +3819,7 @@ void FListView::scrollToY (int y)
 
   if ( y + pagesize <= element_count )
   {
-    scroll.first_visible_line = FListViewIterator(data.itemlist.begin()) + y;
+    scroll.first_visible_line = getListBegin() + y;
     setRelativePosition (ry);
     scroll.last_visible_line = scroll.first_visible_line + pagesize;
   }
@@ -47,6 +47,7 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <stack>
@@ -57,6 +58,7 @@
 #include "final/ftypes.h"
 #include "final/fwidget.h"
 #include "final/util/fdata.h"
+#include "final/vterm/fcolorpair.h"
 #include "final/vterm/fvtermbuffer.h"
 #include "final/widget/fscrollbar.h"
 
@@ -65,9 +67,91 @@ namespace finalcut
 
 // class forward declaration
 class FListView;
+class FListViewItem;
 class FScrollbar;
 class FString;
 
+//----------------------------------------------------------------------
+// class FListViewModel
+//----------------------------------------------------------------------
+
+// Data source for a virtual list view. The rows are numbered in display
+// order (the rows of an expanded subtree follow their parent row).
+// The list view only requests the data of the rows it shows.
+
+class FListViewModel
+{
+  public:
+    // Constructor
+    FListViewModel() = default;
+
+    // Destructor
+    virtual ~FListViewModel() noexcept;
+
+    // Accessors
+    virtual auto getClassName() const -> FString;
+    virtual auto getRowCount() const -> std::size_t = 0;
+    virtual auto getText (std::size_t, int) const -> FString = 0;
+    virtual auto getColorPair (std::size_t, int) const -> FColorPair;
+    virtual auto getChildCount (std::size_t) const -> std::size_t;
+    virtual auto getDepth (std::size_t) const -> uInt;
+
+    // Inquiry
+    virtual auto isExpand (std::size_t) const -> bool;
+
+    // Methods
+    virtual void expand (std::size_t);
+    virtual void collapse (std::size_t);
+    virtual void sort (int, SortOrder);
+};
+
+
+//----------------------------------------------------------------------
+// class FListViewLineIndex
+//----------------------------------------------------------------------
+
+// Binary indexed tree with the prefix sums of the visible lines
+// of a child list. A line offset is found in O(log n) time.
+
+class FListViewLineIndex
+{
+  public:
+    // Using-declarations
+    using FObjectList = std::vector<FObject*>;
+    using LinePosition = std::pair<std::size_t, std::size_t>;
+
+    // Accessors
+    auto getSize() const noexcept -> std::size_t;
+    auto getOffset (const FObjectList&, const FListViewItem*) -> std::size_t;
+
+    // Methods
+    auto find (const FObjectList&, std::size_t) -> LinePosition;
+    void append (const FObjectList&, FListViewItem*);
+    void update (const FObjectList&, const FListViewItem*, std::ptrdiff_t);
+    void clear();
+
+  private:
+    // Inquiry
+    auto isIndexOf (const FObjectList&, const FListViewItem*) const -> bool;
+
+    // Methods
+    void build (const FObjectList&);
+    auto sum (std::size_t) const -> std::size_t;
+
+    // Data member
+    std::vector<std::size_t>  tree{};
+};
+
+// FListViewLineIndex inline functions
+//----------------------------------------------------------------------
+inline auto FListViewLineIndex::getSize() const noexcept -> std::size_t
+{ return tree.size(); }
+
+//----------------------------------------------------------------------
+inline void FListViewLineIndex::clear()
+{ tree.clear(); }
+
+
 //----------------------------------------------------------------------
 // class FListViewItem
 //----------------------------------------------------------------------
@@ -125,26 +209,32 @@ class FListViewItem : public FObject
     auto isCheckable() const -> bool;
 
     // Methods
-    template <typename Compare>
-    void sort (Compare);
+    template <typename Sorter>
+    void sort (Sorter);
     auto appendItem (FListViewItem*) -> iterator;
     void replaceControlCodes();
-    auto getVisibleLines() -> std::size_t;
-    void resetVisibleLineCounter();
+    auto getVisibleLines() const -> std::size_t;
+    void removeChildItem (FListViewItem*);
+    void addChildLines (std::ptrdiff_t);
+    void changeVisibleLines (std::ptrdiff_t);
 
     // Data members
-    FStringList     column_list{};
-    FDataAccessPtr  data_pointer{};
-    iterator        root{};
-    std::size_t     visible_lines{1};
-    bool            expandable{false};
-    bool            is_expand{false};
-    bool            checkable{false};
-    bool            is_checked{false};
+    FStringList         column_list{};
+    FDataAccessPtr      data_pointer{};
+    iterator            root{};
+    FListViewLineIndex  line_index{};
+    std::size_t         visible_lines{1};
+    std::size_t         child_lines{0};
+    std::size_t         list_index{0};
+    bool                expandable{false};
+    bool                is_expand{false};
+    bool                checkable{false};
+    bool                is_checked{false};
 
     // Friend class
     friend class FListView;
     friend class FListViewIterator;
+    friend class FListViewLineIndex;
 };
 
 
@@ -208,6 +298,10 @@ inline auto FListViewItem::isExpandable() const -> bool
 inline auto FListViewItem::isCheckable() const -> bool
 { return checkable; }
 
+//----------------------------------------------------------------------
+inline auto FListViewItem::getVisibleLines() const -> std::size_t
+{ return visible_lines; }
+
 
 //----------------------------------------------------------------------
 // class FListViewIterator
@@ -225,11 +319,13 @@ class FListViewIterator
     FListViewIterator () = default;
     ~FListViewIterator () = default;
     explicit FListViewIterator (Iterator);
+    explicit FListViewIterator (int);  // Row of a list view model
     FListViewIterator (const FListViewIterator&) = default;
     FListViewIterator (FListViewIterator&& i) noexcept
       : iter_path{std::move(i.iter_path)}
       , node{i.node}
       , position{i.position}
+      , row_only{i.row_only}
     { }
 
     // Overloaded operators
@@ -280,20 +376,14 @@ class FListViewIterator
     friend auto operator + (const FListViewIterator& lhs, int n) -> FListViewIterator
     {
       auto tmp = lhs;
-
-      for (int i = n; i > 0 ; i--)
-        tmp.nextElement(tmp.node);
-
+      tmp += n;
       return tmp;
     }
 
     friend auto operator - (const FListViewIterator& lhs, int n) -> FListViewIterator
     {
       auto tmp = lhs;
-
-      for (int i = n; i > 0 ; i--)
-        tmp.prevElement(tmp.node);
-
+      tmp -= n;
       return tmp;
     }
 
@@ -301,11 +391,13 @@ class FListViewIterator
     // Methods
     void nextElement (Iterator&);
     void prevElement (Iterator&);
+    auto seek (int) -> bool;
 
     // Data members
     IteratorStack  iter_path{};
     Iterator       node{};
     int            position{0};
+    bool           row_only{false};
 };
 
 
@@ -366,6 +458,8 @@ class FListView : public FWidget
     auto getSortOrder() const -> SortOrder;
     auto getSortColumn() const -> int;
     auto getCurrentItem() -> FListViewItem*;
+    auto getCurrentRow() -> std::size_t;
+    auto getModel() const -> FListViewModel*;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
@@ -384,9 +478,12 @@ class FListView : public FWidget
     void hideColumn (int);
     void setTreeView (bool = true);
     void unsetTreeView();
+    void setModel (FListViewModel*);
+    void unsetModel();
 
     // Inquiries
     auto isColumnHidden (int) const -> bool;
+    auto hasModel() const -> bool;
 
     // Methods
     virtual auto addColumn (const FString&, int = USE_MAX_SIZE) -> int;
@@ -418,6 +515,9 @@ class FListView : public FWidget
     auto insert (const std::vector<ColT>&, DT&&, iterator) -> iterator;
     void remove (FListViewItem*);
     void clear();
+    void rowsInserted (std::size_t, std::size_t);
+    void rowsRemoved (std::size_t, std::size_t);
+    void rowsChanged (std::size_t, std::size_t);
     auto getData() & -> FListViewItems&;
     auto getData() const & -> const FListViewItems&;
 
@@ -448,16 +548,19 @@ class FListView : public FWidget
     using KeyMapResult = std::unordered_map<FKey, std::function<bool()>, EnumHash<FKey>>;
     using HeaderItems = std::vector<Header>;
     using SortTypes = std::vector<SortType>;
+    using CellColors = std::vector<std::pair<std::size_t, FColorPair>>;
 
     struct ListViewData
     {
-      iterator      root{};
-      FObjectList   selflist{};
-      FObjectList   itemlist{};
-      HeaderItems   header;  // GitHub issues #122
-      FVTermBuffer  headerline{};
-      KeyMap        key_map{};
-      KeyMapResult  key_map_result{};
+      iterator            root{};
+      FObjectList         selflist{};
+      FObjectList         itemlist{};
+      FListViewLineIndex  line_index{};
+      std::size_t         visible_lines{0};
+      HeaderItems         header;  // GitHub issues #122
+      FVTermBuffer        headerline{};
+      KeyMap              key_map{};
+      KeyMapResult        key_map_result{};
     };
 
     struct SelectionState
@@ -474,6 +577,7 @@ class FListView : public FWidget
       SortTypes  type{};
       SortOrder  order{SortOrder::Unsorted};
       bool       hide_sort_indicator{false};
+      bool       is_sorted{false};
     };
 
     struct ScrollingState
@@ -491,6 +595,7 @@ class FListView : public FWidget
 
     // Constants
     static constexpr std::size_t checkbox_space = 4;
+    static constexpr auto NOT_SET = static_cast<std::size_t>(-1);
 
     // Constants
     static constexpr int USE_MAX_SIZE = -1;
@@ -511,8 +616,10 @@ class FListView : public FWidget
     void init();
     void mapKeyFunctions();
     void processKeyAction (FKeyEvent*);
-    template <typename Compare>
-    void sort (Compare);
+    template <typename Sorter>
+    void sort (Sorter);
+    auto getItemComparator() const -> std::function<bool(const FObject*, const FObject*)>;
+    auto getListSorter() const -> std::function<void(FObjectList&)>;
     auto getAlignOffset ( const Align
                         , const std::size_t
                         , const std::size_t ) const -> std::size_t;
@@ -522,16 +629,22 @@ class FListView : public FWidget
     void drawScrollbars() const;
     void drawHeadlines();
     void drawList();
-    void setInputCursor (const FListViewItem*, int, bool);
+    void drawModelList();
+    void setInputCursor (uInt, bool, int, bool);
     void finalizeListDrawing (int);
     void adjustWidthForTreeView (std::size_t&, std::size_t, bool) const;
     void drawListLine (const FListViewItem*, bool, bool);
+    void drawModelLine (std::size_t, bool, bool);
     auto createColumnsString (const FListViewItem*) -> FString;
-    void printColumnsString (FString&);
+    void appendColumns ( FString&, const FStringList&, std::size_t
+                       , bool, std::vector<std::size_t>* = nullptr );
+    void printColumnsString (FString&, const CellColors& = {});
+    void setCellColor (const FColorPair&) const;
     void clearList();
     void setLineAttributes (bool, bool) const;
     auto getCheckBox (const FListViewItem* item) const -> FString;
     auto getLinePrefix (const FListViewItem*, std::size_t) const -> FString;
+    auto getLinePrefix (std::size_t, bool, bool) const -> FString;
     void drawSortIndicator (std::size_t&, std::size_t);
     void drawHeadlineLabel (const HeaderItems::const_iterator&);
     void drawHeaderBorder (std::size_t);
@@ -543,8 +656,12 @@ class FListView : public FWidget
     void updateLayout();
     void updateDrawing (bool, bool);
     auto determineLineWidth (FListViewItem*) -> std::size_t;
+    auto getHeaderLineWidth() const -> std::size_t;
+    void resetView();
+    void updateModelView();
     void beforeInsertion (FListViewItem*);
-    void afterInsertion();
+    void afterInsertion (FListViewItem*);
+    void sortInsertedItem (FListViewItem*);
     void adjustListBeforeRemoval (const FListViewItem*);
     void removeItemFromParent (FListViewItem*);
     void updateListAfterRemoval();
@@ -562,7 +679,7 @@ class FListView : public FWidget
     void dragUp (MouseButton);
     void dragDown (MouseButton);
     void stopDragScroll();
-    void toggleItemExpandState (FListViewItem*) const;
+    void toggleExpandState();
     void toggleItemCheckState (FListViewItem*) const;
     auto isCheckboxClicked (int, int) const -> bool;
     void resetClickedPositions();
@@ -576,7 +693,7 @@ class FListView : public FWidget
     void changeOnResize() const;
     void toggleCheckbox();
     void collapseAndScrollLeft();
-    void jumpToParentElement (const FListViewItem*);
+    void jumpToParentElement();
     void expandAndScrollRight();
     void firstPos();
     void lastPos();
@@ -593,9 +710,16 @@ class FListView : public FWidget
     void scrollTo (int, int);
     void scrollBy (int, int);
     auto isItemListEmpty() const -> bool;
+    auto isListEmpty() const -> bool;
     auto isTreeView() const -> bool;
     auto isColumnIndexInvalid (int) const -> bool;
     auto hasCheckableItems() const -> bool;
+    auto isCurrentExpandable() -> bool;
+    auto isCurrentExpand() -> bool;
+    auto getCurrentDepth() -> uInt;
+    void expandCurrent();
+    void collapseCurrent();
+    auto getListBegin() -> FListViewIterator;
     auto getScrollBarMaxHorizontal() const noexcept -> int;
     auto getScrollBarMaxVertical (const std::size_t) const noexcept -> int;
     void updateViewAfterVBarChange (const FScrollbar::ScrollType);
@@ -608,22 +732,24 @@ class FListView : public FWidget
     void cb_hbarChange (const FWidget*);
 
     // Data members
-    std::size_t     nf_offset{0};
-    std::size_t     max_line_width{1};
-    bool            tree_view{false};
-    bool            has_checkable_items{false};
-    ListViewData    data{};
-    SortState       sorting{};
-    ScrollingState  scroll{};
-    SelectionState  selection{};
-    DragScrollMode  drag_scroll{DragScrollMode::None};
+    std::size_t      nf_offset{0};
+    std::size_t      max_line_width{1};
+    bool             tree_view{false};
+    bool             has_checkable_items{false};
+    ListViewData     data{};
+    SortState        sorting{};
+    ScrollingState   scroll{};
+    SelectionState   selection{};
+    DragScrollMode   drag_scroll{DragScrollMode::None};
+    FListViewModel*  model{nullptr};
 
     // Function Pointer
     bool (*user_defined_ascending) (const FObject*, const FObject*){nullptr};
     bool (*user_defined_descending) (const FObject*, const FObject*){nullptr};
 
-    // Friend class
+    // Friend classes
     friend class FListViewItem;
+    friend class FListViewIterator;
 };
 
 
@@ -659,17 +785,36 @@ inline auto FListView::getSortColumn() const -> int
 
 //----------------------------------------------------------------------
 inline auto FListView::getCurrentItem() -> FListViewItem*
-{ return static_cast<FListViewItem*>(*selection.current_iter); }
+{
+  if ( hasModel() )
+    return nullptr;
+
+  return static_cast<FListViewItem*>(*selection.current_iter);
+}
+
+//----------------------------------------------------------------------
+inline auto FListView::getCurrentRow() -> std::size_t
+{ return std::size_t(std::max(selection.current_iter.getPosition(), 0)); }
+
+//----------------------------------------------------------------------
+inline auto FListView::getModel() const -> FListViewModel*
+{ return model; }
 
 //----------------------------------------------------------------------
 template <typename Compare>
 inline void FListView::setUserAscendingCompare (Compare cmp)
-{ user_defined_ascending = cmp; }
+{
+  user_defined_ascending = cmp;
+  sorting.is_sorted = false;
+}
 
 //----------------------------------------------------------------------
 template <typename Compare>
 inline void FListView::setUserDescendingCompare (Compare cmp)
-{ user_defined_descending = cmp; }
+{
+  user_defined_descending = cmp;
+  sorting.is_sorted = false;
+}
 
 //----------------------------------------------------------------------
 inline void FListView::hideSortIndicator (bool hide)
@@ -683,6 +828,14 @@ inline void FListView::setTreeView (bool enable)
 inline void FListView::unsetTreeView()
 { setTreeView(false); }
 
+//----------------------------------------------------------------------
+inline void FListView::unsetModel()
+{ setModel(nullptr); }
+
+//----------------------------------------------------------------------
+inline auto FListView::hasModel() const -> bool
+{ return model != nullptr; }
+
 //----------------------------------------------------------------------
 inline auto FListView::insert (FListViewItem* item) -> FObject::iterator
 { return insert (item, data.root); }
@@ -826,7 +979,7 @@ inline auto FListView::isVerticallyScrollable() const -> bool
 
 //----------------------------------------------------------------------
 inline auto FListView::canSkipListDrawing() const -> bool
-{ return isItemListEmpty() || getHeight() <= 2 || getWidth() <= 4; }
+{ return isListEmpty() || getHeight() <= 2 || getWidth() <= 4; }
 
 //----------------------------------------------------------------------
 inline auto FListView::getColumnCount() const -> std::size_t
@@ -844,6 +997,10 @@ inline void FListView::scrollTo (const FPoint& pos)
 inline auto FListView::isItemListEmpty() const -> bool
 { return data.itemlist.empty(); }
 
+//----------------------------------------------------------------------
+inline auto FListView::isListEmpty() const -> bool
+{ return hasModel() ? model->getRowCount() == 0 : isItemListEmpty(); }
+
 //----------------------------------------------------------------------
 inline auto FListView::isTreeView() const -> bool
 { return tree_view; }
@@ -856,7 +1013,7 @@ inline auto FListView::isColumnIndexInvalid (int column) const -> bool
 
 //----------------------------------------------------------------------
 inline auto FListView::hasCheckableItems() const -> bool
-{ return has_checkable_items; }
+{ return has_checkable_items && ! hasModel(); }
 
 }  // namespace finalcut
 
@@ -0,0 +1,312 @@
+/***********************************************************************
+* fmappedtextfile.cpp - Memory-mapped text file for FTextView          *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "final/util/futf8.h"
+#include "final/widget/fmappedtextfile.h"
+
+namespace finalcut
+{
+
+// Function prototypes
+auto getUTF8Columns (const char*, std::size_t) -> std::size_t;
+
+// Function
+//----------------------------------------------------------------------
+inline auto getUTF8Columns (const char* str, std::size_t length) -> std::size_t
+{
+  // Counts the characters (all bytes except continuation bytes)
+
+  std::size_t columns{0};
+
+  for (std::size_t i{0}; i < length; i++)
+    if ( (uChar(str[i]) & 0xc0) != 0x80 )
+      columns++;
+
+  return columns;
+}
+
+
+//----------------------------------------------------------------------
+// class FMappedTextFile
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FMappedTextFile::FMappedTextFile (const FString& filename)
+{
+  open (filename);
+}
+
+//----------------------------------------------------------------------
+FMappedTextFile::~FMappedTextFile() noexcept  // destructor
+{
+  close();
+}
+
+
+// public methods of FMappedTextFile
+//----------------------------------------------------------------------
+auto FMappedTextFile::getProgress() const noexcept -> int
+{
+  // Indexing progress in percent
+
+  if ( file_size == 0 )
+    return 100;
+
+  return int(uInt64(getIndexedSize()) * 100 / uInt64(file_size));
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::getLineCount() const -> std::size_t
+{
+  std::lock_guard<std::mutex> lock(index_mutex);
+  return line_end.size();
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::getLine (std::size_t row) const -> FString
+{
+  std::size_t start{0};
+  std::size_t end{0};
+
+  {
+    std::lock_guard<std::mutex> lock(index_mutex);
+
+    if ( row >= line_end.size() )
+      return {};
+
+    start = ( row == 0 ) ? 0 : line_end[row - 1] + 1;
+    end = line_end[row];
+  }
+
+  if ( ! isMapValid() )
+    return readLine (start, end);
+
+  if ( end > start && map[end - 1] == '\r' )  // CRLF line ending
+    end--;
+
+  return decodeUTF8 (map + start, end - start);
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::getColumns() const -> std::size_t
+{
+  std::lock_guard<std::mutex> lock(index_mutex);
+  return max_columns;
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::open (const FString& filename) -> bool
+{
+  close();
+
+  if ( filename.isEmpty() )
+    return false;
+
+  const int fd = ::open (filename.c_str(), O_RDONLY);
+
+  if ( fd < 0 )
+    return false;
+
+  struct stat file_stat{};
+
+  if ( ::fstat(fd, &file_stat) != 0 || ! S_ISREG(file_stat.st_mode) )
+  {
+    ::close(fd);
+    return false;
+  }
+
+  const auto size = std::size_t(file_stat.st_size);
+
+  if ( size > 0 )
+  {
+    void* ptr = ::mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if ( ptr == MAP_FAILED )
+    {
+      ::close(fd);
+      return false;
+    }
+
+    map = static_cast<const char*>(ptr);
+  }
+
+  file_descriptor = fd;  // Remains open to detect a truncation
+  file_name = filename;
+  file_size = size;
+  indexed_size = 0;
+  stop_indexing = false;
+  loading = true;
+  index_thread = std::thread(&FMappedTextFile::indexLines, this);
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::close()
+{
+  stop_indexing = true;
+
+  if ( index_thread.joinable() )
+    index_thread.join();
+
+  if ( map )
+    ::munmap (const_cast<char*>(map), file_size);
+
+  if ( file_descriptor >= 0 )
+    ::close(file_descriptor);
+
+  std::lock_guard<std::mutex> lock(index_mutex);
+  map = nullptr;
+  file_descriptor = -1;
+  truncated = false;
+  file_name.clear();
+  file_size = 0;
+  line_end.clear();
+  line_end.shrink_to_fit();
+  max_columns = 0;
+  indexed_size = 0;
+  loading = false;
+}
+
+
+// private methods of FMappedTextFile
+//----------------------------------------------------------------------
+auto FMappedTextFile::isMapValid() const -> bool
+{
+  // A mapped page behind the current end of the file is no longer
+  // readable (SIGBUS). Once the file has shrunk, the mapping is not
+  // used anymore.
+
+  if ( truncated )
+    return false;
+
+  struct stat file_stat{};
+
+  if ( ::fstat(file_descriptor, &file_stat) != 0
+    || std::size_t(file_stat.st_size) < file_size )
+  {
+    truncated = true;
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::readLine (std::size_t start, std::size_t end) const -> FString
+{
+  // Reads the line from the file instead of the mapping.
+  // A line behind the new end of the file is shortened or empty.
+
+  std::string line(end - start, '\0');
+  std::size_t length{0};
+
+  while ( length < line.length() )
+  {
+    const auto bytes = ::pread ( file_descriptor
+                               , &line[length]
+                               , line.length() - length
+                               , off_t(start + length) );
+
+    if ( bytes <= 0 )
+      break;
+
+    length += std::size_t(bytes);
+  }
+
+  if ( length > 0 && length == line.length() && line[length - 1] == '\r' )
+    length--;  // CRLF line ending
+
+  return decodeUTF8 (line.data(), length);
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::indexLines()
+{
+  // Runs in the index thread and publishes the line ends block by block
+
+  std::vector<std::size_t> block_line_end{};
+  std::size_t line_start{0};
+  std::size_t pos{0};
+
+  while ( pos < file_size && ! stop_indexing )
+  {
+    const auto block_end = std::min(pos + INDEX_BLOCK_SIZE, file_size);
+    std::size_t columns{0};
+
+    if ( ! isMapValid() )
+      break;  // The file was truncated - stop indexing
+
+    while ( pos < block_end )
+    {
+      const auto newline = static_cast<const char*>
+      (
+        std::memchr(map + pos, '\n', block_end - pos)
+      );
+
+      if ( ! newline )
+      {
+        pos = block_end;
+        break;
+      }
+
+      const auto end = std::size_t(newline - map);
+      block_line_end.push_back(end);
+      columns = std::max(columns, getUTF8Columns(map + line_start, end - line_start));
+      line_start = end + 1;
+      pos = line_start;
+    }
+
+    if ( pos == file_size && line_start < file_size )
+    {
+      // Last line without a newline character
+      block_line_end.push_back(file_size);
+      columns = std::max(columns, getUTF8Columns(map + line_start, file_size - line_start));
+    }
+
+    addLineEnds (block_line_end, columns);
+    block_line_end.clear();
+    indexed_size = pos;
+  }
+
+  loading = false;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::addLineEnds ( const std::vector<std::size_t>& ends
+                                  , std::size_t columns )
+{
+  std::lock_guard<std::mutex> lock(index_mutex);
+  line_end.insert (line_end.end(), ends.cbegin(), ends.cend());
+  max_columns = std::max(max_columns, columns);
+}
+
+}  // namespace finalcut
@@ -0,0 +1,159 @@
+/***********************************************************************
+* fmappedtextfile.h - Memory-mapped text file for FTextView            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Inheritance diagram
+ *  ═══════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FTextViewModel ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *          ▲
+ *          │
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FMappedTextFile ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FMAPPEDTEXTFILE_H
+#define FMAPPEDTEXTFILE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "final/util/fstring.h"
+#include "final/widget/ftextview.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FMappedTextFile
+//----------------------------------------------------------------------
+
+// Read-only text file that is mapped into memory. A background thread
+// builds the index of the line ends, so that every indexed line can be
+// accessed in constant time. Only requested lines are decoded (UTF-8).
+// If the file is truncated while it is open, the lines are read with
+// pread() instead, because accessing a mapped page behind the end of
+// the file raises SIGBUS.
+
+class FMappedTextFile final : public FTextViewModel
+{
+  public:
+    // Constructor
+    FMappedTextFile() = default;
+    explicit FMappedTextFile (const FString&);
+
+    // Disable copy constructor
+    FMappedTextFile (const FMappedTextFile&) = delete;
+
+    // Disable move constructor
+    FMappedTextFile (FMappedTextFile&&) noexcept = delete;
+
+    // Destructor
+    ~FMappedTextFile() noexcept override;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FMappedTextFile&) -> FMappedTextFile& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (FMappedTextFile&&) noexcept -> FMappedTextFile& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString override;
+    auto getFileName() const -> FString;
+    auto getFileSize() const noexcept -> std::size_t;
+    auto getIndexedSize() const noexcept -> std::size_t;
+    auto getProgress() const noexcept -> int;
+    auto getLineCount() const -> std::size_t override;
+    auto getLine (std::size_t) const -> FString override;
+    auto getColumns() const -> std::size_t override;
+
+    // Inquiries
+    auto isOpen() const noexcept -> bool;
+    auto isLoading() const -> bool override;
+
+    // Methods
+    auto open (const FString&) -> bool;
+    void close();
+
+  private:
+    // Constant
+    static constexpr std::size_t INDEX_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    // Inquiry
+    auto isMapValid() const -> bool;
+
+    // Methods
+    auto readLine (std::size_t, std::size_t) const -> FString;
+    void indexLines();
+    void addLineEnds (const std::vector<std::size_t>&, std::size_t);
+
+    // Data members
+    FString                   file_name{};
+    const char*               map{nullptr};
+    int                       file_descriptor{-1};
+    std::size_t               file_size{0};
+    std::vector<std::size_t>  line_end{};  // Offsets of the line ends
+    std::size_t               max_columns{0};
+    std::atomic<std::size_t>  indexed_size{0};
+    std::atomic<bool>         loading{false};
+    std::atomic<bool>         stop_indexing{false};
+    mutable std::atomic<bool> truncated{false};
+    mutable std::mutex        index_mutex{};
+    std::thread               index_thread{};
+};
+
+// FMappedTextFile inline functions
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getClassName() const -> FString
+{ return "FMappedTextFile"; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getFileName() const -> FString
+{ return file_name; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getFileSize() const noexcept -> std::size_t
+{ return file_size; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getIndexedSize() const noexcept -> std::size_t
+{ return indexed_size; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::isOpen() const noexcept -> bool
+{ return ! file_name.isEmpty(); }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::isLoading() const -> bool
+{ return loading; }
+
+}  // namespace finalcut
+
+#endif  // FMAPPEDTEXTFILE_H
@@ -26,6 +26,7 @@
 #include "final/fwidgetcolors.h"
 #include "final/util/fsize.h"
 #include "final/widget/fscrollbar.h"
+#include "final/widget/fscrollview.h"
 #include "final/widget/fstatusbar.h"
 
 namespace finalcut
@@ -796,7 +797,7 @@ inline void FScrollbar::handleWidgetFocus() const
 {
   const auto& parent_widget = getParentWidget();
 
-  if ( parent_widget && ! parent_widget->isInstanceOf("FScrollView") )
+  if ( parent_widget && ! parent_widget->isInstanceOf<FScrollView>() )
     setWidgetFocus(parent_widget);
 }
 
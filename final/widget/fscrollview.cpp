@@ -4,7 +4,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2017-2024 Markus Gans                                      *
+* Copyright 2017-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -65,7 +65,7 @@ void FScrollView::setScrollWidth (std::size_t width)
   if ( viewport )
   {
     scroll_geometry.setWidth (width);
-    resizeArea (scroll_geometry, viewport.get());
+    resizeViewport();
     setColor();
     FScrollView::clearArea();
     addLocalPreprocessingHandler();
@@ -91,7 +91,7 @@ void FScrollView::setScrollHeight (std::size_t height)
   if ( viewport )
   {
     scroll_geometry.setHeight (height);
-    resizeArea (scroll_geometry, viewport.get());
+    resizeViewport();
     setColor();
     clearArea();
     addLocalPreprocessingHandler();
@@ -118,7 +118,7 @@ void FScrollView::setScrollSize (const FSize& size)
   if ( viewport )
   {
     scroll_geometry.setSize (width, height);
-    resizeArea (scroll_geometry, viewport.get());
+    resizeViewport();
     setColor();
     FScrollView::clearArea();
     addLocalPreprocessingHandler();
@@ -157,11 +157,7 @@ void FScrollView::setX (int x, bool adjust)
 
   scroll_geometry.setX (getTermX() + getLeftPadding() - 1);
 
-  if ( viewport )
-  {
-    viewport->position.x = scroll_geometry.getX();
-    viewport->position.y = scroll_geometry.getY();
-  }
+  moveViewport();
 }
 
 //----------------------------------------------------------------------
@@ -174,11 +170,7 @@ void FScrollView::setY (int y, bool adjust)
 
   scroll_geometry.setY (getTermY() + getTopPadding() - 1);
 
-  if ( viewport )
-  {
-    viewport->position.x = scroll_geometry.getX();
-    viewport->position.y = scroll_geometry.getY();
-  }
+  moveViewport();
 }
 
 //----------------------------------------------------------------------
@@ -188,11 +180,8 @@ void FScrollView::setPos (const FPoint& p, bool adjust)
   scroll_geometry.setPos ( getTermX() + getLeftPadding() - 1
                          , getTermY() + getTopPadding() - 1 );
 
-  if ( adjust || ! viewport )
-    return;
-
-  viewport->position.x = scroll_geometry.getX();
-  viewport->position.y = scroll_geometry.getY();
+  if ( ! adjust )
+    moveViewport();
 }
 
 //----------------------------------------------------------------------
@@ -237,6 +226,9 @@ void FScrollView::setHeight (std::size_t h, bool adjust)
   viewport_geometry.y1_ref() = \
       std::min ( int(getScrollHeight() - getViewportHeight())
                , viewport_geometry.getY1() );
+
+  if ( updateTileWindow() && isShown() )
+    redraw();
 }
 
 //----------------------------------------------------------------------
@@ -329,6 +321,30 @@ void FScrollView::setVerticalScrollBarMode (ScrollBarMode mode)
     setVerticalScrollBarVisibility();
 }
 
+//----------------------------------------------------------------------
+void FScrollView::setTiledViewport (bool enable)
+{
+  // With a tiled viewport, only the tiles around the visible rows
+  // are stored instead of the whole scroll area. The stored tiles
+  // are drawn again via draw() when the visible rows leave them,
+  // so the content must be printed at explicit positions.
+
+  if ( tiled_viewport == enable )
+    return;
+
+  tiled_viewport = enable;
+
+  if ( ! viewport )
+    return;
+
+  resizeViewport();
+  setColor();
+  FScrollView::clearArea();
+
+  if ( isShown() )
+    redraw();
+}
+
 //----------------------------------------------------------------------
 void FScrollView::clearArea (wchar_t fillchar)
 {
@@ -376,6 +392,12 @@ void FScrollView::scrollTo (int x, int y)
   if ( change_y )
     changeY (save_height, yoffset_end);
 
+  if ( updateTileWindow() )
+  {
+    redraw();  // Draws the newly exposed tiles
+    return;
+  }
+
   viewport->has_changes = true;
   copy2area();
 }
@@ -406,6 +428,11 @@ void FScrollView::draw()
     setReverse(false);
 
   setViewportPrint();
+  copy_all_lines = true;  // The print area may have been cleared
+
+  if ( viewport )
+    viewport->has_changes = true;
+
   copy2area();
 
   if ( ! hbar->isShown() )
@@ -660,11 +687,7 @@ void FScrollView::adjustSize()
   scroll_geometry.setPos ( getTermX() + getLeftPadding() - 1
                          , getTermY() + getTopPadding() - 1 );
 
-  if ( viewport )
-  {
-    viewport->position.x = scroll_geometry.getX();
-    viewport->position.y = scroll_geometry.getY();
-  }
+  moveViewport();
 
   vbar->setMaximum (int(getScrollHeight() - getViewportHeight()));
   vbar->setPageSize (int(getScrollHeight()), int(getViewportHeight()));
@@ -688,6 +711,8 @@ void FScrollView::adjustSize()
 void FScrollView::copy2area()
 {
   // copy viewport to area
+  // Only the changed columns of the visible lines are copied, unless
+  // the visible part has moved or the widget was drawn completely.
 
   if ( ! hasPrintArea() )
     FWidget::getPrintArea();
@@ -701,7 +726,7 @@ void FScrollView::copy2area()
   const int ax = area_widget->getLeftPadding() + getX();
   const int ay = area_widget->getTopPadding() + getY();
   const int dx = viewport_geometry.getX();
-  const int dy = viewport_geometry.getY();
+  const int dy = viewport_geometry.getY() - tile_window_y;
   const int width = printarea->size.width;
   const int height = printarea->size.height;
   const int rsh = printarea->shadow.width;
@@ -716,20 +741,46 @@ void FScrollView::copy2area()
   if ( height <= ay + y_end )
     y_end = std::max(0, height - ay);
 
-  for (auto y{0}; y < y_end; y++)  // line loop
+  const FRect source{dx, dy, std::size_t(x_end), std::size_t(y_end)};
+  const FPoint target{ax, ay};
+  const bool copy_all = copy_all_lines
+                     || source != copied_viewport
+                     || target != copied_position;
+  const auto viewport_width = uInt(viewport->size.width + viewport->shadow.width);
+  const auto max_width = uInt(width + rsh - 1);
+
+  for (auto y{0}; y < y_end && x_end > 0; y++)  // line loop
   {
+    auto& line_changes = viewport->changes[unsigned(dy + y)];
+    int first = dx;
+    int last = dx + x_end - 1;
+
+    if ( ! copy_all )
+    {
+      if ( ! line_changes.hasChanges() )
+        continue;  // Unchanged line
+
+      first = std::max(first, int(line_changes.getXMin()));
+      last = std::min(last, int(line_changes.getXMax()));
+    }
+
+    line_changes.reset(viewport_width);
+
+    if ( first > last )
+      continue;  // Changes outside the visible columns
+
     // viewport character
-    const auto& vc = viewport->getFChar(dx, dy + y);
+    const auto& vc = viewport->getFChar(first, dy + y);
     // area character
-    auto& ac = printarea->getFChar(ax, ay + y);
-    std::memcpy (&ac, &vc, sizeof(FChar) * unsigned(x_end));
-    auto& line_changes = printarea->changes[unsigned(ay + y)];
-    line_changes.xmin = std::min(line_changes.xmin, uInt(ax));
-    line_changes.xmin = std::min(line_changes.xmin, uInt(width + rsh - 1));
-    line_changes.xmax = std::max(line_changes.xmax, uInt(ax + x_end - 1));
-    line_changes.xmax = std::min(line_changes.xmax, uInt(width + rsh - 1));
+    auto& ac = printarea->getFChar(ax + first - dx, ay + y);
+    std::memcpy (&ac, &vc, sizeof(FChar) * unsigned(last - first + 1));
+    printarea->changes[unsigned(ay + y)].add ( std::min(uInt(ax + first - dx), max_width)
+                                             , std::min(uInt(ax + last - dx), max_width) );
   }
 
+  copied_viewport = source;
+  copied_position = target;
+  copy_all_lines = false;
   setViewportCursor();
   viewport->has_changes = false;
   printarea->has_changes = true;
@@ -749,20 +800,49 @@ inline auto FScrollView::getViewportCursorPos() -> FPoint
     const int x = widget_offsetX + viewport->input_cursor.x
                 - viewport_geometry.getX();
     const int y = widget_offsetY + viewport->input_cursor.y
-                - viewport_geometry.getY();
+                - viewport_geometry.getY() + tile_window_y;
     return { x, y };
   }
 
   return { -1, -1 };
 }
 
+//----------------------------------------------------------------------
+inline auto FScrollView::getViewportAreaSize() const -> FSize
+{
+  // Size of the stored viewport content
+
+  if ( ! tiled_viewport )
+    return getScrollSize();
+
+  return { getScrollWidth(), getTileWindowHeight() };
+}
+
+//----------------------------------------------------------------------
+inline auto FScrollView::getTileWindowHeight() const -> std::size_t
+{
+  // The visible rows plus one tile above and one tile below
+
+  const auto tiles = (getViewportHeight() + viewport_tile_height - 1)
+                   / viewport_tile_height + 2;
+  return std::min(tiles * viewport_tile_height, getScrollHeight());
+}
+
+//----------------------------------------------------------------------
+inline auto FScrollView::getTileWindowY() const -> int
+{
+  const auto tile_height = int(viewport_tile_height);
+  const int y = std::max(0, (getScrollY() / tile_height - 1) * tile_height);
+  return std::min(y, int(getScrollHeight() - getTileWindowHeight()));
+}
+
 //----------------------------------------------------------------------
 void FScrollView::init()
 {
   const auto& parent = getParentWidget();
 
   assert ( parent != nullptr );
-  assert ( ! parent->isInstanceOf("FScrollView") );
+  assert ( ! parent->isInstanceOf<FScrollView>() );
 
   initScrollbar (vbar, Orientation::Vertical, &FScrollView::cb_vbarChange);
   initScrollbar (hbar, Orientation::Horizontal, &FScrollView::cb_hbarChange);
@@ -801,6 +881,53 @@ inline void FScrollView::createViewport (const FSize& size) noexcept
   FScrollView::clearArea();
 }
 
+//----------------------------------------------------------------------
+void FScrollView::resizeViewport()
+{
+  if ( tiled_viewport )
+    tile_window_y = getTileWindowY();
+  else
+    tile_window_y = 0;
+
+  // The viewport position is negative when scrolled down,
+  // so it is set after resizing
+  resizeArea ({FPoint{0, 0}, getViewportAreaSize()}, viewport.get());
+  moveViewport();
+}
+
+//----------------------------------------------------------------------
+inline void FScrollView::moveViewport() const
+{
+  if ( ! viewport )
+    return;
+
+  viewport->position.x = scroll_geometry.getX();
+  viewport->position.y = scroll_geometry.getY() + tile_window_y;
+}
+
+//----------------------------------------------------------------------
+auto FScrollView::updateTileWindow() -> bool
+{
+  // Moves the stored tiles to the visible rows. Returns true
+  // if the viewport content has to be drawn again.
+
+  if ( ! tiled_viewport || ! viewport )
+    return false;
+
+  const auto window_height = int(getTileWindowHeight());
+  const int yoffset = getScrollY();
+
+  if ( viewport->size.height == window_height
+    && yoffset >= tile_window_y
+    && yoffset + int(getViewportHeight()) <= tile_window_y + window_height )
+    return false;
+
+  resizeViewport();
+  setColor();
+  FScrollView::clearArea();
+  return true;
+}
+
 //----------------------------------------------------------------------
 void FScrollView::drawText ( const FString& label_text
                            , std::size_t hotkeypos )
@@ -933,11 +1060,8 @@ void FScrollView::changeSize (const FSize& size, bool adjust)
   {
     FScrollView::setScrollSize (getViewportSize());
   }
-  else if ( ! adjust && viewport )
-  {
-    viewport->position.x = scroll_geometry.getX();
-    viewport->position.y = scroll_geometry.getY();
-  }
+  else if ( ! adjust )
+    moveViewport();
 
   if ( ! viewport )
     return;
@@ -949,6 +1073,9 @@ void FScrollView::changeSize (const FSize& size, bool adjust)
   viewport_geometry.y1_ref() = \
       std::min ( int(getScrollHeight() - getViewportHeight())
                , viewport_geometry.getY1() );
+
+  if ( updateTileWindow() && isShown() )
+    redraw();
 }
 
 //----------------------------------------------------------------------
@@ -1080,7 +1207,7 @@ void FScrollView::setViewportCursor()
     return;
 
   const FPoint cursor_pos { viewport->input_cursor.x - 1
-                          , viewport->input_cursor.y - 1 };
+                          , viewport->input_cursor.y - 1 + tile_window_y };
   const FPoint window_cursor_pos{ getViewportCursorPos() };
   auto printarea = getCurrentPrintArea();
   printarea->setInputCursorPos ( window_cursor_pos.getX()
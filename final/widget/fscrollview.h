@@ -4,7 +4,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2017-2024 Markus Gans                                      *
+* Copyright 2017-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -125,10 +125,13 @@ class FScrollView : public FWidget
     void unsetBorder();
     void setHorizontalScrollBarMode (ScrollBarMode);
     void setVerticalScrollBarMode (ScrollBarMode);
+    void setTiledViewport (bool = true);
+    void unsetTiledViewport();
 
     // Inquiries
     auto hasBorder() const -> bool;
     auto isViewportPrint() const -> bool;
+    auto isTiledViewport() const -> bool;
 
     // Methods
     void clearArea (wchar_t = L' ') override;
@@ -174,14 +177,21 @@ class FScrollView : public FWidget
     // Constants
     static constexpr std::size_t vertical_border_spacing = 2;
     static constexpr std::size_t horizontal_border_spacing = 2;
+    static constexpr std::size_t viewport_tile_height = 32;
 
     // Accessors
     auto getViewportCursorPos() -> FPoint;
+    auto getViewportAreaSize() const -> FSize;
+    auto getTileWindowHeight() const -> std::size_t;
+    auto getTileWindowY() const -> int;
 
     // Methods
     void init();
     void addLocalPreprocessingHandler();
     void createViewport (const FSize&) noexcept;
+    void resizeViewport();
+    void moveViewport() const;
+    auto updateTileWindow() -> bool;
     void drawText (const FString&, std::size_t);
     auto getDisplayedTextLength (const FString&, const std::size_t) const -> std::size_t;
     void setLabelStyle() const;
@@ -218,9 +228,14 @@ class FScrollView : public FWidget
     FScrollbarPtr              vbar{nullptr};
     FScrollbarPtr              hbar{nullptr};
     KeyMap                     key_map{};
+    FRect                      copied_viewport{};  // last copy2area() source
+    FPoint                     copied_position{};  // last copy2area() target
+    int                        tile_window_y{0};  // first stored row
     uInt8                      nf_offset{0};
     bool                       use_own_print_area{false};
+    bool                       tiled_viewport{false};
     bool                       update_scrollbar{true};
+    bool                       copy_all_lines{true};
     ScrollBarMode              v_mode{ScrollBarMode::Auto};  // fc:Auto, fc::Hidden or fc::Scroll
     ScrollBarMode              h_mode{ScrollBarMode::Auto};
 };
@@ -291,6 +306,10 @@ inline void FScrollView::unsetViewportPrint()
 inline void FScrollView::unsetBorder()
 { setBorder(false); }
 
+//----------------------------------------------------------------------
+inline void FScrollView::unsetTiledViewport()
+{ setTiledViewport(false); }
+
 //----------------------------------------------------------------------
 inline auto FScrollView::hasBorder() const -> bool
 { return ! getFlags().feature.no_border; }
@@ -299,6 +318,10 @@ inline auto FScrollView::hasBorder() const -> bool
 inline auto FScrollView::isViewportPrint() const -> bool
 { return ! use_own_print_area; }
 
+//----------------------------------------------------------------------
+inline auto FScrollView::isTiledViewport() const -> bool
+{ return tiled_viewport; }
+
 //----------------------------------------------------------------------
 inline void FScrollView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -105,7 +105,7 @@ void FStatusKey::init()
   FWidget::setGeometry (FPoint{1, 1}, FSize{1, 1});
   FWidget* parent = getParentWidget();
 
-  if ( parent && parent->isInstanceOf("FStatusBar") )
+  if ( parent && parent->isInstanceOf<FStatusBar>() )
   {
     setConnectedStatusbar (static_cast<FStatusBar*>(parent));
 
@@ -187,7 +187,7 @@ void FStatusBar::hide()
   const auto& fg = wc->term.fg;
   const auto& bg = wc->term.bg;
   setColor (fg, bg);
-  print() << FPoint{1, 1} << FString{getDesktopWidth(), L' '};
+  fillRect (FRect{FPoint{1, 1}, FSize{getDesktopWidth(), 1}});
   FWindow::hide();
 }
 
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2014-2024 Markus Gans                                      *
+* Copyright 2014-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -20,7 +20,14 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cwchar>
+#include <cwctype>
 #include <memory>
+#include <regex>
+#include <string>
 
 #include "final/dialog/fdialog.h"
 #include "final/fapplication.h"
@@ -36,6 +43,230 @@
 namespace finalcut
 {
 
+// Function prototype
+void foldCase (const wchar_t*, std::size_t, std::wstring&);
+
+// Function
+//----------------------------------------------------------------------
+void foldCase (const wchar_t* str, std::size_t length, std::wstring& result)
+{
+  result.resize(length);
+  std::transform ( str, str + length, result.begin()
+                 , [] (wchar_t ch)
+                   {
+                     return wchar_t(std::towlower(wint_t(ch)));
+                   } );
+}
+
+
+//----------------------------------------------------------------------
+// class FTextViewModel
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FTextViewModel::~FTextViewModel() noexcept = default;
+
+// public methods of FTextViewModel
+//----------------------------------------------------------------------
+auto FTextViewModel::getClassName() const -> FString
+{
+  return "FTextViewModel";
+}
+
+//----------------------------------------------------------------------
+auto FTextViewModel::getColumns() const -> std::size_t
+{
+  return 0;  // Unknown line width
+}
+
+//----------------------------------------------------------------------
+auto FTextViewModel::isLoading() const -> bool
+{
+  return false;
+}
+
+
+//----------------------------------------------------------------------
+// class FTextViewHighlighter
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FTextViewHighlighter::~FTextViewHighlighter() noexcept = default;
+
+// public methods of FTextViewHighlighter
+//----------------------------------------------------------------------
+auto FTextViewHighlighter::getClassName() const -> FString
+{
+  return "FTextViewHighlighter";
+}
+
+
+//----------------------------------------------------------------------
+// class FTextView::FTextMatcher
+//----------------------------------------------------------------------
+
+// Finds all non-overlapping matches of a search pattern in a line.
+// Literal patterns are searched with the Boyer-Moore-Horspool algorithm.
+// Its skip table is indexed with the low byte of the character.
+
+class FTextView::FTextMatcher
+{
+  public:
+    // Constructor
+    FTextMatcher (const FString&, const FTextSearchOptions&);
+
+    // Accessors
+    auto getText() const -> FString;
+    auto getOptions() const -> const FTextSearchOptions&;
+
+    // Inquiry
+    auto isValid() const -> bool;
+
+    // Method
+    void find (const FString&, std::size_t, FTextMatchList&);
+
+  private:
+    // Methods
+    void initSkipTable();
+    void findLiteral (const wchar_t*, std::size_t, std::size_t, FTextMatchList&) const;
+    void findRegex (const FString&, std::size_t, FTextMatchList&) const;
+
+    // Data members
+    FString                       text{};
+    FTextSearchOptions            options{};
+    std::wstring                  pattern{};
+    std::wstring                  folded_line{};
+    std::array<std::size_t, 256>  skip{};
+    std::wregex                   regex{};
+    bool                          valid{true};
+};
+
+//----------------------------------------------------------------------
+FTextView::FTextMatcher::FTextMatcher ( const FString& str
+                                      , const FTextSearchOptions& opts )
+  : text{str}
+  , options{opts}
+  , pattern{str.toWString()}
+{
+  if ( options.regex )
+  {
+    auto flags = std::regex_constants::ECMAScript;
+
+    if ( options.ignore_case )
+      flags |= std::regex_constants::icase;
+
+    try
+    {
+      regex.assign (pattern, flags);
+    }
+    catch (const std::regex_error&)
+    {
+      valid = false;  // Invalid regular expression
+    }
+
+    return;
+  }
+
+  if ( options.ignore_case )
+    foldCase (str.wc_str(), str.getLength(), pattern);
+
+  initSkipTable();
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextMatcher::getText() const -> FString
+{ return text; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextMatcher::getOptions() const -> const FTextSearchOptions&
+{ return options; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextMatcher::isValid() const -> bool
+{ return valid; }
+
+//----------------------------------------------------------------------
+void FTextView::FTextMatcher::find ( const FString& line, std::size_t row
+                                   , FTextMatchList& result )
+{
+  if ( options.regex )
+  {
+    findRegex (line, row, result);
+    return;
+  }
+
+  const auto length = line.getLength();
+
+  if ( length < pattern.length() )
+    return;
+
+  if ( ! options.ignore_case )
+  {
+    findLiteral (line.wc_str(), length, row, result);
+    return;
+  }
+
+  foldCase (line.wc_str(), length, folded_line);
+  findLiteral (folded_line.data(), length, row, result);
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextMatcher::initSkipTable()
+{
+  const auto length = pattern.length();
+  skip.fill(length);
+
+  for (std::size_t i{0}; i + 1 < length; i++)
+    skip[std::size_t(pattern[i]) & 0xff] = length - 1 - i;
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextMatcher::findLiteral ( const wchar_t* str
+                                          , std::size_t length
+                                          , std::size_t row
+                                          , FTextMatchList& result ) const
+{
+  const auto pattern_length = pattern.length();
+  const auto last_char = pattern[pattern_length - 1];
+  std::size_t pos{0};
+
+  while ( pos + pattern_length <= length )
+  {
+    const auto ch = str[pos + pattern_length - 1];
+
+    if ( ch == last_char
+      && std::wmemcmp(str + pos, pattern.data(), pattern_length - 1) == 0 )
+    {
+      result.push_back({row, pos, pattern_length});
+      pos += pattern_length;
+    }
+    else
+      pos += skip[std::size_t(ch) & 0xff];
+  }
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextMatcher::findRegex ( const FString& line
+                                        , std::size_t row
+                                        , FTextMatchList& result ) const
+{
+  const auto str = line.wc_str();
+  const std::wcregex_iterator end{};
+
+  for ( std::wcregex_iterator iter{str, str + line.getLength(), regex}
+      ; iter != end
+      ; ++iter )
+  {
+    const auto length = std::size_t(iter->length());
+
+    if ( length > 0 )  // Ignore empty matches
+      result.push_back({row, std::size_t(iter->position()), length});
+  }
+}
+
+
 //----------------------------------------------------------------------
 // class FTextView
 //----------------------------------------------------------------------
@@ -56,9 +287,24 @@ FTextView::~FTextView() noexcept = default;  // destructor
 //----------------------------------------------------------------------
 auto FTextView::getText() const -> FString
 {
-  if ( data.empty() )
+  if ( getRows() == 0 )
     return {""};
 
+  if ( model )
+  {
+    FString s{};
+
+    for (std::size_t row{0}; row < getRows(); row++)
+    {
+      if ( row > 0 )
+        s += L'\n';  // Add newline character
+
+      s += getLineText(row);
+    }
+
+    return s;
+  }
+
   std::size_t len{0};
 
   for (auto&& line : data)
@@ -98,38 +344,41 @@ auto FTextView::getSelectedText() const -> FString
                                      : selection_start.column;
   const auto end_col = wrong_order ? selection_start.column
                                    : selection_end.column;
-  const auto first = &getLine(start_row);
-  const auto last = &getLine(end_row);
-  const auto end = last + 1;
-  auto iter = first;
+  if ( end_row >= getRows() )
+    throw std::out_of_range("");  // Invalid range
+
   FString selected_text{};
   std::wstring line{};
 
-  while ( iter != end )
+  for (auto row = start_row; row <= end_row; row++)
   {
-    if ( iter == first )
+    const auto text = getLineText(row);
+
+    if ( row == start_row )
     {
-      if ( start_col >= iter->text.getLength() )
-      {
-        ++iter;
+      if ( start_col >= text.getLength() )
         continue;
-      }
 
-      line = iter->text.toWString().substr(start_col);
+      line = text.toWString().substr(start_col);
     }
     else
-      line = iter->text.toWString();
+      line = text.toWString();
 
-    if ( iter == last )
+    if ( row == end_row )
       line.resize(end_col + 1);
 
     selected_text += FString(line) + L'\n';  // Add newline character
-    ++iter;
   }
 
   return selected_text;
 }
 
+//----------------------------------------------------------------------
+auto FTextView::getSearchText() const -> FString
+{
+  return matcher ? matcher->getText() : FString{};
+}
+
 //----------------------------------------------------------------------
 void FTextView::setSize (const FSize& size, bool adjust)
 {
@@ -182,6 +431,83 @@ void FTextView::resetHighlight (std::size_t line)
   data[line].highlight.clear();
 }
 
+//----------------------------------------------------------------------
+void FTextView::setMaxLines (std::size_t lines)
+{
+  // Limits the number of lines (0 = unlimited). When appending
+  // more lines, the oldest lines at the beginning are removed.
+
+  max_lines = lines;
+  limitLines();
+  updateVerticalScrollBar();
+}
+
+//----------------------------------------------------------------------
+void FTextView::setFollowMode (bool enable)
+{
+  // In follow mode, the view stays at the end of the text while new
+  // lines are added. All lines added within one frame are displayed
+  // with a single update.
+
+  if ( follow_mode == enable )
+    return;
+
+  follow_mode = enable;
+  updateFrameTimer();
+
+  if ( ! follow_mode && update_pending )
+    processPendingUpdate();
+}
+
+//----------------------------------------------------------------------
+void FTextView::setModel (FTextViewModel* text_model)
+{
+  // Sets a read-only data source for the text. The text view does not
+  // take ownership of the model. A nullptr returns to the own text lines.
+
+  if ( model == text_model )
+    return;
+
+  model = text_model;
+  model_lines = model ? model->getLineCount() : 0;
+  xoffset = 0;
+  yoffset = 0;
+  resetSelection();
+  invalidateLines();
+
+  if ( model )
+    max_line_width = model->getColumns();
+  else
+    calculateLineWidths();
+
+  updateFrameTimer();
+  resetHorizontalScrollBar();
+  updateVerticalScrollBar();
+  vbar->setValue (yoffset);
+
+  if ( isShown() )
+  {
+    setColor();
+    clearArea();
+    draw();
+  }
+
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::setHighlighter (FTextViewHighlighter* text_highlighter)
+{
+  // The highlighter is called only for the lines to be drawn.
+  // The text view does not take ownership of the highlighter.
+
+  if ( highlighter == text_highlighter )
+    return;
+
+  highlighter = text_highlighter;
+  clearHighlightCache();
+}
+
 //----------------------------------------------------------------------
 void FTextView::scrollToX (int x)
 {
@@ -253,6 +579,12 @@ void FTextView::clear()
 {
   data.clear();
   data.shrink_to_fit();
+
+  if ( model )  // The model lines remain visible
+    return;
+
+  invalidateLines();
+  width_count.clear();
   xoffset = 0;
   yoffset = 0;
   max_line_width = 0;
@@ -283,12 +615,7 @@ void FTextView::clear()
   if ( size == 0 )
     return;
 
-  for (auto y{0}; y < int(getTextHeight()); y++)
-  {
-    print() << FPoint{2, 2 - nf_offset + y}
-            << FString{size, L' '};
-  }
-
+  fillRect (FRect{FPoint{2, 2 - nf_offset}, FSize{size, getTextHeight()}});
   processChanged();
 }
 
@@ -301,8 +628,13 @@ void FTextView::append (const FString& str)
 //----------------------------------------------------------------------
 void FTextView::insert (const FString& str, int pos)
 {
-  if ( pos < 0 || pos >= int(getRows()) )
-    pos = int(getRows());
+  if ( pos < 0 || pos >= int(data.size()) )
+    pos = int(data.size());
+  else if ( ! model )
+    invalidateLines();  // The following rows are shifted
+
+  if ( follow_mode && ! update_pending )  // First insert in this frame
+    follow_end = isScrolledToEnd();
 
   for (auto&& line : splitTextLines(str))  // Line loop
   {
@@ -310,6 +642,14 @@ void FTextView::insert (const FString& str, int pos)
     pos++;
   }
 
+  limitLines();
+
+  if ( follow_mode )
+  {
+    update_pending = true;  // Updates the view with the next frame
+    return;
+  }
+
   updateVerticalScrollBar();
   processChanged();
 }
@@ -319,7 +659,7 @@ void FTextView::replaceRange (const FString& str, int from, int to)
 {
   try
   {
-    deleteRange (from, to);
+    removeLines (from, to);
   }
   catch (const std::out_of_range&)
   {
@@ -332,11 +672,110 @@ void FTextView::replaceRange (const FString& str, int from, int to)
 //----------------------------------------------------------------------
 void FTextView::deleteRange (int from, int to)
 {
-  if ( from > to || from >= int(getRows()) || to >= int(getRows()) )
-    throw std::out_of_range("");  // Invalid range
+  if ( follow_mode && ! update_pending )  // First change in this frame
+    follow_end = isScrolledToEnd();
 
-  auto iter = data.cbegin();
-  data.erase (iter + from, iter + to + 1);
+  removeLines (from, to);
+
+  if ( follow_mode )
+  {
+    update_pending = true;  // Updates the view with the next frame
+    return;
+  }
+
+  // The text can be shorter and narrower now
+  const auto yoffset_end = std::max(0, int(getRows()) - int(getTextHeight()));
+  yoffset = std::min(yoffset, yoffset_end);
+  resetHorizontalScrollBar();
+  updateVerticalScrollBar();
+  vbar->setValue (yoffset);
+
+  if ( isShown() )
+  {
+    drawScrollbars();
+    drawText();
+  }
+
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+auto FTextView::find ( const FString& str
+                     , const FTextSearchOptions& options ) -> bool
+{
+  // Starts an incremental search for all matches. A large text is
+  // searched in time slices with each frame, so that the first matches
+  // appear immediately. A new search cancels the previous one.
+
+  if ( str.isEmpty() )
+  {
+    clearSearch();
+    return false;
+  }
+
+  auto new_matcher = std::make_unique<FTextMatcher>(str, options);
+
+  if ( ! new_matcher->isValid() )
+  {
+    clearSearch();
+    return false;
+  }
+
+  matcher = std::move(new_matcher);
+  restartSearch();
+  updateFrameTimer();
+  jumpToMatch (options.backward ? SearchJump::Backward : SearchJump::Forward);
+  processSearch();
+
+  if ( isShown() )
+    drawText();
+
+  processSearchChanged();
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTextView::findNext()
+{
+  if ( matcher )
+    jumpToMatch ( matcher->getOptions().backward ? SearchJump::Backward
+                                                 : SearchJump::Forward );
+}
+
+//----------------------------------------------------------------------
+void FTextView::findPrevious()
+{
+  if ( matcher )
+    jumpToMatch ( matcher->getOptions().backward ? SearchJump::Forward
+                                                 : SearchJump::Backward );
+}
+
+//----------------------------------------------------------------------
+void FTextView::clearSearch()
+{
+  if ( ! matcher )
+    return;
+
+  matcher.reset();
+  restartSearch();
+  updateFrameTimer();
+
+  if ( isShown() )
+    drawText();
+
+  processSearchChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::clearHighlightCache()
+{
+  // Must be called when the highlighting rules change
+  // or when a line was modified via getLine()
+
+  highlight_cache.clear();
+
+  if ( isShown() )
+    drawText();
 }
 
 //----------------------------------------------------------------------
@@ -452,14 +891,17 @@ void FTextView::onMouseDoubleClick (FMouseEvent* ev)
   setSelectionStartInt (click_pos.getY(), click_pos.getX());
   setSelectionEndInt (click_pos.getY(), click_pos.getX());
 
-  if ( selection_start.row >= getRows()
-    || selection_start.column >= data[selection_start.row].text.getLength() )
+  const auto text = selection_start.row < getRows()
+                  ? getLineText(selection_start.row)
+                  : FString{};
+
+  if ( selection_start.column >= text.getLength() )
   {
     resetSelection();
     return;
   }
 
-  const auto& string = data[selection_start.row].text.toWString();
+  const auto& string = text.toWString();
   auto start_pos = string.find_last_of( select_exclusion_chars
                                       , selection_start.column );
 
@@ -503,8 +945,21 @@ void FTextView::onWheel (FWheelEvent* ev)
 }
 
 //----------------------------------------------------------------------
-void FTextView::onTimer (FTimerEvent*)
+void FTextView::onTimer (FTimerEvent* ev)
 {
+  if ( ev->getTimerId() == update_timer )
+  {
+    if ( model )
+      updateModelView();
+    else if ( update_pending )
+      processPendingUpdate();
+
+    if ( matcher )
+      processSearch();
+
+    return;
+  }
+
   if ( drag_scroll == DragScrollMode::Leftward )
     dragLeft();
   else if ( drag_scroll == DragScrollMode::Rightward )
@@ -535,15 +990,7 @@ void FTextView::initLayout()
   setLeftPadding(1);
   setBottomPadding(1);
   setRightPadding(1 + nf_offset);
-
-  if ( data.empty() )
-    return;
-
-  for (const auto& line : data)
-  {
-    const auto column_width = getColumnWidth(line.text);
-    max_line_width = std::max(column_width, max_line_width);
-  }
+  calculateLineWidths();
 }
 
 //----------------------------------------------------------------------
@@ -604,6 +1051,36 @@ auto FTextView::getTextWidth() const -> std::size_t
   return getWidth() - 2 - std::size_t(nf_offset);
 }
 
+//----------------------------------------------------------------------
+auto FTextView::getLineText (std::size_t row) const -> FString
+{
+  if ( ! model )
+    return data[row].text;
+
+  // Model lines are prepared only when they are needed
+  auto line = model->getLine(row).expandTabs(getFOutput()->getTabstop());
+  return line.removeBackspaces()
+             .removeDel()
+             .replaceControlCodes()
+             .rtrim();
+}
+
+//----------------------------------------------------------------------
+auto FTextView::getLineHighlight (std::size_t row) -> const std::vector<FTextHighlight>&
+{
+  // Returns the cached highlighting of a line or asks the highlighter
+
+  const auto key = row + line_base;
+  const auto entry = highlight_cache.find(key);
+
+  if ( entry && entry->text_version == text_version )
+    return entry->highlight;
+
+  FHighlightCacheEntry new_entry{ text_version
+                                , highlighter->highlight(row, getLineText(row)) };
+  return highlight_cache.insert(key, std::move(new_entry)).highlight;
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::isWithinTextBounds (const FPoint& pos) const -> bool
 {
@@ -634,6 +1111,12 @@ inline auto FTextView::hasWrongSelectionOrder() const -> bool
   return wrong_column_order || wrong_row_order;
 }
 
+//----------------------------------------------------------------------
+inline auto FTextView::isScrolledToEnd() const -> bool
+{
+  return yoffset >= int(getRows()) - int(getTextHeight());
+}
+
 //----------------------------------------------------------------------
 void FTextView::init()
 {
@@ -724,7 +1207,7 @@ void FTextView::drawText()
 //----------------------------------------------------------------------
 inline auto FTextView::canSkipDrawing() const -> bool
 {
-  return data.empty()
+  return getRows() == 0
       || getHeight() < 3
       || getWidth() < 3;
 }
@@ -735,7 +1218,7 @@ inline void FTextView::printLine (std::size_t y)
   const std::size_t n = std::size_t(yoffset) + y;
   const std::size_t pos = std::size_t(xoffset) + 1;
   const auto text_width = getTextWidth();
-  const FString line(getColumnSubString(data[n].text, pos, text_width));
+  const FString line(getColumnSubString(getLineText(n), pos, text_width));
   print() << FPoint{2, 2 - nf_offset + int(y)};
   FVTermBuffer line_buffer{};
   line_buffer.print(line);
@@ -752,7 +1235,13 @@ inline void FTextView::printLine (std::size_t y)
     line_buffer.print() << FString{trailing_whitespace, L' '};
   }
 
-  addHighlighting (line_buffer, data[n].highlight);
+  if ( highlighter )
+    addHighlighting (line_buffer, getLineHighlight(n));
+
+  if ( ! model )
+    addHighlighting (line_buffer, data[n].highlight);
+
+  addMatchHighlighting (line_buffer, n);
   addSelection (line_buffer, n);
   print(line_buffer);
 }
@@ -822,6 +1311,37 @@ inline void FTextView::addSelection (FVTermBuffer& line_buffer, std::size_t n) c
   std::for_each (&line_buffer[start_index], &line_buffer[end_index], select);
 }
 
+//----------------------------------------------------------------------
+void FTextView::addMatchHighlighting ( FVTermBuffer& line_buffer
+                                     , std::size_t n ) const
+{
+  if ( matches.empty() )
+    return;
+
+  const auto& wc = getColorTheme();
+  const auto row = n + match_row_base;
+  auto iter = std::lower_bound ( matches.cbegin(), matches.cend(), row
+                               , [] (const FTextMatch& match, std::size_t r)
+                                 {
+                                   return match.row < r;
+                                 } );
+  std::vector<FTextHighlight> highlight{};
+
+  while ( iter != matches.cend() && iter->row == row )
+  {
+    const bool current = current_match == int(iter - matches.cbegin());
+    const FColorPair cpair = current
+                           ? FColorPair{ wc->current_element.inc_search_fg
+                                       , wc->current_element.focus_bg }
+                           : FColorPair{ wc->current_element.fg
+                                       , wc->current_element.bg };
+    highlight.emplace_back(iter->column, iter->length, cpair);
+    ++iter;
+  }
+
+  addHighlighting (line_buffer, highlight);
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::useFDialogBorder() const -> bool
 {
@@ -873,10 +1393,370 @@ inline void FTextView::processLine (FString&& line, int pos)
              .removeDel()
              .replaceControlCodes()
              .rtrim();
-  updateHorizontalScrollBar (getColumnWidth(line));
+  const auto column_width = getColumnWidth(line);
+  addLineWidth (column_width);
+
+  if ( follow_mode )  // The scroll bar is updated with the next frame
+    max_line_width = std::max(max_line_width, column_width);
+  else
+    updateHorizontalScrollBar (column_width);
+
   data.emplace (data.cbegin() + pos, std::move(line));
 }
 
+//----------------------------------------------------------------------
+void FTextView::removeLines (int from, int to)
+{
+  if ( from > to || from >= int(data.size()) || to >= int(data.size()) )
+    throw std::out_of_range("");  // Invalid range
+
+  auto iter = data.cbegin();
+
+  for (auto line = iter + from; line != iter + to + 1; ++line)
+    removeLineWidth (getColumnWidth(line->text));
+
+  data.erase (iter + from, iter + to + 1);
+
+  if ( ! model )
+    invalidateLines();
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::addLineWidth (std::size_t column_width)
+{
+  // Counts the lines per column width
+
+  if ( column_width >= width_count.size() )
+    width_count.resize(column_width + 1, 0);
+
+  width_count[column_width]++;
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::removeLineWidth (std::size_t column_width)
+{
+  if ( column_width >= width_count.size() || width_count[column_width] == 0 )
+    return;
+
+  width_count[column_width]--;
+
+  if ( column_width < max_line_width || width_count[column_width] > 0 )
+    return;
+
+  // The longest line was removed
+  while ( max_line_width > 0 && width_count[max_line_width] == 0 )
+    max_line_width--;
+
+  width_count.resize(max_line_width + 1);
+}
+
+//----------------------------------------------------------------------
+void FTextView::calculateLineWidths()
+{
+  width_count.clear();
+  max_line_width = 0;
+
+  for (const auto& line : data)
+  {
+    const auto column_width = getColumnWidth(line.text);
+    addLineWidth (column_width);
+    max_line_width = std::max(column_width, max_line_width);
+  }
+
+  if ( model )
+    max_line_width = model->getColumns();
+}
+
+//----------------------------------------------------------------------
+inline void FTextView::limitLines()
+{
+  if ( max_lines == 0 || data.size() <= max_lines )
+    return;
+
+  evictLines (data.size() - max_lines);
+
+  if ( follow_mode )  // The scroll bars are updated with the next frame
+    return;
+
+  resetHorizontalScrollBar();
+  vbar->setValue (yoffset);
+}
+
+//----------------------------------------------------------------------
+void FTextView::evictLines (std::size_t count)
+{
+  // Removes the oldest lines from the beginning of the text
+
+  for (std::size_t n{0}; n < count; n++)
+  {
+    removeLineWidth (getColumnWidth(data.front().text));
+    data.pop_front();
+  }
+
+  if ( model )  // The view shows the model lines
+    return;
+
+  // Keep the visible text in place
+  yoffset = std::max(0, yoffset - int(count));
+  line_base += count;  // Keeps the cached highlighting valid
+  shiftMatches (count);
+
+  if ( selection_start.row == UNINITIALIZED_ROW
+    || selection_end.row == UNINITIALIZED_ROW )
+    return;
+
+  if ( selection_start.row < count || selection_end.row < count )
+  {
+    resetSelection();
+    return;
+  }
+
+  selection_start.row -= count;
+  selection_end.row -= count;
+}
+
+//----------------------------------------------------------------------
+void FTextView::processPendingUpdate()
+{
+  // All changes within a frame are displayed in a single update
+
+  update_pending = false;
+  const auto yoffset_end = std::max(0, int(getRows()) - int(getTextHeight()));
+  yoffset = follow_end ? yoffset_end : std::min(yoffset, yoffset_end);
+  resetHorizontalScrollBar();
+  updateVerticalScrollBar();
+  vbar->setValue (yoffset);
+
+  if ( isShown() )
+  {
+    drawScrollbars();
+    drawText();
+  }
+
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateFrameTimer()
+{
+  // The frame timer runs in follow mode, while a model is set
+  // or while a search is active
+
+  const bool needed = follow_mode || model || matcher;
+
+  if ( needed && ! update_timer )
+    update_timer = addTimer(FRAME_INTERVAL);
+  else if ( ! needed && update_timer )
+  {
+    delTimer (update_timer);
+    update_timer = 0;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateModelView()
+{
+  // Takes over the new lines of a loading model
+
+  const auto lines = model->getLineCount();
+  const auto columns = model->getColumns();
+
+  if ( lines == model_lines && columns == max_line_width )
+    return;
+
+  if ( lines < model_lines )  // The model was replaced
+    invalidateLines();
+
+  follow_end = follow_mode && isScrolledToEnd();
+  model_lines = lines;
+  max_line_width = columns;
+  processPendingUpdate();
+}
+
+//----------------------------------------------------------------------
+void FTextView::processSearch()
+{
+  // Searches the next lines within one time slice. Lines that are
+  // appended later are searched with the following frames.
+
+  const auto rows = getRows();
+
+  if ( search_row >= rows && search_jump == SearchJump::None )
+    return;
+
+  const auto match_count = matches.size();
+  const auto start = std::chrono::steady_clock::now();
+  const auto time_slice = std::chrono::milliseconds(int(SEARCH_TIME_SLICE));
+
+  while ( search_row < rows )
+  {
+    const auto row = search_row + match_row_base;
+
+    if ( model )
+      matcher->find (getLineText(search_row), row, matches);
+    else
+      matcher->find (data[search_row].text, row, matches);
+
+    search_row++;
+
+    if ( (search_row & 0x3ff) == 0
+      && std::chrono::steady_clock::now() - start >= time_slice )
+      break;
+  }
+
+  const auto old_match = current_match;
+  resolveSearchJump();
+
+  if ( matches.size() == match_count || current_match != old_match )
+    return;  // Nothing new or already drawn by selectMatch()
+
+  if ( isShown() )
+    drawText();
+
+  processSearchChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::restartSearch()
+{
+  matches.clear();
+  match_row_base = 0;
+  current_match = -1;
+  search_jump = SearchJump::None;
+  search_row = 0;
+}
+
+//----------------------------------------------------------------------
+void FTextView::invalidateLines()
+{
+  // The line contents or line numbers have changed
+
+  text_version++;
+  restartSearch();
+}
+
+//----------------------------------------------------------------------
+void FTextView::shiftMatches (std::size_t count)
+{
+  // Removes the matches of evicted lines. The row numbers of the
+  // remaining matches remain valid by increasing the row base.
+
+  match_row_base += count;
+  search_row = ( search_row > count ) ? search_row - count : 0;
+  search_pos.row = ( search_pos.row > count ) ? search_pos.row - count : 0;
+  int removed{0};
+
+  while ( ! matches.empty() && matches.front().row < match_row_base )
+  {
+    matches.pop_front();
+    removed++;
+  }
+
+  if ( current_match >= 0 )
+    current_match = ( current_match < removed ) ? -1 : current_match - removed;
+}
+
+//----------------------------------------------------------------------
+void FTextView::resolveSearchJump()
+{
+  // Selects the match to which findNext() or findPrevious() jumps,
+  // as soon as the required lines are searched
+
+  if ( search_jump == SearchJump::None )
+    return;
+
+  const bool finished = search_row >= getRows();
+  const FTextPosition pos{search_pos.row + match_row_base, search_pos.column};
+  const auto iter = std::lower_bound ( matches.cbegin(), matches.cend(), pos
+                                     , [] (const FTextMatch& match, const FTextPosition& p)
+                                       {
+                                         return match.row < p.row
+                                             || ( match.row == p.row
+                                               && match.column < p.column );
+                                       } );
+  const auto index = std::size_t(iter - matches.cbegin());
+
+  if ( search_jump == SearchJump::Forward )
+  {
+    if ( iter != matches.cend() )  // First match at or after the position
+      selectMatch (index);
+    else if ( ! finished )
+      return;
+    else if ( ! matches.empty() )  // Wrap around
+      selectMatch (0);
+  }
+  else
+  {
+    if ( ! finished && search_row <= search_pos.row )
+      return;
+
+    if ( index > 0 )  // Last match before the position
+      selectMatch (index - 1);
+    else if ( ! finished )
+      return;
+    else if ( ! matches.empty() )  // Wrap around
+      selectMatch (matches.size() - 1);
+  }
+
+  search_jump = SearchJump::None;
+}
+
+//----------------------------------------------------------------------
+void FTextView::jumpToMatch (SearchJump direction)
+{
+  if ( current_match < 0 )
+  {
+    // Starts from the visible text
+    const auto row = std::size_t(yoffset);
+    search_pos = ( direction == SearchJump::Forward )
+               ? FTextPosition{row, 0}
+               : FTextPosition{row + getTextHeight(), 0};
+  }
+  else
+  {
+    const auto& match = getMatch(std::size_t(current_match));
+    search_pos = ( direction == SearchJump::Forward )
+               ? FTextPosition{match.row, match.column + 1}
+               : FTextPosition{match.row, match.column};
+  }
+
+  search_jump = direction;
+  resolveSearchJump();
+}
+
+//----------------------------------------------------------------------
+void FTextView::selectMatch (std::size_t index)
+{
+  current_match = int(index);
+  scrollToMatch (getMatch(index));
+  processSearchChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::scrollToMatch (const FTextMatch& match)
+{
+  // Scrolls the match into the visible area
+
+  const auto height = getTextHeight();
+  const auto width = getTextWidth();
+  auto x = xoffset;
+  auto y = yoffset;
+
+  if ( match.row < std::size_t(yoffset)
+    || match.row >= std::size_t(yoffset) + height )
+    y = int(match.row) - int(height / 2);
+
+  if ( match.column < std::size_t(xoffset) )
+    x = int(match.column);
+  else if ( match.column + match.length > std::size_t(xoffset) + width )
+    x = int(match.column + match.length) - int(width);
+
+  if ( x != xoffset || y != yoffset )
+    scrollTo (x, y);
+  else if ( isShown() )
+    drawText();
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::getScrollBarMaxHorizontal() const noexcept -> int
 {
@@ -930,6 +1810,25 @@ inline void FTextView::updateHorizontalScrollBar (std::size_t column_width)
     hbar->show();
 }
 
+//----------------------------------------------------------------------
+inline void FTextView::resetHorizontalScrollBar()
+{
+  // Adopts the horizontal scroll bar to the current maximum line width
+
+  const auto xoffset_end = std::max(0, int(max_line_width) - int(getTextWidth()));
+  xoffset = std::min(xoffset, xoffset_end);
+  hbar->setMaximum (getScrollBarMaxHorizontal());
+  hbar->setPageSize (int(max_line_width), int(getTextWidth()));
+  hbar->setValue (xoffset);
+  hbar->calculateSliderValues();
+
+  if ( isShown() && ! hbar->isShown() && isHorizontallyScrollable() )
+    hbar->show();
+
+  if ( isShown() && hbar->isShown() && ! isHorizontallyScrollable() )
+    hbar->hide();
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::convertMouse2TextPos (const FPoint& pos) const -> FPoint
 {
@@ -999,17 +1898,10 @@ void FTextView::handleMouseDragging (const FMouseEvent* ev)
 inline void FTextView::handleLeftDragScroll()
 {
   if ( xoffset > 0 )
-  {
-    drag_scroll = DragScrollMode::Leftward;
-    delOwnTimers();
-    addTimer(scroll_repeat);
-  }
+    startDragScroll (DragScrollMode::Leftward);
 
   if ( xoffset == 0 )
-  {
-    delOwnTimers();
-    drag_scroll = DragScrollMode::None;
-  }
+    stopDragScroll();
 }
 
 //----------------------------------------------------------------------
@@ -1018,34 +1910,20 @@ inline void FTextView::handleRightDragScroll()
   const auto xoffset_end = int(max_line_width - getTextWidth());
 
   if ( xoffset < xoffset_end )
-  {
-    drag_scroll = DragScrollMode::Rightward;
-    delOwnTimers();
-    addTimer(scroll_repeat);
-  }
+    startDragScroll (DragScrollMode::Rightward);
 
   if ( xoffset == xoffset_end )
-  {
-    delOwnTimers();
-    drag_scroll = DragScrollMode::None;
-  }
+    stopDragScroll();
 }
 
 //----------------------------------------------------------------------
 inline void FTextView::handleUpDragScroll()
 {
   if ( yoffset > 0 )
-  {
-    drag_scroll = DragScrollMode::Upward;
-    delOwnTimers();
-    addTimer(scroll_repeat);
-  }
+    startDragScroll (DragScrollMode::Upward);
 
   if ( yoffset == 0 )
-  {
-    delOwnTimers();
-    drag_scroll = DragScrollMode::None;
-  }
+    stopDragScroll();
 }
 
 //----------------------------------------------------------------------
@@ -1054,17 +1932,10 @@ inline void FTextView::handleDownDragScroll()
   const auto yoffset_end = int(getRows() - getTextHeight());
 
   if ( yoffset < yoffset_end )
-  {
-    drag_scroll = DragScrollMode::Downward;
-    delOwnTimers();
-    addTimer(scroll_repeat);
-  }
+    startDragScroll (DragScrollMode::Downward);
 
   if ( yoffset == yoffset_end )
-  {
-    delOwnTimers();
-    drag_scroll = DragScrollMode::None;
-  }
+    stopDragScroll();
 }
 
 //----------------------------------------------------------------------
@@ -1143,10 +2014,19 @@ void FTextView::dragDown()
   }
 }
 
+//----------------------------------------------------------------------
+void FTextView::startDragScroll (DragScrollMode mode)
+{
+  delTimer (drag_timer);
+  drag_scroll = mode;
+  drag_timer = addTimer(scroll_repeat);
+}
+
 //----------------------------------------------------------------------
 void FTextView::stopDragScroll()
 {
-  delOwnTimers();
+  delTimer (drag_timer);
+  drag_timer = 0;
   drag_scroll = DragScrollMode::None;
 }
 
@@ -1156,6 +2036,12 @@ void FTextView::processChanged() const
   emitCallback("changed");
 }
 
+//----------------------------------------------------------------------
+void FTextView::processSearchChanged() const
+{
+  emitCallback("search-changed");
+}
+
 //----------------------------------------------------------------------
 void FTextView::changeOnResize() const
 {
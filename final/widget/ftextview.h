@@ -47,6 +47,7 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <deque>
 #include <limits>
 #include <limits>
 #include <memory>
@@ -59,20 +60,50 @@
 
 #include "final/fwidgetcolors.h"
 #include "final/fwidget.h"
+#include "final/util/flrucache.h"
 #include "final/util/fstring.h"
 #include "final/util/fstringstream.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fstyle.h"
+#include "final/widget/fscrollbar.h"
 
 namespace finalcut
 {
 
 // class forward declaration
 class FScrollbar;
+class FTextViewHighlighter;
 
 // Global using-declaration
 using FScrollbarPtr = std::shared_ptr<FScrollbar>;
 
+//----------------------------------------------------------------------
+// class FTextViewModel
+//----------------------------------------------------------------------
+
+// Read-only data source for a text view. The text view only requests
+// the lines it shows. A model that is still loading is polled with each
+// frame, so that the number of lines can grow.
+
+class FTextViewModel
+{
+  public:
+    // Constructor
+    FTextViewModel() = default;
+
+    // Destructor
+    virtual ~FTextViewModel() noexcept;
+
+    // Accessors
+    virtual auto getClassName() const -> FString;
+    virtual auto getLineCount() const -> std::size_t = 0;
+    virtual auto getLine (std::size_t) const -> FString = 0;
+    virtual auto getColumns() const -> std::size_t;
+
+    // Inquiry
+    virtual auto isLoading() const -> bool;
+};
+
 //----------------------------------------------------------------------
 // class FTextView
 //----------------------------------------------------------------------
@@ -153,7 +184,7 @@ class FTextView : public FWidget
     };
 
     // Using-declarations
-    using FTextViewList = std::vector<FTextViewLine>;
+    using FTextViewList = std::deque<FTextViewLine>;
     using FWidget::setGeometry;
 
     struct FTextPosition
@@ -162,6 +193,20 @@ class FTextView : public FWidget
       FString::size_type       column{UNINITIALIZED_COLUMN};
     };
 
+    struct FTextSearchOptions
+    {
+      bool regex{false};        // ECMAScript regular expression
+      bool ignore_case{false};
+      bool backward{false};     // Search direction of findNext()
+    };
+
+    struct FTextMatch
+    {
+      std::size_t row{};
+      std::size_t column{};
+      std::size_t length{};
+    };
+
     // Constructor
     explicit FTextView (FWidget* = nullptr);
 
@@ -188,6 +233,14 @@ class FTextView : public FWidget
     auto getLine (FTextViewList::size_type) -> FTextViewLine&;
     auto getLine (FTextViewList::size_type) const -> const FTextViewLine&;
     auto getLines() const & -> const FTextViewList&;
+    auto getMaxLines() const noexcept -> std::size_t;
+    auto getModel() const -> FTextViewModel*;
+    auto getHighlighter() const -> FTextViewHighlighter*;
+    auto getHighlightCacheSize() const noexcept -> std::size_t;
+    auto getSearchText() const -> FString;
+    auto getMatchCount() const noexcept -> std::size_t;
+    auto getMatch (std::size_t) const -> FTextMatch;
+    auto getCurrentMatch() const noexcept -> int;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
@@ -203,6 +256,14 @@ class FTextView : public FWidget
     void setLines (T&&);
     void setSelectable (bool = true);
     void unsetSelectable();
+    void setMaxLines (std::size_t);
+    void setFollowMode (bool = true);
+    void unsetFollowMode();
+    void setModel (FTextViewModel*);
+    void unsetModel();
+    void setHighlighter (FTextViewHighlighter*);
+    void unsetHighlighter();
+    void setHighlightCacheSize (std::size_t);
     void scrollToX (int);
     void scrollToY (int);
     void scrollTo (const FPoint&);
@@ -214,6 +275,10 @@ class FTextView : public FWidget
     // Inquiry
     auto hasSelectedText() const -> bool;
     auto isSelectable() const -> bool;
+    auto isFollowMode() const -> bool;
+    auto hasModel() const -> bool;
+    auto hasHighlighter() const -> bool;
+    auto isSearching() const -> bool;
 
     // Methods
     void hide() override;
@@ -227,6 +292,12 @@ class FTextView : public FWidget
     void replaceRange (const FString&, int, int);
     void deleteRange (int, int);
     void deleteLine (int);
+    auto find (const FString&) -> bool;
+    auto find (const FString&, const FTextSearchOptions&) -> bool;
+    void findNext();
+    void findPrevious();
+    void clearSearch();
+    void clearHighlightCache();
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
@@ -246,13 +317,33 @@ class FTextView : public FWidget
     // Constants
     static constexpr auto UNINITIALIZED_ROW = static_cast<FTextViewList::size_type>(-1);
     static constexpr auto UNINITIALIZED_COLUMN = static_cast<FString::size_type>(-1);
+    static constexpr int FRAME_INTERVAL = 20;  // Follow mode update (ms)
+    static constexpr int SEARCH_TIME_SLICE = 8;  // Search time per frame (ms)
+
+    // Class forward declaration
+    class FTextMatcher;
+
+    // Enumeration
+    enum class SearchJump { None, Forward, Backward };
 
     // Using-declaration
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
+    using FTextMatcherPtr = std::unique_ptr<FTextMatcher>;
+    using FTextMatchList = std::deque<FTextMatch>;
+
+    struct FHighlightCacheEntry
+    {
+      std::size_t text_version{};
+      std::vector<FTextHighlight> highlight{};
+    };
+
+    using FHighlightCache = FLruCache<std::size_t, FHighlightCacheEntry>;
 
     // Accessors
     auto getTextHeight() const -> std::size_t;
     auto getTextWidth() const -> std::size_t;
+    auto getLineText (std::size_t) const -> FString;
+    auto getLineHighlight (std::size_t) -> const std::vector<FTextHighlight>&;
 
     // Inquiry
     auto isHorizontallyScrollable() const -> bool;
@@ -260,6 +351,7 @@ class FTextView : public FWidget
     auto isWithinTextBounds (const FPoint&) const -> bool;
     auto isLowerRightResizeCorner (const FPoint&) const -> bool;
     auto hasWrongSelectionOrder() const -> bool;
+    auto isScrolledToEnd() const -> bool;
 
     // Methods
     void init();
@@ -273,10 +365,33 @@ class FTextView : public FWidget
     void addHighlighting ( FVTermBuffer&
                          , const std::vector<FTextHighlight>& ) const;
     void addSelection (FVTermBuffer&, std::size_t) const;
+    void addMatchHighlighting (FVTermBuffer&, std::size_t) const;
     auto useFDialogBorder() const -> bool;
     auto isPrintable (wchar_t) const -> bool;
     auto splitTextLines (const FString&) const -> FStringList;
     void processLine (FString&&, int);
+    void removeLines (int, int);
+    void addLineWidth (std::size_t);
+    void removeLineWidth (std::size_t);
+    void calculateLineWidths();
+    void assignLines (FTextViewList&&);
+    void assignLines (const FTextViewList&);
+    template <typename Container>
+    void assignLines (const Container&);
+    void limitLines();
+    void evictLines (std::size_t);
+    void processPendingUpdate();
+    void updateFrameTimer();
+    void updateModelView();
+    void processSearch();
+    void restartSearch();
+    void invalidateLines();
+    void shiftMatches (std::size_t);
+    void resolveSearchJump();
+    void jumpToMatch (SearchJump);
+    void selectMatch (std::size_t);
+    void scrollToMatch (const FTextMatch&);
+    void processSearchChanged() const;
     template<typename T1, typename T2>
     void setSelectionStartInt (T1&&, T2&&);
     template<typename T1, typename T2>
@@ -285,6 +400,7 @@ class FTextView : public FWidget
     auto getScrollBarMaxVertical() const noexcept -> int;
     void updateVerticalScrollBar() const;
     void updateHorizontalScrollBar (std::size_t);
+    void resetHorizontalScrollBar();
     auto convertMouse2TextPos (const FPoint&) const -> FPoint;
     void handleMouseWithinListBounds (const FPoint&);
     void handleMouseDragging (const FMouseEvent*);
@@ -296,6 +412,7 @@ class FTextView : public FWidget
     void dragRight();
     void dragUp();
     void dragDown();
+    void startDragScroll (DragScrollMode);
     void stopDragScroll();
     void processChanged() const;
     void changeOnResize() const;
@@ -309,6 +426,14 @@ class FTextView : public FWidget
 
     // Data members
     FTextViewList   data{};
+    std::vector<std::size_t> width_count{};
+    FTextViewModel* model{nullptr};
+    FTextViewHighlighter* highlighter{nullptr};
+    FHighlightCache highlight_cache{512};
+    FTextMatcherPtr matcher{};
+    FTextMatchList  matches{};  // Rows are counted from match_row_base
+    FTextPosition   search_pos{};
+    SearchJump      search_jump{SearchJump::None};
     FScrollbarPtr   vbar{nullptr};
     FScrollbarPtr   hbar{nullptr};
     FTextPosition   selection_start{};
@@ -319,11 +444,23 @@ class FTextView : public FWidget
     bool            update_scrollbar{true};
     bool            pass_to_dialog{false};
     bool            selectable{false};
+    bool            follow_mode{false};
+    bool            follow_end{false};
+    bool            update_pending{false};
     int             scroll_repeat{100};
+    int             drag_timer{0};
+    int             update_timer{0};
+    int             current_match{-1};
     int             xoffset{0};
     int             yoffset{0};
     int             nf_offset{0};
     std::size_t     max_line_width{0};
+    std::size_t     max_lines{0};
+    std::size_t     model_lines{0};
+    std::size_t     search_row{0};
+    std::size_t     match_row_base{0};
+    std::size_t     text_version{0};  // Changes when lines are edited
+    std::size_t     line_base{0};     // Number of evicted lines
 };
 
 // FListBox inline functions
@@ -371,7 +508,7 @@ inline auto FTextView::getColumns() const noexcept -> std::size_t
 
 //----------------------------------------------------------------------
 inline auto FTextView::getRows() const -> std::size_t
-{ return std::size_t(data.size()); }
+{ return model ? model_lines : std::size_t(data.size()); }
 
 //----------------------------------------------------------------------
 inline auto FTextView::getScrollPos() const -> FPoint
@@ -401,6 +538,37 @@ inline auto FTextView::getLine (FTextViewList::size_type line) const -> const FT
 inline auto FTextView::getLines() const & -> const FTextViewList&
 { return data; }
 
+//----------------------------------------------------------------------
+inline auto FTextView::getMaxLines() const noexcept -> std::size_t
+{ return max_lines; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getModel() const -> FTextViewModel*
+{ return model; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getHighlighter() const -> FTextViewHighlighter*
+{ return highlighter; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getHighlightCacheSize() const noexcept -> std::size_t
+{ return highlight_cache.getCapacity(); }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getMatchCount() const noexcept -> std::size_t
+{ return matches.size(); }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getMatch (std::size_t index) const -> FTextMatch
+{
+  const auto& match = matches.at(index);
+  return {match.row - match_row_base, match.column, match.length};
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::getCurrentMatch() const noexcept -> int
+{ return current_match; }
+
 //----------------------------------------------------------------------
 inline void FTextView::setSelectionStart ( const FTextViewList::size_type row
                                          , const FString::size_type col )
@@ -422,8 +590,13 @@ inline void FTextView::resetSelection()
 template <typename T>
 inline void FTextView::setLines (T&& list)
 {
+  // The list can also be another container of FTextViewLine
+  // objects, e.g. a std::vector
+
   clear();
-  data = std::forward<T>(list);
+  assignLines (std::forward<T>(list));
+  calculateLineWidths();
+  limitLines();
   updateVerticalScrollBar();
   processChanged();
 }
@@ -436,6 +609,22 @@ inline void FTextView::setSelectable (bool enable)
 inline void FTextView::unsetSelectable()
 { selectable = false; }
 
+//----------------------------------------------------------------------
+inline void FTextView::unsetFollowMode()
+{ setFollowMode(false); }
+
+//----------------------------------------------------------------------
+inline void FTextView::unsetModel()
+{ setModel(nullptr); }
+
+//----------------------------------------------------------------------
+inline void FTextView::unsetHighlighter()
+{ setHighlighter(nullptr); }
+
+//----------------------------------------------------------------------
+inline void FTextView::setHighlightCacheSize (std::size_t size)
+{ highlight_cache.setCapacity(size); }
+
 //----------------------------------------------------------------------
 inline void FTextView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
@@ -453,6 +642,26 @@ inline auto FTextView::hasSelectedText() const -> bool
 inline auto FTextView::isSelectable() const -> bool
 { return selectable; }
 
+//----------------------------------------------------------------------
+inline auto FTextView::isFollowMode() const -> bool
+{ return follow_mode; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::hasModel() const -> bool
+{ return model != nullptr; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::hasHighlighter() const -> bool
+{ return highlighter != nullptr; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::isSearching() const -> bool
+{ return matcher && search_row < getRows(); }
+
+//----------------------------------------------------------------------
+inline auto FTextView::find (const FString& str) -> bool
+{ return find(str, FTextSearchOptions{}); }
+
 //----------------------------------------------------------------------
 template <typename T>
 void FTextView::append (const std::initializer_list<T>& list)
@@ -484,6 +693,19 @@ inline auto FTextView::isHorizontallyScrollable() const -> bool
 inline auto FTextView::isVerticallyScrollable() const -> bool
 { return getRows() > getTextHeight(); }
 
+//----------------------------------------------------------------------
+inline void FTextView::assignLines (FTextViewList&& list)
+{ data = std::move(list); }
+
+//----------------------------------------------------------------------
+inline void FTextView::assignLines (const FTextViewList& list)
+{ data = list; }
+
+//----------------------------------------------------------------------
+template <typename Container>
+inline void FTextView::assignLines (const Container& list)
+{ data.assign (std::begin(list), std::end(list)); }
+
 //----------------------------------------------------------------------
 template<typename T1, typename T2>
 inline void FTextView::setSelectionStartInt (T1&& row, T2&& col)
@@ -500,6 +722,34 @@ inline void FTextView::setSelectionEndInt (T1&& row, T2&& col)
                   , static_cast<const FString::size_type>(std::forward<T2>(col)) };
 }
 
+
+//----------------------------------------------------------------------
+// class FTextViewHighlighter
+//----------------------------------------------------------------------
+
+// Computes the highlighting of a line when it is about to be drawn.
+// The text view caches the results for the recently drawn lines.
+
+class FTextViewHighlighter
+{
+  public:
+    // Using-declarations
+    using FTextHighlight = FTextView::FTextHighlight;
+    using FTextHighlightList = std::vector<FTextHighlight>;
+
+    // Constructor
+    FTextViewHighlighter() = default;
+
+    // Destructor
+    virtual ~FTextViewHighlighter() noexcept;
+
+    // Accessor
+    virtual auto getClassName() const -> FString;
+
+    // Method
+    virtual auto highlight (std::size_t, const FString&) -> FTextHighlightList = 0;
+};
+
 }  // namespace finalcut
 
 #endif  // FTEXTVIEW_H
@@ -27,6 +27,8 @@
 #include "final/fwidget.h"
 #include "final/util/fpoint.h"
 #include "final/widget/fbuttongroup.h"
+#include "final/widget/fcheckbox.h"
+#include "final/widget/fradiobutton.h"
 #include "final/widget/fstatusbar.h"
 #include "final/widget/ftogglebutton.h"
 
@@ -44,7 +46,7 @@ FToggleButton::FToggleButton (FWidget* parent)
 {
   init();
 
-  if ( parent && parent->isInstanceOf("FButtonGroup") )
+  if ( parent && parent->isInstanceOf<FButtonGroup>() )
   {
     setGroup(static_cast<FButtonGroup*>(parent));
 
@@ -60,7 +62,7 @@ FToggleButton::FToggleButton (const FString& txt, FWidget* parent)
   FToggleButton::setText(txt);  // call own method
   init();
 
-  if ( parent && parent->isInstanceOf("FButtonGroup") )
+  if ( parent && parent->isInstanceOf<FButtonGroup>() )
   {
     setGroup(static_cast<FButtonGroup*>(parent));
 
@@ -273,13 +275,13 @@ void FToggleButton::setHotkeyAccelerator()
 //----------------------------------------------------------------------
 auto FToggleButton::isRadioButton() const -> bool
 {
-  return isInstanceOf("FRadioButton");
+  return isInstanceOf<FRadioButton>();
 }
 
 //----------------------------------------------------------------------
 auto FToggleButton::isCheckboxButton() const -> bool
 {
-  return isInstanceOf("FCheckBox");
+  return isInstanceOf<FCheckBox>();
 }
 
 //----------------------------------------------------------------------
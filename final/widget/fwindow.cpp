@@ -355,8 +355,12 @@ void FWindow::setPos (const FPoint& p, bool adjust)
   if ( isVirtualWindow() )
   {
     auto virtual_win = getVWin();
+    const FPoint old_pos{virtual_win->position.x, virtual_win->position.y};
     virtual_win->position.x = getTermX() - 1;
     virtual_win->position.y = getTermY() - 1;
+
+    if ( old_pos != FPoint{virtual_win->position.x, virtual_win->position.y} )
+      trackAreaMove (virtual_win, old_pos);
   }
 }
 
@@ -441,8 +445,12 @@ void FWindow::move (const FPoint& pos)
   if ( isVirtualWindow() )
   {
     auto virtual_win = getVWin();
+    const FPoint old_pos{virtual_win->position.x, virtual_win->position.y};
     virtual_win->position.x = getTermX() - 1;
     virtual_win->position.y = getTermY() - 1;
+
+    if ( old_pos != FPoint{virtual_win->position.x, virtual_win->position.y} )
+      trackAreaMove (virtual_win, old_pos);
   }
 }
 
@@ -943,7 +951,7 @@ void FWindow::reactivateWindow (FWindow* active_win)
   if ( ! active_win->isWindowActive() )
     FWindow::setActiveWindow(active_win);
 
-  if ( focus && ! focus->isInstanceOf("FMenuItem") )
+  if ( focus && ! focus->isInstanceOf<FMenuItem>() )
   {
     // Renew the focus of the focused widget in the current window
     auto last_focus = FWidget::getFocusWidget();
@@ -983,8 +991,7 @@ void closeDropDown (const FWidget* widget, const FPoint& mouse_position)
   if ( ! openmenu )
     return;
 
-  if ( openmenu->isInstanceOf("FMenu")
-    || openmenu->isInstanceOf("FDialogListMenu") )
+  if ( openmenu->isInstanceOf<FMenu>() )  // incl. FDialogListMenu
   {
     bool contains_menu_structure;
     auto menu = static_cast<FMenu*>(openmenu);
@@ -995,7 +1002,7 @@ void closeDropDown (const FWidget* widget, const FPoint& mouse_position)
       return;
   }
 
-  if ( openmenu->isInstanceOf("FDropDownListBox") )
+  if ( openmenu->isInstanceOf<FDropDownListBox>() )
   {
     auto drop_down = static_cast<FDropDownListBox*>(openmenu);
 
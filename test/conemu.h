@@ -76,7 +76,10 @@ class ConEmu
       tmux,
       kterm,
       mlterm,
-      kitty
+      kitty,
+      dec_vt420,
+      dec_vt510,
+      dec_vt520
     };
 
     // Constructors
@@ -670,7 +673,10 @@ inline auto ConEmu::getAnswerback (console con) -> const char*
     nullptr,         // tmux
     nullptr,         // kterm,
     nullptr,         // mlterm - Multi Lingual TERMinal
-    nullptr          // kitty
+    nullptr,         // kitty
+    nullptr,         // DEC VT420
+    nullptr,         // DEC VT510
+    nullptr          // DEC VT520
   };
 
   return Answerback[static_cast<std::size_t>(con)];
@@ -703,7 +709,10 @@ inline auto ConEmu::getDSR (console con) -> const char*
     C_STR("\033[0n"),  // tmux
     C_STR("\033[0n"),  // kterm
     C_STR("\033[0n"),  // mlterm - Multi Lingual TERMinal
-    C_STR("\033[0n")   // kitty
+    C_STR("\033[0n"),  // kitty
+    C_STR("\033[0n"),  // DEC VT420
+    C_STR("\033[0n"),  // DEC VT510
+    C_STR("\033[0n")   // DEC VT520
   };
 
   return DSR[static_cast<std::size_t>(con)];
@@ -736,7 +745,10 @@ inline auto ConEmu::getDECID (console con) -> const char*
     nullptr,                               // tmux
     C_STR("\033[?1;2c"),                   // kterm
     C_STR("\033[?63;1;2;3;4;7;29c"),       // mlterm - Multi Lingual TERMinal
-    nullptr                                // kitty
+    nullptr,                               // kitty
+    C_STR("\033[?64;1;2;6;9;15;22c"),      // DEC VT420
+    C_STR("\033[?64;1;2;7;8;9;15;18c"),    // DEC VT510
+    C_STR("\033[?65;1;2;7;8;9;12;18c")     // DEC VT520
   };
 
   return DECID[static_cast<std::size_t>(con)];
@@ -769,7 +781,10 @@ inline auto ConEmu::getDA (console con) -> const char*
     C_STR("\033[?1;2c"),                   // tmux
     C_STR("\033[?1;2c"),                   // kterm
     C_STR("\033[?63;1;2;3;4;7;29c"),       // mlterm - Multi Lingual TERMinal
-    C_STR("\033[?62;c")                    // kitty
+    C_STR("\033[?62;c"),                   // kitty
+    C_STR("\033[?64;1;2;6;9;15;22c"),      // DEC VT420
+    C_STR("\033[?64;1;2;7;8;9;15;18c"),    // DEC VT510
+    C_STR("\033[?65;1;2;7;8;9;12;18c")     // DEC VT520
   };
 
   return DA[static_cast<std::size_t>(con)];
@@ -802,7 +817,10 @@ inline auto ConEmu::getDA1 (console con) -> const char*
     nullptr,                          // tmux
     nullptr,                          // kterm
     C_STR("\033[?63;1;2;3;4;7;29c"),  // mlterm - Multi Lingual TERMinal
-    nullptr                           // kitty
+    nullptr,                          // kitty
+    nullptr,                          // DEC VT420
+    nullptr,                          // DEC VT510
+    nullptr                           // DEC VT520
   };
 
   return DA1[static_cast<std::size_t>(con)];
@@ -835,7 +853,10 @@ inline auto ConEmu::getSEC_DA (console con) -> const char*
     C_STR("\033[>84;0;0c"),       // tmux
     C_STR("\033[?1;2c"),          // kterm
     C_STR("\033[>24;279;0c"),     // mlterm - Multi Lingual TERMinal
-    C_STR("\033[>1;4000;13c")     // kitty
+    C_STR("\033[>1;4000;13c"),    // kitty
+    C_STR("\033[>41;10;0c"),      // DEC VT420
+    C_STR("\033[>61;20;1c"),      // DEC VT510
+    C_STR("\033[>64;20;0c")       // DEC VT520
   };
 
   return SEC_DA[static_cast<std::size_t>(con)];
@@ -1017,7 +1038,10 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
              && con != console::tmux
              && con != console::kterm
              && con != console::mlterm
-             && con != console::kitty )
+             && con != console::kitty
+             && con != console::dec_vt420
+             && con != console::dec_vt510
+             && con != console::dec_vt520 )
         write (fd_master, "\033]lTITLE\033\\", 10);
 
       i += 5;
@@ -1046,7 +1070,10 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
         && con != console::sun_con
         && con != console::screen
         && con != console::tmux
-        && con != console::kterm )
+        && con != console::kterm
+        && con != console::dec_vt420
+        && con != console::dec_vt510
+        && con != console::dec_vt520 )
       {
         int n = buffer[i + 4] - '0';
         write (fd_master, "\033]4;", 4);
@@ -1083,7 +1110,10 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
         && con != console::sun_con
         && con != console::screen
         && con != console::tmux
-        && con != console::kterm )
+        && con != console::kterm
+        && con != console::dec_vt420
+        && con != console::dec_vt510
+        && con != console::dec_vt520 )
       {
         int n = (buffer[i + 4] - '0') * 10
               + (buffer[i + 5] - '0');
@@ -1123,7 +1153,10 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
         && con != console::sun_con
         && con != console::screen
         && con != console::tmux
-        && con != console::kterm )
+        && con != console::kterm
+        && con != console::dec_vt420
+        && con != console::dec_vt510
+        && con != console::dec_vt520 )
       {
         int n = (buffer[i + 4] - '0') * 100
               + (buffer[i + 5] - '0') * 10
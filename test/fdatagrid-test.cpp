@@ -0,0 +1,188 @@
+/***********************************************************************
+* fdatagrid-test.cpp - FDataGridTable unit tests                       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FDataGridTableTest
+//----------------------------------------------------------------------
+
+class FDataGridTableTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FDataGridTableTest() = default;
+
+  protected:
+    void classNameTest();
+    void sortTest();
+    void addRowTest();
+    void filterTest();
+
+  private:
+    using FStringVector = std::vector<finalcut::FString>;
+
+    static auto getColumn (const finalcut::FDataGridTable&) -> FStringVector;
+    static void fillTable (finalcut::FDataGridTable&, const FStringVector&);
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FDataGridTableTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (sortTest);
+    CPPUNIT_TEST (addRowTest);
+    CPPUNIT_TEST (filterTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+auto FDataGridTableTest::getColumn (const finalcut::FDataGridTable& table) -> FStringVector
+{
+  FStringVector column{};
+
+  for (std::size_t row{0}; row < table.getRowCount(); row++)
+    column.push_back(table.getData(row, 0));
+
+  return column;
+}
+
+//----------------------------------------------------------------------
+void FDataGridTableTest::fillTable ( finalcut::FDataGridTable& table
+                                   , const FStringVector& cells )
+{
+  table.addColumn ("Value");
+
+  for (const auto& cell : cells)
+    table.addRow ({cell});
+}
+
+//----------------------------------------------------------------------
+void FDataGridTableTest::classNameTest()
+{
+  const finalcut::FDataGridTable table{};
+  CPPUNIT_ASSERT ( table.getClassName() == "FDataGridTable" );
+  CPPUNIT_ASSERT ( table.getRowCount() == 0 );
+  CPPUNIT_ASSERT ( table.getColumnCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FDataGridTableTest::sortTest()
+{
+  // Numbers come first (by value), then texts (by character code).
+  // Hex numbers, "inf", "nan" and numbers with whitespace are texts.
+
+  finalcut::FDataGridTable table{};
+  fillTable ( table
+            , { "10", "2", "1a", "nan", "-3.5", "inf", "0x10"
+              , " 4", "", "abc", "1e2", "2.0", "+7", "1.", ".5" } );
+  CPPUNIT_ASSERT ( table.getRowCount() == 15 );
+  CPPUNIT_ASSERT ( table.getData(0, 0) == "10" );  // Unsorted
+
+  table.sort (0, finalcut::SortOrder::Ascending);
+  const FStringVector ascending
+  {
+    "-3.5", ".5", "1.", "2", "2.0", "+7", "10", "1e2"
+  , "", " 4", "0x10", "1a", "abc", "inf", "nan"
+  };
+  CPPUNIT_ASSERT ( getColumn(table) == ascending );
+
+  // Equal numbers keep their insertion order ("2" before "2.0")
+  table.sort (0, finalcut::SortOrder::Descending);
+  const FStringVector descending
+  {
+    "nan", "inf", "abc", "1a", "0x10", " 4", "", "1e2"
+  , "10", "+7", "2", "2.0", "1.", ".5", "-3.5"
+  };
+  CPPUNIT_ASSERT ( getColumn(table) == descending );
+
+  table.sort (0, finalcut::SortOrder::Unsorted);
+  CPPUNIT_ASSERT ( table.getData(0, 0) == "10" );
+  CPPUNIT_ASSERT ( table.getData(14, 0) == ".5" );
+
+  // A changed cell is sorted by its new value
+  table.sort (0, finalcut::SortOrder::Ascending);
+  table.setData (0, 0, "x");  // Replaces "-3.5"
+  table.sort (0, finalcut::SortOrder::Ascending);
+  CPPUNIT_ASSERT ( table.getData(0, 0) == ".5" );
+  CPPUNIT_ASSERT ( table.getData(14, 0) == "x" );
+}
+
+//----------------------------------------------------------------------
+void FDataGridTableTest::addRowTest()
+{
+  // New rows are inserted at their sorted position
+
+  finalcut::FDataGridTable table{};
+  fillTable (table, {"10", "b", "2", "1a"});
+  table.sort (0, finalcut::SortOrder::Ascending);
+  CPPUNIT_ASSERT ( getColumn(table) == FStringVector({"2", "10", "1a", "b"}) );
+
+  table.addRow ({"5"});
+  table.addRow ({"a"});
+  table.addRow ({"-1"});
+  table.addRow ({"100"});
+  table.addRow ({"c"});
+  const FStringVector expected
+  {
+    "-1", "2", "5", "10", "100", "1a", "a", "b", "c"
+  };
+  CPPUNIT_ASSERT ( getColumn(table) == expected );
+
+  table.clear();
+  CPPUNIT_ASSERT ( table.getRowCount() == 0 );
+  table.addRow ({"3"});
+  table.addRow ({"1"});
+  CPPUNIT_ASSERT ( getColumn(table) == FStringVector({"1", "3"}) );
+}
+
+//----------------------------------------------------------------------
+void FDataGridTableTest::filterTest()
+{
+  finalcut::FDataGridTable table{};
+  fillTable (table, {"Apple", "12", "pineapple", "3", "Banana"});
+  table.sort (0, finalcut::SortOrder::Ascending);
+  table.filter ("APPLE");
+  CPPUNIT_ASSERT ( getColumn(table) == FStringVector({"Apple", "pineapple"}) );
+  table.filter ("");
+  CPPUNIT_ASSERT ( getColumn(table)
+                   == FStringVector({"3", "12", "Apple", "Banana", "pineapple"}) );
+}
+
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FDataGridTableTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -3112,12 +3112,26 @@ void FKeyboardTest::utf8Test()
   std::cout << " - code: " << uInt32(key_pressed) << std::endl;
   CPPUNIT_ASSERT ( key_pressed == finalcut::FKey(0x0040) );
 
-  // Invalid UTF-8
+  // Invalid UTF-8 is not passed on as a key
   key_pressed = finalcut::FKey(0xffffffff);
+  number_of_keys = 0;
   input("\377");
   processInput();
-  static constexpr auto NOT_SET = static_cast<finalcut::FKey>(-2);
-  CPPUNIT_ASSERT ( key_pressed == NOT_SET );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey(0xffffffff) );
+  CPPUNIT_ASSERT ( number_of_keys == 0 );
+
+  // Overlong encoding of '/' followed by a valid character
+  input("\300\257a");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('a') );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+
+  // Surrogate code point (U+D800) followed by a valid character
+  number_of_keys = 0;
+  input("\355\240\200b");
+  processInput();
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey('b') );
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
 
   // Without UTF-8 support
   keyboard->disableUTF8();
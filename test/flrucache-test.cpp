@@ -0,0 +1,203 @@
+/***********************************************************************
+* flrucache-test.cpp - FLruCache unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FLruCacheTest
+//----------------------------------------------------------------------
+
+class FLruCacheTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FLruCacheTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void insertTest();
+    void discardTest();
+    void capacityTest();
+    void eraseTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FLruCacheTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (insertTest);
+    CPPUNIT_TEST (discardTest);
+    CPPUNIT_TEST (capacityTest);
+    CPPUNIT_TEST (eraseTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FLruCacheTest::classNameTest()
+{
+  const finalcut::FLruCache<int, int> cache{};
+  const finalcut::FString& classname = cache.getClassName();
+  CPPUNIT_ASSERT ( classname == "FLruCache" );
+}
+
+//----------------------------------------------------------------------
+void FLruCacheTest::noArgumentTest()
+{
+  finalcut::FLruCache<int, std::string> cache{};
+  CPPUNIT_ASSERT ( cache.getCapacity() == 256 );
+  CPPUNIT_ASSERT ( cache.getSize() == 0 );
+  CPPUNIT_ASSERT ( cache.isEmpty() );
+  CPPUNIT_ASSERT ( ! cache.contains(1) );
+  CPPUNIT_ASSERT ( cache.find(1) == nullptr );
+
+  // The capacity is at least one entry
+  const finalcut::FLruCache<int, int> zero_cache{0};
+  CPPUNIT_ASSERT ( zero_cache.getCapacity() == 1 );
+}
+
+//----------------------------------------------------------------------
+void FLruCacheTest::insertTest()
+{
+  finalcut::FLruCache<int, std::string> cache{4};
+  auto& value = cache.insert(1, "one");
+  CPPUNIT_ASSERT ( value == "one" );
+  cache.insert(2, "two");
+  CPPUNIT_ASSERT ( cache.getSize() == 2 );
+  CPPUNIT_ASSERT ( ! cache.isEmpty() );
+  CPPUNIT_ASSERT ( cache.contains(1) );
+  CPPUNIT_ASSERT ( cache.contains(2) );
+  CPPUNIT_ASSERT ( ! cache.contains(3) );
+  CPPUNIT_ASSERT ( cache.find(2) != nullptr );
+  CPPUNIT_ASSERT ( *cache.find(2) == "two" );
+
+  // Replace a value
+  cache.insert(1, "eins");
+  CPPUNIT_ASSERT ( cache.getSize() == 2 );
+  CPPUNIT_ASSERT ( *cache.find(1) == "eins" );
+
+  // Modify a value
+  *cache.find(2) = "zwei";
+  CPPUNIT_ASSERT ( *cache.find(2) == "zwei" );
+
+  cache.clear();
+  CPPUNIT_ASSERT ( cache.isEmpty() );
+  CPPUNIT_ASSERT ( cache.find(1) == nullptr );
+}
+
+//----------------------------------------------------------------------
+void FLruCacheTest::discardTest()
+{
+  finalcut::FLruCache<int, int> cache{3};
+  cache.insert(1, 10);
+  cache.insert(2, 20);
+  cache.insert(3, 30);
+  CPPUNIT_ASSERT ( cache.getSize() == 3 );
+
+  // The least recently used entry is discarded
+  cache.insert(4, 40);
+  CPPUNIT_ASSERT ( cache.getSize() == 3 );
+  CPPUNIT_ASSERT ( ! cache.contains(1) );
+  CPPUNIT_ASSERT ( cache.contains(2) );
+
+  // find() marks an entry as recently used
+  CPPUNIT_ASSERT ( *cache.find(2) == 20 );
+  cache.insert(5, 50);
+  CPPUNIT_ASSERT ( cache.contains(2) );
+  CPPUNIT_ASSERT ( ! cache.contains(3) );
+  CPPUNIT_ASSERT ( cache.contains(4) );
+  CPPUNIT_ASSERT ( cache.contains(5) );
+
+  // Replacing a value also marks the entry as recently used
+  cache.insert(4, 41);
+  cache.insert(6, 60);
+  CPPUNIT_ASSERT ( ! cache.contains(2) );
+  CPPUNIT_ASSERT ( *cache.find(4) == 41 );
+  CPPUNIT_ASSERT ( cache.contains(5) );
+  CPPUNIT_ASSERT ( cache.contains(6) );
+}
+
+//----------------------------------------------------------------------
+void FLruCacheTest::capacityTest()
+{
+  finalcut::FLruCache<int, int> cache{8};
+
+  for (int i{0}; i < 100; i++)
+    cache.insert(i, i * i);
+
+  CPPUNIT_ASSERT ( cache.getSize() == 8 );
+
+  for (int i{92}; i < 100; i++)
+    CPPUNIT_ASSERT ( *cache.find(i) == i * i );
+
+  // Reducing the capacity keeps the most recently used entries
+  cache.find(95);
+  cache.setCapacity(2);
+  CPPUNIT_ASSERT ( cache.getCapacity() == 2 );
+  CPPUNIT_ASSERT ( cache.getSize() == 2 );
+  CPPUNIT_ASSERT ( cache.contains(95) );
+  CPPUNIT_ASSERT ( cache.contains(99) );
+
+  cache.setCapacity(0);
+  CPPUNIT_ASSERT ( cache.getCapacity() == 1 );
+  CPPUNIT_ASSERT ( cache.getSize() == 1 );
+  CPPUNIT_ASSERT ( cache.contains(95) );
+}
+
+//----------------------------------------------------------------------
+void FLruCacheTest::eraseTest()
+{
+  finalcut::FLruCache<std::string, int> cache{3};
+  cache.insert("a", 1);
+  cache.insert("b", 2);
+  cache.insert("c", 3);
+  cache.erase("b");
+  cache.erase("x");  // Unknown keys are ignored
+  CPPUNIT_ASSERT ( cache.getSize() == 2 );
+  CPPUNIT_ASSERT ( ! cache.contains("b") );
+
+  // The free entry is used without discarding another one
+  cache.insert("d", 4);
+  CPPUNIT_ASSERT ( cache.getSize() == 3 );
+  CPPUNIT_ASSERT ( cache.contains("a") );
+  CPPUNIT_ASSERT ( cache.contains("c") );
+  CPPUNIT_ASSERT ( cache.contains("d") );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FLruCacheTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,165 @@
+/***********************************************************************
+* fmappedtextfile-test.cpp - FMappedTextFile unit tests                *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FMappedTextFileTest
+//----------------------------------------------------------------------
+
+class FMappedTextFileTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FMappedTextFileTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void readTest();
+    void truncateTest();
+
+  private:
+    // Methods
+    static auto createFile (const std::string&) -> std::string;
+    static void waitForIndex (const finalcut::FMappedTextFile&);
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FMappedTextFileTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (readTest);
+    CPPUNIT_TEST (truncateTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+auto FMappedTextFileTest::createFile (const std::string& text) -> std::string
+{
+  char filename[] = "/tmp/fmappedtextfile-test.XXXXXX";
+  const int fd = ::mkstemp(filename);
+  CPPUNIT_ASSERT ( fd >= 0 );
+  CPPUNIT_ASSERT ( ::write(fd, text.data(), text.length())
+                   == ssize_t(text.length()) );
+  ::close(fd);
+  return filename;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::waitForIndex (const finalcut::FMappedTextFile& file)
+{
+  while ( file.isLoading() )
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::classNameTest()
+{
+  const finalcut::FMappedTextFile file{};
+  const finalcut::FString& classname = file.getClassName();
+  CPPUNIT_ASSERT ( classname == "FMappedTextFile" );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::noArgumentTest()
+{
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+  CPPUNIT_ASSERT ( ! file.isLoading() );
+  CPPUNIT_ASSERT ( file.getFileName().isEmpty() );
+  CPPUNIT_ASSERT ( file.getFileSize() == 0 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+  CPPUNIT_ASSERT ( file.getColumns() == 0 );
+  CPPUNIT_ASSERT ( file.getProgress() == 100 );
+  CPPUNIT_ASSERT ( file.getLine(0).isEmpty() );
+  CPPUNIT_ASSERT ( ! file.open("") );
+  CPPUNIT_ASSERT ( ! file.open("/tmp") );  // Not a regular file
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::readTest()
+{
+  const auto filename = createFile("first\r\nsecond line\n\xc3\xa4\xc3\xb6\xc3\xbc");
+  finalcut::FMappedTextFile file{filename};
+  waitForIndex(file);
+  CPPUNIT_ASSERT ( file.isOpen() );
+  CPPUNIT_ASSERT ( file.getFileName() == filename );
+  CPPUNIT_ASSERT ( file.getProgress() == 100 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 3 );
+  CPPUNIT_ASSERT ( file.getColumns() == 11 );
+  CPPUNIT_ASSERT ( file.getLine(0) == L"first" );
+  CPPUNIT_ASSERT ( file.getLine(1) == L"second line" );
+  CPPUNIT_ASSERT ( file.getLine(2) == L"äöü" );
+  CPPUNIT_ASSERT ( file.getLine(3).isEmpty() );
+
+  file.close();
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+  ::unlink(filename.c_str());
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::truncateTest()
+{
+  // The last line is on the second page of the mapping
+  const auto page_size = std::size_t(::sysconf(_SC_PAGESIZE));
+  const std::string text = "line 1\n" + std::string(page_size, 'x') + "\nline 3\n";
+  const auto filename = createFile(text);
+  finalcut::FMappedTextFile file{filename};
+  waitForIndex(file);
+  CPPUNIT_ASSERT ( file.getLineCount() == 3 );
+  CPPUNIT_ASSERT ( file.getLine(1).getLength() == page_size );
+  CPPUNIT_ASSERT ( file.getLine(2) == L"line 3" );
+
+  // Truncate the file within line 2. Reading the second page
+  // of the mapping would raise SIGBUS now.
+  CPPUNIT_ASSERT ( ::truncate(filename.c_str(), 9) == 0 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 3 );
+  CPPUNIT_ASSERT ( file.getLine(0) == L"line 1" );
+  CPPUNIT_ASSERT ( file.getLine(1) == L"xx" );
+  CPPUNIT_ASSERT ( file.getLine(2).isEmpty() );
+  ::unlink(filename.c_str());
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FMappedTextFileTest);
+
+// The general unit test main part
+#include <main-test.inc>
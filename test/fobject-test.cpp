@@ -153,10 +153,12 @@ class FObjectTest : public CPPUNIT_NS::TestFixture
     void noArgumentTest();
     void childObjectTest();
     void widgetObjectTest();
+    void instanceOfTest();
     void removeParentTest();
     void setParentTest();
     void addTest();
     void delTest();
+    void delChildrenTest();
     void elementAccessTest();
     void iteratorTest();
     void userEventTest();
@@ -170,10 +172,12 @@ class FObjectTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (noArgumentTest);
     CPPUNIT_TEST (childObjectTest);
     CPPUNIT_TEST (widgetObjectTest);
+    CPPUNIT_TEST (instanceOfTest);
     CPPUNIT_TEST (removeParentTest);
     CPPUNIT_TEST (setParentTest);
     CPPUNIT_TEST (addTest);
     CPPUNIT_TEST (delTest);
+    CPPUNIT_TEST (delChildrenTest);
     CPPUNIT_TEST (elementAccessTest);
     CPPUNIT_TEST (iteratorTest);
     CPPUNIT_TEST (userEventTest);
@@ -292,6 +296,24 @@ void FObjectTest::widgetObjectTest()
   CPPUNIT_ASSERT ( ! o.isWidget() );
 }
 
+//----------------------------------------------------------------------
+void FObjectTest::instanceOfTest()
+{
+  finalcut::FObject o;
+  test::FObject_timer t;
+  const finalcut::FObject* obj = &t;
+  CPPUNIT_ASSERT ( o.isInstanceOf<finalcut::FObject>() );
+  CPPUNIT_ASSERT ( ! o.isInstanceOf<test::FObject_timer>() );
+  CPPUNIT_ASSERT ( ! o.isInstanceOf<test::FObject_userEvent>() );
+  CPPUNIT_ASSERT ( obj->isInstanceOf<finalcut::FObject>() );
+  CPPUNIT_ASSERT ( obj->isInstanceOf<test::FObject_timer>() );
+  CPPUNIT_ASSERT ( ! obj->isInstanceOf<test::FObject_userEvent>() );
+
+  // Class name comparison
+  CPPUNIT_ASSERT ( o.isInstanceOf("FObject") );
+  CPPUNIT_ASSERT ( ! o.isInstanceOf("FObject_timer") );
+}
+
 //----------------------------------------------------------------------
 void FObjectTest::removeParentTest()
 {
@@ -449,6 +471,54 @@ void FObjectTest::delTest()
   delete obj;
 }
 
+//----------------------------------------------------------------------
+void FObjectTest::delChildrenTest()
+{
+  // obj -> child1
+  //     -> child2
+  //     -> child3
+  //     -> child4
+
+  auto obj =  new finalcut::FObject();
+  auto child1 = new finalcut::FObject(obj);
+  auto child2 = new finalcut::FObject(obj);
+  auto child3 = new finalcut::FObject(obj);
+  auto child4 = new finalcut::FObject(obj);
+  auto other = new finalcut::FObject();
+  auto grandchild = new finalcut::FObject(child4);
+  CPPUNIT_ASSERT ( obj->numOfChildren() == 4 );
+
+  // Only direct children are removed
+  obj->delChildren ({child1, child3, other, grandchild, nullptr});
+  CPPUNIT_ASSERT ( obj->numOfChildren() == 2 );
+  CPPUNIT_ASSERT ( obj->front() == child2 );
+  CPPUNIT_ASSERT ( obj->back() == child4 );
+  CPPUNIT_ASSERT ( ! child1->hasParent() );
+  CPPUNIT_ASSERT ( child1->getParent() == nullptr );
+  CPPUNIT_ASSERT ( ! child3->hasParent() );
+  CPPUNIT_ASSERT ( child2->getParent() == obj );
+  CPPUNIT_ASSERT ( child4->getParent() == obj );
+  CPPUNIT_ASSERT ( grandchild->getParent() == child4 );
+  CPPUNIT_ASSERT ( ! other->hasParent() );
+
+  obj->delChildren ({});
+  CPPUNIT_ASSERT ( obj->numOfChildren() == 2 );
+
+  // Deleting a child with children
+  delete child4;
+  CPPUNIT_ASSERT ( obj->numOfChildren() == 1 );
+  CPPUNIT_ASSERT ( obj->front() == child2 );
+
+  // A removed object is not deleted with its former parent
+  delete obj;
+  CPPUNIT_ASSERT ( ! child1->hasParent() );
+  CPPUNIT_ASSERT ( ! child3->hasParent() );
+
+  delete child1;
+  delete child3;
+  delete other;
+}
+
 //----------------------------------------------------------------------
 void FObjectTest::elementAccessTest()
 {
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2021-2022 Markus Gans                                      *
+* Copyright 2021-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -62,6 +62,7 @@ class FTermFunctionsTest : public CPPUNIT_NS::TestFixture
     void utf8Test();
     void FullWidthHalfWidthTest();
     void combiningCharacterTest();
+    void charWidthTableTest();
     void readCursorPosTest();
 
   private:
@@ -80,6 +81,7 @@ class FTermFunctionsTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (utf8Test);
     CPPUNIT_TEST (FullWidthHalfWidthTest);
     CPPUNIT_TEST (combiningCharacterTest);
+    CPPUNIT_TEST (charWidthTableTest);
     CPPUNIT_TEST (readCursorPosTest);
 
     // End of test suite definition
@@ -692,10 +694,19 @@ void FTermFunctionsTest::utf8Test()
                    == std::string({char(0xf3), char(0xb0), char(0x80), char(0x80),}) );
 
   // Last valid 4 byte character
-  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0x1fffff))
-                   == std::string({char(0xf7), char(0xbf), char(0xbf), char(0xbf),}) );
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0x10ffff))
+                   == std::string({char(0xf4), char(0x8f), char(0xbf), char(0xbf),}) );
 
   // Invalid characters are mapped to the replacement character (U+FFFD)
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0x110000))
+                   == std::string({char(0xef), char(0xbf), char(0xbd)}) );
+
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0x1fffff))
+                   == std::string({char(0xef), char(0xbf), char(0xbd)}) );
+
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0xd800))  // Surrogate
+                   == std::string({char(0xef), char(0xbf), char(0xbd)}) );
+
   CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0x200000))
                    == std::string({char(0xef), char(0xbf), char(0xbd)}) );
 
@@ -3046,6 +3057,89 @@ void FTermFunctionsTest::combiningCharacterTest()
   CPPUNIT_ASSERT ( finalcut::searchRightCharBegin(combining, 30) == NOT_FOUND );
 }
 
+//----------------------------------------------------------------------
+void FTermFunctionsTest::charWidthTableTest()
+{
+  using finalcut::FCharWidth;
+  using finalcut::GraphemeBreak;
+
+  // Column width from the Unicode table
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\0') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\t') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'A') == 1 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U000000ad') == 1 );  // Soft hyphen
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U00000300') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U00000600') == 1 );  // Prepended format character
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U00001160') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U0000200b') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U00002500') == 1 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U00004e00') == 2 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U0000ff21') == 2 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U0001f600') == 2 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U0002a6d6') == 2 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U000e0101') == 0 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(L'\U0010fffd') == 1 );
+  CPPUNIT_ASSERT ( FCharWidth::getWidth(wchar_t(0x110000)) == 0 );
+
+  // East Asian ambiguous width
+  CPPUNIT_ASSERT ( ! FCharWidth::isAmbiguousWidth(L'A') );
+  CPPUNIT_ASSERT ( FCharWidth::isAmbiguousWidth(L'\U000000b1') );  // ±
+  CPPUNIT_ASSERT ( FCharWidth::isAmbiguousWidth(L'\U00002500') );  // ─
+  CPPUNIT_ASSERT ( ! FCharWidth::isAmbiguousWidth(L'\U00000300') );  // Zero width
+  CPPUNIT_ASSERT ( ! FCharWidth::isAmbiguousWidth(L'\U00004e00') );
+
+  // Grapheme cluster break property
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'a') == GraphemeBreak::Other );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\r') == GraphemeBreak::CR );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\n') == GraphemeBreak::LF );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\x01') == GraphemeBreak::Control );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0000200b') == GraphemeBreak::Control );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U00000301') == GraphemeBreak::Extend );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0000200d') == GraphemeBreak::ZWJ );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0001f1e9') == GraphemeBreak::RegionalIndicator );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U00000600') == GraphemeBreak::Prepend );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U00000903') == GraphemeBreak::SpacingMark );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U00001100') == GraphemeBreak::L );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U00001161') == GraphemeBreak::V );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U000011a8') == GraphemeBreak::T );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0000ac00') == GraphemeBreak::LV );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0000ac01') == GraphemeBreak::LVT );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U0001f600') == GraphemeBreak::ExtendedPictographic );
+  CPPUNIT_ASSERT ( FCharWidth::getGraphemeBreak(L'\U000000a9') == GraphemeBreak::ExtendedPictographic );
+
+  // The column width does not depend on the locale
+  auto& fterm_data = finalcut::FTermData::getInstance();
+  const auto encoding = fterm_data.getTerminalEncoding();
+  const auto* locale = std::setlocale (LC_CTYPE, nullptr);
+  const std::string saved_locale{locale ? locale : "C"};
+  std::setlocale (LC_CTYPE, "C");
+  fterm_data.setTermEncoding (finalcut::Encoding::UTF8);
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L'\U00004f60') == 2 );  // 你
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L'\U00000300') == 0 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"\U00004f60\U0000597d abc") == 8 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"o\U0000031b\U00000323=\U00001ee3") == 3 );
+
+  // Terminal with wide ambiguous characters
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L'\U000000b1') == 1 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"\U00002500\U00002500") == 2 );
+  fterm_data.supportWideAmbiguousCharacter();
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L'\U000000b1') == 2 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"\U00002500\U00002500") == 4 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(L'\U00000300') == 0 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(wchar_t(finalcut::UniChar::NF_check_mark)) == 1 );
+  fterm_data.supportWideAmbiguousCharacter (false);
+
+  // Control characters are not combined with the previous character
+  const std::wstring control = L"a\x01\U00000300";
+  CPPUNIT_ASSERT ( finalcut::getCharLength(control, 0) == 1 );
+  CPPUNIT_ASSERT ( finalcut::getCharLength(control, 1) == -1 );
+  CPPUNIT_ASSERT ( finalcut::searchRightCharBegin(control, 0) == 1 );
+  CPPUNIT_ASSERT ( finalcut::searchLeftCharBegin(control, 2) == 1 );
+
+  fterm_data.setTermEncoding (encoding);
+  std::setlocale (LC_CTYPE, saved_locale.c_str());
+}
+
 //----------------------------------------------------------------------
 void FTermFunctionsTest::readCursorPosTest()
 {
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2018-2021 Markus Gans                                      *
+* Copyright 2018-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -108,6 +108,7 @@ void FTermDataTest::defaultDataTest()
 
   CPPUNIT_ASSERT ( data.hasShadowCharacter() == true );
   CPPUNIT_ASSERT ( data.hasHalfBlockCharacter() == true );
+  CPPUNIT_ASSERT ( data.hasWideAmbiguousCharacter() == false );
   CPPUNIT_ASSERT ( data.hasCursorOptimisation() == true );
   CPPUNIT_ASSERT ( data.isCursorHidden() == false );
   CPPUNIT_ASSERT ( data.hasAlternateScreen() == true );
@@ -218,6 +219,12 @@ void FTermDataTest::dataTest()
   data.supportHalfBlockCharacter (false);
   CPPUNIT_ASSERT ( data.hasHalfBlockCharacter() == false );
 
+  CPPUNIT_ASSERT ( data.hasWideAmbiguousCharacter() == false );
+  data.supportWideAmbiguousCharacter();
+  CPPUNIT_ASSERT ( data.hasWideAmbiguousCharacter() == true );
+  data.supportWideAmbiguousCharacter (false);
+  CPPUNIT_ASSERT ( data.hasWideAmbiguousCharacter() == false );
+
   CPPUNIT_ASSERT ( data.hasCursorOptimisation() == true );
   data.supportCursorOptimisation (false);
   CPPUNIT_ASSERT ( data.hasCursorOptimisation() == false );
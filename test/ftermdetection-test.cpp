@@ -70,6 +70,7 @@ class FTermDetectionTest : public CPPUNIT_NS::TestFixture
     void ktermTest();
     void mltermTest();
     void kittyTest();
+    void decTerminalTest();
     void ttytypeTest();
 
   private:
@@ -101,6 +102,7 @@ class FTermDetectionTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (ktermTest);
     CPPUNIT_TEST (mltermTest);
     CPPUNIT_TEST (kittyTest);
+    CPPUNIT_TEST (decTerminalTest);
     CPPUNIT_TEST (ttytypeTest);
 
     // End of test suite definition
@@ -259,6 +261,7 @@ void FTermDetectionTest::xtermTest()
     CPPUNIT_ASSERT ( debug_data.getTermType_SecDA() == "xterm-256color" );
     CPPUNIT_ASSERT ( detect.getAnswerbackString() == "" );
     CPPUNIT_ASSERT ( detect.getSecDAString() == "\033[>19;312;0c" );
+    CPPUNIT_ASSERT ( ! detect.hasRectangleOperationSupport() );
 
     printConEmuDebug();
     closeConEmuStdStreams();
@@ -1993,6 +1996,89 @@ void FTermDetectionTest::kittyTest()
   }
 }
 
+//----------------------------------------------------------------------
+void FTermDetectionTest::decTerminalTest()
+{
+  // DEC VT420, VT510 and VT520 support rectangular area operations
+
+  struct DecTerminal
+  {
+    ConEmu::console con;
+    const char* termtype;
+    const char* sec_da;
+  };
+
+  const std::vector<DecTerminal> dec_terminals
+  {
+    { ConEmu::console::dec_vt420, "vt420", "\033[>41;10;0c" },
+    { ConEmu::console::dec_vt510, "vt510", "\033[>61;20;1c" },
+    { ConEmu::console::dec_vt520, "vt520", "\033[>64;20;0c" }
+  };
+
+  for (const auto& dec_terminal : dec_terminals)
+  {
+    auto& data = finalcut::FTermData::getInstance();
+    finalcut::FTermDetection detect;
+    data.setTermType(dec_terminal.termtype);
+    detect.setTerminalDetection(true);
+
+    pid_t pid = forkConEmu();
+
+    if ( isConEmuChildProcess(pid) )
+    {
+      // (gdb) set follow-fork-mode child
+      setenv ("TERM", dec_terminal.termtype, 1);
+      unsetenv ("TERMCAP");
+      unsetenv ("COLORTERM");
+      unsetenv ("COLORFGBG");
+      unsetenv ("VTE_VERSION");
+      unsetenv ("XTERM_VERSION");
+      unsetenv ("ROXTERM_ID");
+      unsetenv ("KONSOLE_DBUS_SESSION");
+      unsetenv ("KONSOLE_DCOP");
+      unsetenv ("TMUX");
+      unsetenv ("KITTY_WINDOW_ID");
+
+      // Forget the terminal types of the previous tests
+      data.unsetTermType(finalcut::FTermType::linux_con);
+      data.unsetTermType(finalcut::FTermType::cygwin);
+      data.unsetTermType(finalcut::FTermType::screen);
+      data.unsetTermType(finalcut::FTermType::tmux);
+      data.unsetTermType(finalcut::FTermType::kitty);
+      detect.detect();
+
+      CPPUNIT_ASSERT ( ! detect.canDisplay256Colors() );
+      CPPUNIT_ASSERT ( detect.hasTerminalDetection() );
+      CPPUNIT_ASSERT ( ! detect.hasSetCursorStyleSupport() );
+      CPPUNIT_ASSERT ( detect.hasRectangleOperationSupport() );
+      CPPUNIT_ASSERT ( detect.getTermType() == dec_terminal.termtype );
+      CPPUNIT_ASSERT ( detect.getSecDAString() == dec_terminal.sec_da );
+
+      // A new detection resets the rectangle operation support
+      detect.setTerminalDetection(false);
+      detect.detect();
+      CPPUNIT_ASSERT ( ! detect.hasRectangleOperationSupport() );
+
+      printConEmuDebug();
+      closeConEmuStdStreams();
+      unsetenv ("TERM");
+      exit(EXIT_SUCCESS);
+    }
+    else  // Parent
+    {
+      // Start the terminal emulation
+      startConEmuTerminal (dec_terminal.con);
+      int wstatus;
+
+      if ( waitpid(pid, &wstatus, WUNTRACED) != pid )
+        std::cerr << "waitpid error" << std::endl;
+
+      if ( WIFEXITED(wstatus) )
+        CPPUNIT_ASSERT ( WEXITSTATUS(wstatus) == 0 );
+    }
+  }
+}
+
 //----------------------------------------------------------------------
 void FTermDetectionTest::ttytypeTest()
 {
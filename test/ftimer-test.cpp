@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2022 Markus Gans                                           *
+* Copyright 2022-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -22,6 +22,7 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -76,6 +77,35 @@ class FTimer_protected : public finalcut::FObjectTimer
 
 //----------------------------------------------------------------------
 
+class FTimer_changing : public FTimer_protected
+{
+  public:
+    // Constructor
+    FTimer_changing() = default;
+
+    void performTimerAction (finalcut::FObject*, finalcut::FEvent* ev) override
+    {
+      // Changes the timer list inside the timer event
+
+      const auto id = static_cast<finalcut::FTimerEvent*>(ev)->getTimerId();
+      count++;
+
+      if ( count == 1 )
+      {
+        for (auto n{0}; n < 100; n++)  // Reallocates the timer list
+          added.push_back(addTimer(1000 + n));
+      }
+
+      delTimer (id);
+    }
+
+    // Data members
+    uInt count{0};
+    std::vector<int> added{};
+};
+
+//----------------------------------------------------------------------
+
 class FObject_timer : public finalcut::FObject
 {
   public:
@@ -304,6 +334,24 @@ void FTimerTest::performTimerActionTest()
     finalcut::FApplication::sendEvent (&t2, &timer_ev);
 
   CPPUNIT_ASSERT ( t2.getValue() == 10 );
+
+  // Adding and deleting timers inside a timer event
+  test::FTimer_changing t3;
+  t3.delAllTimers();
+  t3.addTimer(0);
+  t3.addTimer(0);
+  t3.addTimer(0);
+  CPPUNIT_ASSERT ( t3.getTimerList()->size() == 3 );
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  while ( t3.count < 3 )
+    t3.processEvent();
+
+  CPPUNIT_ASSERT ( t3.count == 3 );
+  CPPUNIT_ASSERT ( t3.added.size() == 100 );
+  CPPUNIT_ASSERT ( t3.getTimerList()->size() == 100 );
+  t3.delOwnTimers();
+  CPPUNIT_ASSERT ( t3.getTimerList()->empty() );
 }
 
 // Put the test suite in the registry
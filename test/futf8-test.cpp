@@ -0,0 +1,267 @@
+/***********************************************************************
+* futf8-test.cpp - UTF-8 transcoding unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <array>
+#include <clocale>
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FUTF8Test
+//----------------------------------------------------------------------
+
+class FUTF8Test : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FUTF8Test() = default;
+
+  protected:
+    void emptyTest();
+    void decodeTest();
+    void encodeTest();
+    void roundTripTest();
+    void illFormedTest();
+    void decodeCharTest();
+    void encodeCharTest();
+    void localeTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FUTF8Test);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (emptyTest);
+    CPPUNIT_TEST (decodeTest);
+    CPPUNIT_TEST (encodeTest);
+    CPPUNIT_TEST (roundTripTest);
+    CPPUNIT_TEST (illFormedTest);
+    CPPUNIT_TEST (decodeCharTest);
+    CPPUNIT_TEST (encodeCharTest);
+    CPPUNIT_TEST (localeTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FUTF8Test::emptyTest()
+{
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8(std::string{}).empty() );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8(nullptr, 0).empty() );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(std::wstring{}).empty() );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(nullptr, 0).empty() );
+
+  uInt32 code{0x41};
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char(nullptr, 0, code) == 0 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("A", 0, code) == 0 );
+  CPPUNIT_ASSERT ( code == 0x41 );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::decodeTest()
+{
+  // ASCII (shorter and longer than the 8 byte fast path)
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("abc") == L"abc" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("The quick brown fox")
+                   == L"The quick brown fox" );
+
+  // 2, 3 and 4 byte sequences
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\303\274") == L"\U000000fc" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\342\202\254") == L"\U000020ac" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\360\220\200\200") == L"\U00010000" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\364\217\277\277") == L"\U0010ffff" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\357\277\275") == L"\U0000fffd" );
+
+  // Mixed text with a non-ASCII character inside an 8 byte block
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("Gr\303\266\303\237e: 21,5 \302\260C")
+                   == L"Gr\U000000f6\U000000dfe: 21,5 \U000000b0C" );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\346\274\242\345\255\227") == L"\U00006f22\U00005b57" );
+
+  // Embedded null characters are part of the string
+  const std::string with_null{"a\0b", 3};
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8(with_null) == std::wstring(L"a\0b", 3) );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::encodeTest()
+{
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"abc") == "abc" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"The quick brown fox")
+                   == "The quick brown fox" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"\U000000fc") == "\303\274" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"\U000020ac") == "\342\202\254" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"\U00010000") == "\360\220\200\200" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(L"Gr\U000000f6\U000000dfe: 21,5 \U000000b0C")
+                   == "Gr\303\266\303\237e: 21,5 \302\260C" );
+
+  // Multi-byte characters only: the output grows several times
+  std::wstring cjk(1000, L'\U00006f22');
+  const auto utf8 = finalcut::encodeUTF8(cjk);
+  CPPUNIT_ASSERT ( utf8.length() == 3000 );
+  CPPUNIT_ASSERT ( utf8.substr(2997) == "\346\274\242" );
+
+  // Embedded null characters are part of the string
+  const std::wstring with_null{L"a\0b", 3};
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(with_null) == std::string("a\0b", 3) );
+
+  // Code points that are no Unicode scalar values
+  std::wstring invalid{};
+  invalid.push_back(wchar_t(0xd800));
+  invalid.push_back(L'x');
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(invalid) == "\357\277\275x" );
+
+  invalid.clear();
+  invalid.push_back(wchar_t(0x110000));
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8(invalid) == "\357\277\275" );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::roundTripTest()
+{
+  // All Unicode scalar values
+  std::wstring all_chars{};
+
+  for (uInt32 code{1}; code <= 0x10ffff; code++)
+  {
+    if ( code >= 0xd800 && code <= 0xdfff )
+      continue;
+
+    if ( sizeof(wchar_t) == 2 && code > 0xffff )
+      break;
+
+    all_chars.push_back(wchar_t(code));
+  }
+
+  const auto utf8 = finalcut::encodeUTF8(all_chars);
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8(utf8) == all_chars );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::illFormedTest()
+{
+  // Each maximal subpart of an ill-formed sequence
+  // is replaced by one U+FFFD
+
+  const std::wstring fffd{L"\U0000fffd"};
+
+  // Overlong forms
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\300\200") == fffd + fffd );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\340\200\200") == fffd + fffd + fffd );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\360\200\200\200")
+                   == fffd + fffd + fffd + fffd );
+
+  // Surrogate and value above U+10FFFF
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\355\240\200") == fffd + fffd + fffd );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\364\220\200\200")
+                   == fffd + fffd + fffd + fffd );
+
+  // Invalid bytes and lone continuation bytes
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\377a\200") == fffd + L"a" + fffd );
+
+  // Truncated sequences
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\342\202") == fffd );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("\360\220\200a") == fffd + L"a" );
+
+  // Example from the Unicode standard (U+FFFD substitution of maximal subparts)
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8("a\361\200\200\341\200\302b\200c\200\277d")
+                   == L"a" + fffd + fffd + fffd + L"b" + fffd + L"c"
+                      + fffd + fffd + L"d" );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::decodeCharTest()
+{
+  uInt32 code{};
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("@", 1, code) == 1 );
+  CPPUNIT_ASSERT ( code == 0x40 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\303\274x", 3, code) == 2 );
+  CPPUNIT_ASSERT ( code == 0xfc );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\342\202\254", 3, code) == 3 );
+  CPPUNIT_ASSERT ( code == 0x20ac );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\360\220\200\200", 4, code) == 4 );
+  CPPUNIT_ASSERT ( code == 0x10000 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\357\277\275", 3, code) == 3 );
+  CPPUNIT_ASSERT ( code == 0xfffd );
+
+  // Ill-formed or incomplete sequences do not change the code
+  code = 0x40;
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\377", 1, code) == 0 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\200", 1, code) == 0 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\301\201", 2, code) == 0 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\355\240\200", 3, code) == 0 );
+  CPPUNIT_ASSERT ( finalcut::decodeUTF8Char("\342\202\254", 2, code) == 0 );
+  CPPUNIT_ASSERT ( code == 0x40 );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::encodeCharTest()
+{
+  std::array<char, finalcut::UTF8_MAX_LENGTH> buf{};
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0x40, buf.data()) == 1 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 1) == "@" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0x7ff, buf.data()) == 2 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 2) == "\337\277" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0x20ac, buf.data()) == 3 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 3) == "\342\202\254" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0x10ffff, buf.data()) == 4 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 4) == "\364\217\277\277" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0xdfff, buf.data()) == 3 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 3) == "\357\277\275" );
+  CPPUNIT_ASSERT ( finalcut::encodeUTF8Char(0x110000, buf.data()) == 3 );
+  CPPUNIT_ASSERT ( std::string(buf.data(), 3) == "\357\277\275" );
+
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(L'\U000020ac') == "\342\202\254" );
+  CPPUNIT_ASSERT ( finalcut::unicode_to_utf8(wchar_t(0xd800)) == "\357\277\275" );
+}
+
+//----------------------------------------------------------------------
+void FUTF8Test::localeTest()
+{
+  // The FString conversion does not depend on the process locale
+
+  const auto* old_locale = std::setlocale(LC_CTYPE, nullptr);
+  const std::string saved_locale = old_locale ? old_locale : "C";
+  std::setlocale (LC_CTYPE, "C");
+
+  const finalcut::FString str{"Gr\303\266\303\237e"};
+  CPPUNIT_ASSERT ( str.getLength() == 5 );
+  CPPUNIT_ASSERT ( str == L"Gr\U000000f6\U000000dfe" );
+  CPPUNIT_ASSERT ( std::string(str.c_str()) == "Gr\303\266\303\237e" );
+  CPPUNIT_ASSERT ( str.toString() == "Gr\303\266\303\237e" );
+
+  std::setlocale (LC_CTYPE, saved_locale.c_str());
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FUTF8Test);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2021-2024 Markus Gans                                      *
+* Copyright 2021-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -21,6 +21,7 @@
 ***********************************************************************/
 
 #include <queue>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -53,6 +54,23 @@ void setBellState (bool state = true)
   getBellState() = state;
 }
 
+//----------------------------------------------------------------------
+struct RectangleOperations
+{
+  int copy_count{0};
+  int fill_count{0};
+  finalcut::FRect copy_source{};
+  finalcut::FPoint copy_target{};
+  std::vector<finalcut::FRect> fill_areas{};
+};
+
+//----------------------------------------------------------------------
+auto getRectangleOperations() -> RectangleOperations&
+{
+  static RectangleOperations rect_ops{};
+  return rect_ops;
+}
+
 
 //----------------------------------------------------------------------
 // class FTermOutputTest
@@ -87,6 +105,7 @@ class FTermOutputTest : public finalcut::FOutput
     auto setNewFont() -> bool override;
     void setNonBlockingRead (bool = true) override;
     static void setNoForce (bool = true);
+    static void setRectangleOperations (bool = true);
 
     // Inquiries
     auto isCursorHideable() const -> bool override;
@@ -100,6 +119,7 @@ class FTermOutputTest : public finalcut::FOutput
     auto hasHalfBlockCharacter() const -> bool override;
     auto hasShadowCharacter() const -> bool override;
     auto areMetaAndArrowKeysSupported() const -> bool override;
+    auto hasRectangleOperations() const -> bool override;
 
     // Methods
     void initTerminal (finalcut::FVTerm::FTermArea*) override;
@@ -110,6 +130,8 @@ class FTermOutputTest : public finalcut::FOutput
     void initScreenSettings() override;
     auto scrollTerminalForward() -> bool override;
     auto scrollTerminalReverse() -> bool override;
+    auto copyTerminalArea (const finalcut::FRect&, const finalcut::FPoint&) -> bool override;
+    auto fillTerminalArea (const finalcut::FRect&, const finalcut::FChar&) -> bool override;
     void clearTerminalAttributes() override;
     void clearTerminalState() override;
     auto clearTerminal (wchar_t = L' ') -> bool override;
@@ -132,6 +154,7 @@ class FTermOutputTest : public finalcut::FOutput
     // Data member
     bool                                 bell{false};
     static bool                          no_force;
+    static bool                          rectangle_operations;
     finalcut::FTerm                      fterm{};
     static finalcut::FVTerm::FTermArea*  vterm;
     static finalcut::FTermData*          fterm_data;
@@ -143,6 +166,7 @@ class FTermOutputTest : public finalcut::FOutput
 
 // static class attributes
 bool                         FTermOutputTest::no_force{false};
+bool                         FTermOutputTest::rectangle_operations{false};
 finalcut::FVTerm::FTermArea* FTermOutputTest::vterm{nullptr};
 finalcut::FTermData*         FTermOutputTest::fterm_data{nullptr};
 
@@ -268,6 +292,12 @@ inline auto FTermOutputTest::areMetaAndArrowKeysSupported() const -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::hasRectangleOperations() const -> bool
+{
+  return rectangle_operations;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::setCursor (finalcut::FPoint)
 { }
@@ -315,6 +345,12 @@ inline void FTermOutputTest::setNoForce (bool state)
   no_force = state;
 }
 
+//----------------------------------------------------------------------
+inline void FTermOutputTest::setRectangleOperations (bool enable)
+{
+  rectangle_operations = enable;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::initTerminal (finalcut::FVTerm::FTermArea* virtual_terminal)
 {
@@ -368,6 +404,33 @@ inline auto FTermOutputTest::scrollTerminalReverse() -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::copyTerminalArea ( const finalcut::FRect& box
+                                              , const finalcut::FPoint& pos ) -> bool
+{
+  if ( ! rectangle_operations )
+    return false;
+
+  auto& rect_ops = getRectangleOperations();
+  rect_ops.copy_count++;
+  rect_ops.copy_source = box;
+  rect_ops.copy_target = pos;
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::fillTerminalArea ( const finalcut::FRect& box
+                                              , const finalcut::FChar& ) -> bool
+{
+  if ( ! rectangle_operations )
+    return false;
+
+  auto& rect_ops = getRectangleOperations();
+  rect_ops.fill_count++;
+  rect_ops.fill_areas.push_back(box);
+  return true;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::clearTerminalAttributes()
 {
@@ -487,6 +550,7 @@ class FVTerm_protected : public finalcut::FVTerm
     void p_getArea (const finalcut::FRect&, FTermArea*) const;
     void p_addLayer (FTermArea*) const;
     void p_putArea (const finalcut::FPoint&, const FTermArea*) const;
+    void p_trackAreaMove (const FTermArea*, const finalcut::FPoint&) const;
     static auto p_getLayer (FVTerm&) -> int;
     static void p_determineWindowLayers();
     void p_scrollAreaForward (FTermArea*);
@@ -705,6 +769,12 @@ inline void FVTerm_protected::p_putArea (const finalcut::FPoint& pos, const FTer
   finalcut::FVTerm::putArea (pos, area);
 }
 
+//----------------------------------------------------------------------
+inline void FVTerm_protected::p_trackAreaMove (const FTermArea* area, const finalcut::FPoint& pos) const
+{
+  finalcut::FVTerm::trackAreaMove (area, pos);
+}
+
 //----------------------------------------------------------------------
 inline auto FVTerm_protected::p_getLayer (FVTerm& obj) -> int
 {
@@ -785,6 +855,12 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     void FVTermScrollTest();
     void FVTermOverlappingWindowsTest();
     void FVTermReduceUpdatesTest();
+    void FVTermShadowBlendingTest();
+    void FVTermParallelCompositingTest();
+    void FVTermLineChangesTest();
+    void FVTermRectangleCopyTest();
+    void FVTermBulkWriteTest();
+    void FVTermAsciiPrintTest();
     void getFVTermAreaTest();
 
   private:
@@ -801,6 +877,12 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (FVTermScrollTest);
     CPPUNIT_TEST (FVTermOverlappingWindowsTest);
     CPPUNIT_TEST (FVTermReduceUpdatesTest);
+    CPPUNIT_TEST (FVTermShadowBlendingTest);
+    CPPUNIT_TEST (FVTermParallelCompositingTest);
+    CPPUNIT_TEST (FVTermLineChangesTest);
+    CPPUNIT_TEST (FVTermRectangleCopyTest);
+    CPPUNIT_TEST (FVTermBulkWriteTest);
+    CPPUNIT_TEST (FVTermAsciiPrintTest);
     CPPUNIT_TEST (getFVTermAreaTest);
 
     // End of test suite definition
@@ -950,8 +1032,8 @@ void FVTermTest::FVTermBasesTest()
 
   if ( &(vwin->changes[0]) )
   {
-    CPPUNIT_ASSERT ( vwin->changes[0].xmin == 22 );
-    CPPUNIT_ASSERT ( vwin->changes[0].xmax == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[0].getXMin() == 22 );
+    CPPUNIT_ASSERT ( vwin->changes[0].getXMax() == 0 );
     CPPUNIT_ASSERT ( vwin->changes[0].trans_count == 0 );
   }
 
@@ -1063,8 +1145,8 @@ void FVTermTest::FVTermBasesTest()
   CPPUNIT_ASSERT ( ! vdesktop->minimized );
   CPPUNIT_ASSERT ( vdesktop->preproc_list.empty() );
   CPPUNIT_ASSERT ( ! vdesktop->changes.empty() );
-  CPPUNIT_ASSERT ( vdesktop->changes[0].xmin == 80 );
-  CPPUNIT_ASSERT ( vdesktop->changes[0].xmax == 0 );
+  CPPUNIT_ASSERT ( vdesktop->changes[0].getXMin() == 80 );
+  CPPUNIT_ASSERT ( vdesktop->changes[0].getXMax() == 0 );
   CPPUNIT_ASSERT ( vdesktop->changes[0].trans_count == 0 );
   CPPUNIT_ASSERT ( ! vdesktop->data.empty() );
   CPPUNIT_ASSERT ( test::getAreaSize(vdesktop) == 1920 );
@@ -1105,8 +1187,8 @@ void FVTermTest::FVTermBasesTest()
   CPPUNIT_ASSERT ( ! vterm->minimized );
   CPPUNIT_ASSERT ( vterm->preproc_list.empty() );
   CPPUNIT_ASSERT ( ! vterm->changes.empty() );
-  CPPUNIT_ASSERT ( vterm->changes[0].xmin == 80 );
-  CPPUNIT_ASSERT ( vterm->changes[0].xmax == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXMin() == 80 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXMax() == 0 );
   CPPUNIT_ASSERT ( vterm->changes[0].trans_count == 0 );
   CPPUNIT_ASSERT ( ! vterm->data.empty() );
   CPPUNIT_ASSERT ( test::getAreaSize(vterm) == 1920 );
@@ -1124,8 +1206,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vwin->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 22 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMin() == 22 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 0 );
   }
 
@@ -1135,8 +1217,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vwin->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 21 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMax() == 21 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 2 );
   }
 
@@ -1144,8 +1226,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{vwin->size.height}; i < full_height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 21 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXMax() == 21 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 22 );
   }
 
@@ -1380,14 +1462,13 @@ void FVTermTest::FVTermBasesTest()
   // Reset line changes
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    vterm->changes[i].xmin = uInt(vterm->size.width - 1);
-    vterm->changes[i].xmax = 0;
+    vterm->changes[i].reset(uInt(vterm->size.width - 1));
   }
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 69 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 69 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
   }
 
   // Force all lines of the virtual terminal to be output
@@ -1395,8 +1476,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 69 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 69 );
   }
 
   // Change the width only
@@ -1723,8 +1804,8 @@ void FVTermTest::FVTermPrintTest()
     p_fvterm.print(vwin, term_string);
     CPPUNIT_ASSERT ( p_fvterm.print(nullptr, L'⌚') == -1 );
     p_fvterm.print(fchar);
-    CPPUNIT_ASSERT ( vwin->changes[4].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[4].xmax == 1 );  // padding char or '.'
+    CPPUNIT_ASSERT ( vwin->changes[4].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[4].getXMax() == 1 );  // padding char or '.'
 
     if ( enc == finalcut::Encoding::VT100 )
     {
@@ -2031,8 +2112,8 @@ void FVTermTest::FVTermChildAreaPrintTest()
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2057,22 +2138,22 @@ void FVTermTest::FVTermChildAreaPrintTest()
 
   for (auto i{0}; i < 3; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{3}; i < 11; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 35 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 44 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 35 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 44 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{11}; i < 24; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2738,15 +2819,15 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 15; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 14 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 14 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{15}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2758,11 +2839,10 @@ void FVTermTest::FVTermReduceUpdatesTest()
   // Simulate printing
   for (auto y{0}; y < vterm->size.height; y++)
   {
-    for (auto x{vterm->changes[y].xmin}; x < vterm->changes[y].xmax; x++)
+    for (auto x{vterm->changes[y].getXMin()}; x < vterm->changes[y].getXMax(); x++)
       vterm->getFChar(int(x), int(y)).attr.bit.printed = true;
 
-    vterm->changes[y].xmin = uInt(vterm->size.width);
-    vterm->changes[y].xmax = 0;
+    vterm->changes[y].reset(uInt(vterm->size.width));
   }
 
   for (auto y{0}; y < vterm->size.height; y++)
@@ -2802,47 +2882,47 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 6; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
-  CPPUNIT_ASSERT ( vterm->changes[6].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[6].xmax == 11 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXMin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXMax() == 11 );
   CPPUNIT_ASSERT ( vterm->changes[6].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[7].xmin == 12 );
-  CPPUNIT_ASSERT ( vterm->changes[7].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXMin() == 12 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[7].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[8].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[8].xmax == 1 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXMin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXMax() == 1 );
   CPPUNIT_ASSERT ( vterm->changes[8].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[9].xmin == 13 );
-  CPPUNIT_ASSERT ( vterm->changes[9].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXMin() == 13 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[9].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[10].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[10].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXMin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[10].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[11].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[11].xmax == 9 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXMin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXMax() == 9 );
   CPPUNIT_ASSERT ( vterm->changes[11].trans_count == 0 );
 
   for (auto i{12}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXMax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   // Reset xmin and xmax values + reduceTerminalLineUpdates()
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    vterm->changes[i].xmin = 0;
-    vterm->changes[i].xmax = 14;
+    vterm->changes[i].reset(uInt(vterm->size.width));
+    vterm->changes[i].add(0, 14);
     finalcut::FVTerm::reduceTerminalLineUpdates(i);
   }
 
@@ -2869,43 +2949,647 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 6; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( ! vterm->changes[i].hasChanges() );
+    CPPUNIT_ASSERT ( vterm->changes[i].getSpanCount() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
-  CPPUNIT_ASSERT ( vterm->changes[6].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[6].xmax == 11 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXMin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXMax() == 11 );
   CPPUNIT_ASSERT ( vterm->changes[6].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[7].xmin == 12 );
-  CPPUNIT_ASSERT ( vterm->changes[7].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXMin() == 12 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[7].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[8].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[8].xmax == 1 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXMin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXMax() == 1 );
   CPPUNIT_ASSERT ( vterm->changes[8].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[9].xmin == 13 );
-  CPPUNIT_ASSERT ( vterm->changes[9].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXMin() == 13 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[9].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[10].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[10].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXMin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXMax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[10].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[11].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[11].xmax == 9 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXMin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXMax() == 9 );
   CPPUNIT_ASSERT ( vterm->changes[11].trans_count == 0 );
 
   for (auto i{12}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( ! vterm->changes[i].hasChanges() );
+    CPPUNIT_ASSERT ( vterm->changes[i].getSpanCount() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermShadowBlendingTest()
+{
+  //  xxxx░░   x : default
+  //  xxxx▒▒   ░ : transparent
+  //  ░░▓▓▓▓   ▒ : color overlay
+  //           ▓ : inherit background
+
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  auto vterm = p_fvterm.p_getVirtualTerminal();
+  p_fvterm.setColor (finalcut::FColor::DarkGray, finalcut::FColor::LightBlue);
+  p_fvterm.p_clearArea (vterm, L'.');
+  const auto bg_char = vterm->getFChar(0, 0);
+  vterm->getFChar(7, 2).ch[0] = L'█';  // Covered by the color overlay
+
+  // Virtual window with a shadow at position (2, 1)
+  finalcut::FRect geometry {finalcut::FPoint{2, 1}, finalcut::FSize{4, 2}};
+  auto vwin_ptr = p_fvterm.p_createArea ({geometry, finalcut::FSize{2, 1}});
+  auto vwin = vwin_ptr.get();
+  p_fvterm.setVWin(std::move(vwin_ptr));
+  CPPUNIT_ASSERT ( vwin->position.x == 2 );
+  CPPUNIT_ASSERT ( vwin->position.y == 1 );
+  p_fvterm.print() << finalcut::FPoint{1, 1}
+                   << finalcut::FColorPair { finalcut::FColor::Black
+                                           , finalcut::FColor::White }
+                   << "xxxxxxxx";
+
+  finalcut::FChar trans_char{};
+  trans_char.ch[0] = L' ';
+  trans_char.attr.bit.transparent = true;
+  auto overlay_char = trans_char;
+  overlay_char.attr.bit.transparent = false;
+  overlay_char.attr.bit.color_overlay = true;
+  overlay_char.attr.bit.reverse = true;
+  overlay_char.fg_color = finalcut::FColor::LightGray;
+  overlay_char.bg_color = finalcut::FColor::Black;
+  auto inherit_char = trans_char;
+  inherit_char.ch[0] = L'▀';
+  inherit_char.attr.bit.transparent = false;
+  inherit_char.attr.bit.inherit_background = true;
+  inherit_char.attr.bit.printed = true;
+  inherit_char.fg_color = finalcut::FColor::Red;
+  inherit_char.bg_color = finalcut::FColor::Green;
+
+  vwin->getFChar(4, 0) = trans_char;
+  vwin->getFChar(5, 0) = trans_char;
+  vwin->getFChar(4, 1) = overlay_char;
+  vwin->getFChar(5, 1) = overlay_char;
+  vwin->getFChar(0, 2) = trans_char;
+  vwin->getFChar(1, 2) = trans_char;
+
+  for (auto x{2}; x < 6; x++)
+    vwin->getFChar(x, 2) = inherit_char;
+
+  for (auto y{0}; y < 3; y++)
+  {
+    vwin->changes[unsigned(y)].reset(uInt(vwin->size.width));
+    vwin->changes[unsigned(y)].add(0, 5);
+    vwin->changes[unsigned(y)].trans_count = 2;
+  }
+
+  vwin->changes[2].trans_count = 6;
+  vwin->visible = true;
+  p_fvterm.p_addLayer (vwin);
+
+  // Default: area character
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(2, 1), vwin->getFChar(0, 0)) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(5, 2), vwin->getFChar(3, 1)) );
+
+  // Transparent: covered character
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(6, 1), bg_char) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(7, 1), bg_char) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(2, 3), bg_char) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(3, 3), bg_char) );
+
+  // Color overlay: covered character with the area colors
+  const auto& overlay_1 = vterm->getFChar(6, 2);
+  CPPUNIT_ASSERT ( overlay_1.ch[0] == L'.' );
+  CPPUNIT_ASSERT ( overlay_1.fg_color == finalcut::FColor::LightGray );
+  CPPUNIT_ASSERT ( overlay_1.bg_color == finalcut::FColor::Black );
+  CPPUNIT_ASSERT ( ! overlay_1.attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( ! overlay_1.attr.bit.reverse );
+  CPPUNIT_ASSERT ( ! overlay_1.attr.bit.printed );
+  CPPUNIT_ASSERT ( overlay_1.attr.bit.char_width == bg_char.attr.bit.char_width );
+  const auto& overlay_2 = vterm->getFChar(7, 2);
+  CPPUNIT_ASSERT ( overlay_2.ch[0] == L' ' );  // Invisible block character
+  CPPUNIT_ASSERT ( overlay_2.fg_color == finalcut::FColor::LightGray );
+  CPPUNIT_ASSERT ( overlay_2.bg_color == finalcut::FColor::Black );
+
+  // Inherit background: area character with the covered background
+  for (auto x{4}; x < 8; x++)
+  {
+    const auto& inherit = vterm->getFChar(x, 3);
+    CPPUNIT_ASSERT ( inherit.ch[0] == L'▀' );
+    CPPUNIT_ASSERT ( inherit.fg_color == finalcut::FColor::Red );
+    CPPUNIT_ASSERT ( inherit.bg_color == finalcut::FColor::LightBlue );
+    CPPUNIT_ASSERT ( inherit.attr.bit.inherit_background );
+    CPPUNIT_ASSERT ( ! inherit.attr.bit.printed );
+  }
+
+  // Unchanged terminal characters
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(1, 1), bg_char) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(8, 2), bg_char) );
+  CPPUNIT_ASSERT ( test::isFCharEqual(vterm->getFChar(2, 4), bg_char) );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermParallelCompositingTest()
+{
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 1 );
+
+  // Enlarge the virtual terminal to exceed the serial threshold
+  auto vterm = p_fvterm.p_getVirtualTerminal();
+  const auto old_size = vterm->size;
+  const finalcut::FRect term_geometry { finalcut::FPoint{0, 0}
+                                      , finalcut::FSize{200, 100} };
+  p_fvterm.p_resizeArea (term_geometry, vterm);
+  CPPUNIT_ASSERT ( vterm->size.width == 200 );
+  CPPUNIT_ASSERT ( vterm->size.height == 100 );
+
+  // Create the virtual window for the p_fvterm object
+  auto vwin_ptr = p_fvterm.p_createArea (term_geometry);
+  auto vwin = vwin_ptr.get();
+  p_fvterm.setVWin(std::move(vwin_ptr));
+  const finalcut::FString line{200, L'#'};
+
+  // Rows with transparent, color overlay and covered characters
+  for (auto y{0}; y < 100; y++)
+  {
+    if ( y % 3 == 0 )
+      p_fvterm.print() << finalcut::FStyle {finalcut::Style::Transparent};
+    else if ( y % 3 == 1 )
+      p_fvterm.print() << finalcut::FStyle {finalcut::Style::ColorOverlay};
+
+    p_fvterm.print() << finalcut::FPoint{1, 1 + y}
+                     << finalcut::FColorPair { finalcut::FColor(y % 16)
+                                             , finalcut::FColor::White }
+                     << line
+                     << finalcut::FStyle {finalcut::Style::None};
+  }
+
+  vwin->visible = true;
+
+  auto mark_changes = [&vwin] ()
+  {
+    for (auto y{0}; y < vwin->size.height; y++)
+    {
+      vwin->changes[unsigned(y)].add(0, uInt(vwin->size.width - 1));
+    }
+  };
+
+  // Serial compositing
+  p_fvterm.setColor (finalcut::FColor::DarkGray, finalcut::FColor::LightBlue);
+  p_fvterm.p_clearArea (vterm, L'.');
+  p_fvterm.p_addLayer (vwin);
+  auto test_area_ptr = p_fvterm.p_createArea (term_geometry);
+  auto test_area = test_area_ptr.get();
+  test_area->data = vterm->data;
+
+  // Parallel compositing must give the identical result
+  finalcut::FVTerm::setCompositingThreads(4);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 4 );
+  p_fvterm.p_clearArea (vterm, L'.');
+  CPPUNIT_ASSERT ( ! test::isAreaEqual(test_area, vterm) );
+  mark_changes();
+  p_fvterm.p_addLayer (vwin);
+  CPPUNIT_ASSERT ( test::isAreaEqual(test_area, vterm) );
+
+  for (auto y{0}; y < vwin->size.height; y++)
+  {
+    CPPUNIT_ASSERT ( vterm->changes[unsigned(y)].getXMin() == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[unsigned(y)].getXMax() == 199 );
+    CPPUNIT_ASSERT ( vwin->changes[unsigned(y)].getXMin() == 200 );
+    CPPUNIT_ASSERT ( vwin->changes[unsigned(y)].getXMax() == 0 );
+  }
+
+  // 0 = number of hardware threads
+  finalcut::FVTerm::setCompositingThreads(0);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads()
+                   == finalcut::FWorkerPool::getHardwareConcurrency() );
+
+  // Back to serial compositing
+  finalcut::FVTerm::setCompositingThreads(1);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 1 );
+  p_fvterm.p_clearArea (vterm, L'.');
+  mark_changes();
+  p_fvterm.p_addLayer (vwin);
+  CPPUNIT_ASSERT ( test::isAreaEqual(test_area, vterm) );
+
+  // Restore the original terminal size
+  const finalcut::FRect old_geometry { finalcut::FPoint{0, 0}
+                                     , finalcut::FSize{ std::size_t(old_size.width)
+                                                      , std::size_t(old_size.height) } };
+  p_fvterm.p_resizeArea (old_geometry, vterm);
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermLineChangesTest()
+{
+  finalcut::FVTerm::FLineChanges line_changes{};
+  line_changes.reset(300);
+  CPPUNIT_ASSERT ( line_changes.getXMin() == 300 );
+  CPPUNIT_ASSERT ( line_changes.getXMax() == 0 );
+  CPPUNIT_ASSERT ( ! line_changes.hasChanges() );
+
+  // Two distant changes remain separate spans
+  line_changes.add(2, 2);
+  line_changes.add(290, 290);
+  CPPUNIT_ASSERT ( line_changes.hasChanges() );
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXMin() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXMax() == 290 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 290 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 290 );
+
+  // Spans are kept in ascending order
+  line_changes.add(100, 110);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 3 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 100 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 110 );
+
+  // Overlapping and nearby changes are merged
+  line_changes.add(105, 120);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 3 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 120 );
+  line_changes.add(4, 5);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 3 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 5 );
+
+  // A fifth span merges the two closest spans
+  line_changes.add(200, 200);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 4 );
+  line_changes.add(50, 50);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount()
+                   == finalcut::FVTerm::FLineChanges::MAX_SPANS );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 50 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 100 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 120 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(2).xmin == 200 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(3).xmax == 290 );
+  CPPUNIT_ASSERT ( line_changes.getXMin() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXMax() == 290 );
+
+  // A change in the gap between two spans is kept
+  line_changes.add(150, 150);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount()
+                   == finalcut::FVTerm::FLineChanges::MAX_SPANS );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 100 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 150 );
+  CPPUNIT_ASSERT ( line_changes.getXMin() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXMax() == 290 );
+
+  // Narrowed spans keep the generation
+  finalcut::FVTerm::FLineChanges::FSpanArray narrowed{{ {3, 4}, {280, 285} }};
+  const auto old_generation = line_changes.generation;
+  line_changes.setSpans(narrowed, 2);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXMin() == 3 );
+  CPPUNIT_ASSERT ( line_changes.getXMax() == 285 );
+  CPPUNIT_ASSERT ( line_changes.generation == old_generation );
+
+  line_changes.reset(300);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 0 );
+  CPPUNIT_ASSERT ( ! line_changes.hasChanges() );
+
+  // Every change increments the generation of the line
+  const auto generation = line_changes.generation;
+  CPPUNIT_ASSERT ( generation == 8 );
+  line_changes.add(10, 5);  // Invalid range
+  CPPUNIT_ASSERT ( line_changes.generation == generation );
+  line_changes.add(5, 10);
+  CPPUNIT_ASSERT ( line_changes.generation == generation + 1 );
+  line_changes.reset(300);
+  CPPUNIT_ASSERT ( line_changes.generation == generation + 1 );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermRectangleCopyTest()
+{
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vdesktop = p_fvterm.p_getVirtualDesktop();
+  auto& rect_ops = getRectangleOperations();
+  rect_ops = RectangleOperations{};
+
+  // Create a virtual window with 30 × 10 characters at (2, 2)
+  finalcut::FRect geometry {finalcut::FPoint{2, 2}, finalcut::FSize{30, 10}};
+  auto vwin_ptr = p_fvterm.p_createArea (geometry);
+  auto vwin = vwin_ptr.get();
+  p_fvterm.setVWin(std::move(vwin_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm);
+  p_fvterm.p_determineWindowLayers();
+  p_fvterm.print() << finalcut::FPoint{3, 3}
+                   << finalcut::FString{300, L'#'};
+  vwin->visible = true;
+  finalcut::FApplication::start();
+  finalcut::FApplication fapp(0, nullptr);
+  p_fvterm.p_finishDrawing();
+  p_fvterm.p_clearArea (vdesktop, L'.');
+  p_fvterm.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( rect_ops.copy_count == 0 );
+  CPPUNIT_ASSERT ( rect_ops.fill_count == 0 );
+
+  const auto move_window = [&p_fvterm, vwin] (const finalcut::FPoint& pos)
+  {
+    const finalcut::FPoint old_pos{vwin->position.x, vwin->position.y};
+    const finalcut::FRect old_geometry { finalcut::FPoint{old_pos.getX() + 1, old_pos.getY() + 1}
+                                       , finalcut::FSize{30, 10} };
+    vwin->position.x = pos.getX();
+    vwin->position.y = pos.getY();
+    p_fvterm.p_trackAreaMove (vwin, old_pos);
+    p_fvterm.p_putArea (pos + finalcut::FPoint{1, 1}, vwin);
+    p_fvterm.p_restoreVTerm (old_geometry);
+    p_fvterm.p_processTerminalUpdate();
+  };
+
+  // Without rectangle operations
+  move_window (finalcut::FPoint{4, 3});
+  CPPUNIT_ASSERT ( rect_ops.copy_count == 0 );
+  CPPUNIT_ASSERT ( rect_ops.fill_count == 0 );
+
+  // With rectangle operations
+  FTermOutputTest::setRectangleOperations();
+  move_window (finalcut::FPoint{9, 6});
+  CPPUNIT_ASSERT ( rect_ops.copy_count == 1 );
+  CPPUNIT_ASSERT ( rect_ops.copy_source
+                   == finalcut::FRect(finalcut::FPoint{4, 3}, finalcut::FSize{30, 10}) );
+  CPPUNIT_ASSERT ( rect_ops.copy_target == finalcut::FPoint(9, 6) );
+
+  // The uncovered background above and left of the new position
+  CPPUNIT_ASSERT ( rect_ops.fill_count == 2 );
+  CPPUNIT_ASSERT ( rect_ops.fill_areas[0]
+                   == finalcut::FRect(finalcut::FPoint{4, 3}, finalcut::FSize{30, 3}) );
+  CPPUNIT_ASSERT ( rect_ops.fill_areas[1]
+                   == finalcut::FRect(finalcut::FPoint{4, 6}, finalcut::FSize{5, 7}) );
+
+  // An update without movement
+  p_fvterm.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( rect_ops.copy_count == 1 );
+  CPPUNIT_ASSERT ( rect_ops.fill_count == 2 );
+
+  // Printing is cheaper for a movement by one column
+  move_window (finalcut::FPoint{10, 6});
+  CPPUNIT_ASSERT ( rect_ops.copy_count == 1 );
+  CPPUNIT_ASSERT ( rect_ops.fill_count == 2 );
+
+  FTermOutputTest::setRectangleOperations(false);
+  finalcut::FVTerm::getWindowList()->clear();
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermBulkWriteTest()
+{
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  const finalcut::FRect geometry {finalcut::FPoint{1, 1}, finalcut::FSize{12, 6}};
+  auto area_ptr = p_fvterm.p_createArea (geometry);
+  auto area = area_ptr.get();
+
+  const auto reset_changes = [area] ()
+  {
+    for (auto& line_changes : area->changes)
+      line_changes.reset(uInt(area->size.width));
+
+    area->has_changes = false;
+  };
+
+  finalcut::FChar fill_char =
+  {
+    { L'#', L'\0', L'\0', L'\0', L'\0' },
+    { L'\0', L'\0', L'\0', L'\0', L'\0' },
+    finalcut::FColor::Blue,
+    finalcut::FColor::White,
+    { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
+  };
+
+  // Fill a rectangle
+  CPPUNIT_ASSERT ( ! area->has_changes );
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{2, 1}, finalcut::FSize{4, 3}}
+                    , fill_char );
+  CPPUNIT_ASSERT ( area->has_changes );
+  CPPUNIT_ASSERT ( area->changes[0].getXMin() > area->changes[0].getXMax() );
+  CPPUNIT_ASSERT ( area->changes[4].getXMin() > area->changes[4].getXMax() );
+
+  for (auto y{1}; y < 4; y++)
+  {
+    CPPUNIT_ASSERT ( area->changes[y].getXMin() == 2 );
+    CPPUNIT_ASSERT ( area->changes[y].getXMax() == 5 );
+    CPPUNIT_ASSERT ( area->changes[y].getSpanCount() == 1 );
+    CPPUNIT_ASSERT ( area->getFChar(1, y).ch[0] == L' ' );
+    CPPUNIT_ASSERT ( area->getFChar(2, y).ch[0] == L'#' );
+    CPPUNIT_ASSERT ( area->getFChar(5, y).ch[0] == L'#' );
+    CPPUNIT_ASSERT ( area->getFChar(5, y).fg_color == finalcut::FColor::Blue );
+    CPPUNIT_ASSERT ( area->getFChar(6, y).ch[0] == L' ' );
+  }
+
+  // Unchanged characters are not marked as changed
+  reset_changes();
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{0, 1}, finalcut::FSize{6, 1}}
+                    , fill_char );
+  CPPUNIT_ASSERT ( area->has_changes );
+  CPPUNIT_ASSERT ( area->changes[1].getXMin() == 0 );
+  CPPUNIT_ASSERT ( area->changes[1].getXMax() == 1 );
+  reset_changes();
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{2, 1}, finalcut::FSize{4, 3}}
+                    , fill_char );
+  CPPUNIT_ASSERT ( ! area->has_changes );
+  CPPUNIT_ASSERT ( area->changes[1].getXMin() > area->changes[1].getXMax() );
+
+  // Rectangles are clipped at the area border
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{-3, 4}, finalcut::FSize{30, 8}}
+                    , fill_char );
+  CPPUNIT_ASSERT ( area->changes[4].getXMin() == 0 );
+  CPPUNIT_ASSERT ( area->changes[4].getXMax() == 11 );
+  CPPUNIT_ASSERT ( area->changes[5].getXMin() == 0 );
+  CPPUNIT_ASSERT ( area->changes[5].getXMax() == 11 );
+  CPPUNIT_ASSERT ( area->getFChar(11, 5).ch[0] == L'#' );
+
+  // Draw a frame
+  reset_changes();
+  const finalcut::FVTerm::FFrameChars frame_chars
+  {{ L'1', L'-', L'2', L'[', L']', L'3', L'=', L'4' }};
+  p_fvterm.drawFrame ( area
+                     , finalcut::FRect{finalcut::FPoint{1, 0}, finalcut::FSize{10, 6}}
+                     , fill_char, frame_chars );
+  CPPUNIT_ASSERT ( area->has_changes );
+  CPPUNIT_ASSERT ( area->getFChar(1, 0).ch[0] == L'1' );
+  CPPUNIT_ASSERT ( area->getFChar(2, 0).ch[0] == L'-' );
+  CPPUNIT_ASSERT ( area->getFChar(10, 0).ch[0] == L'2' );
+  CPPUNIT_ASSERT ( area->getFChar(1, 2).ch[0] == L'[' );
+  CPPUNIT_ASSERT ( area->getFChar(3, 2).ch[0] == L'#' );  // Inside unchanged
+  CPPUNIT_ASSERT ( area->getFChar(10, 2).ch[0] == L']' );
+  CPPUNIT_ASSERT ( area->getFChar(1, 5).ch[0] == L'3' );
+  CPPUNIT_ASSERT ( area->getFChar(9, 5).ch[0] == L'=' );
+  CPPUNIT_ASSERT ( area->getFChar(10, 5).ch[0] == L'4' );
+  CPPUNIT_ASSERT ( area->getFChar(11, 5).ch[0] == L'#' );
+  CPPUNIT_ASSERT ( area->changes[0].getXMin() == 1 );
+  CPPUNIT_ASSERT ( area->changes[0].getXMax() == 10 );
+  CPPUNIT_ASSERT ( area->changes[0].getSpanCount() == 1 );
+
+  // The sides are separate changes
+  CPPUNIT_ASSERT ( area->changes[2].getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( area->changes[2].getSpan(0).xmin == 1 );
+  CPPUNIT_ASSERT ( area->changes[2].getSpan(0).xmax == 1 );
+  CPPUNIT_ASSERT ( area->changes[2].getSpan(1).xmin == 10 );
+  CPPUNIT_ASSERT ( area->changes[2].getSpan(1).xmax == 10 );
+
+  // Copy a block of characters
+  reset_changes();
+  std::array<finalcut::FChar, 6> cells{};
+  cells.fill (fill_char);
+  cells[0].ch[0] = L'A';
+  cells[2].ch[0] = L'C';
+  cells[5].ch[0] = L'F';
+  p_fvterm.blit (area, finalcut::FPoint{10, 2}, cells.data(), 3, 2);
+  CPPUNIT_ASSERT ( area->getFChar(10, 2).ch[0] == L'A' );
+  CPPUNIT_ASSERT ( area->getFChar(11, 2).ch[0] == L'#' );
+  CPPUNIT_ASSERT ( area->getFChar(11, 3).ch[0] == L'#' );
+  CPPUNIT_ASSERT ( area->changes[2].getXMin() == 10 );
+  CPPUNIT_ASSERT ( area->changes[2].getXMax() == 11 );
+  CPPUNIT_ASSERT ( area->changes[3].getXMin() == 10 );
+  CPPUNIT_ASSERT ( area->changes[3].getXMax() == 11 );
+  p_fvterm.blit (area, finalcut::FPoint{-2, 4}, cells.data(), 3, 2);
+  CPPUNIT_ASSERT ( area->getFChar(0, 4).ch[0] == L'C' );
+  CPPUNIT_ASSERT ( area->getFChar(0, 5).ch[0] == L'F' );
+
+  // Transparent characters are counted
+  CPPUNIT_ASSERT ( area->changes[1].trans_count == 0 );
+  auto transparent_char = fill_char;
+  transparent_char.attr.bit.transparent = true;
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{2, 1}, finalcut::FSize{8, 1}}
+                    , transparent_char );
+  CPPUNIT_ASSERT ( area->changes[1].trans_count == 8 );
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{0, 1}, finalcut::FSize{4, 1}}
+                    , fill_char );
+  CPPUNIT_ASSERT ( area->changes[1].trans_count == 6 );
+
+  // Full-width characters are followed by a padding character
+  reset_changes();
+  area->encoding = finalcut::Encoding::UTF8;
+  auto wide_char = fill_char;
+  wide_char.ch[0] = L'\U0001f600';
+  wide_char.attr.bit.char_width = 2;
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{-1, 0}, finalcut::FSize{7, 1}}
+                    , wide_char );
+  CPPUNIT_ASSERT ( area->getFChar(0, 0).ch[0] == L' ' );
+  CPPUNIT_ASSERT ( area->getFChar(0, 0).attr.bit.char_width == 1 );
+  CPPUNIT_ASSERT ( area->getFChar(1, 0).ch[0] == L'\U0001f600' );
+  CPPUNIT_ASSERT ( area->getFChar(1, 0).attr.bit.char_width == 2 );
+  CPPUNIT_ASSERT ( area->getFChar(2, 0).ch[0] == L'\0' );
+  CPPUNIT_ASSERT ( area->getFChar(2, 0).attr.bit.fullwidth_padding );
+  CPPUNIT_ASSERT ( area->getFChar(2, 0).attr.bit.char_width == 0 );
+  CPPUNIT_ASSERT ( area->getFChar(3, 0).ch[0] == L'\U0001f600' );
+  CPPUNIT_ASSERT ( area->getFChar(4, 0).attr.bit.fullwidth_padding );
+  CPPUNIT_ASSERT ( area->getFChar(5, 0).ch[0] == L' ' );  // Odd end
+  CPPUNIT_ASSERT ( area->getFChar(6, 0).ch[0] == L'-' );  // Unchanged
+  CPPUNIT_ASSERT ( area->changes[0].getXMin() == 0 );
+  CPPUNIT_ASSERT ( area->changes[0].getXMax() == 5 );
+
+  // A column without room for the padding character gets a space
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{8, 0}, finalcut::FSize{5, 1}}
+                    , wide_char );
+  CPPUNIT_ASSERT ( area->getFChar(8, 0).ch[0] == L'\U0001f600' );
+  CPPUNIT_ASSERT ( area->getFChar(9, 0).attr.bit.fullwidth_padding );
+  CPPUNIT_ASSERT ( area->getFChar(10, 0).ch[0] == L'\U0001f600' );
+  CPPUNIT_ASSERT ( area->getFChar(11, 0).attr.bit.fullwidth_padding );
+  p_fvterm.fillRect ( area
+                    , finalcut::FRect{finalcut::FPoint{7, 1}, finalcut::FSize{5, 1}}
+                    , wide_char );
+  CPPUNIT_ASSERT ( area->getFChar(10, 1).attr.bit.fullwidth_padding );
+  CPPUNIT_ASSERT ( area->getFChar(11, 1).ch[0] == L' ' );
+  CPPUNIT_ASSERT ( area->getFChar(11, 1).attr.bit.char_width == 1 );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermAsciiPrintTest()
+{
+  // Printable ASCII strings are written without FVTermBuffer.
+  // The result must be the same as with the general print path.
+
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  const finalcut::FRect geometry {finalcut::FPoint{1, 1}, finalcut::FSize{15, 4}};
+  auto fast_area_ptr = p_fvterm.p_createArea (geometry);
+  auto general_area_ptr = p_fvterm.p_createArea (geometry);
+  auto fast_area = fast_area_ptr.get();
+  auto general_area = general_area_ptr.get();
+  finalcut::FVTermBuffer vterm_buf{};
+
+  const auto print_both = [&] (const finalcut::FPoint& pos, const finalcut::FString& str)
+  {
+    fast_area->setCursorPos (pos.getX(), pos.getY());
+    general_area->setCursorPos (pos.getX(), pos.getY());
+    const auto fast_len = p_fvterm.print (fast_area, str);
+    vterm_buf.print(str);
+    const auto general_len = p_fvterm.print (general_area, vterm_buf);
+    CPPUNIT_ASSERT ( fast_len == general_len );
+    CPPUNIT_ASSERT ( fast_area->cursor.x == general_area->cursor.x );
+    CPPUNIT_ASSERT ( fast_area->cursor.y == general_area->cursor.y );
+    CPPUNIT_ASSERT ( test::isAreaEqual(fast_area, general_area) );
+
+    for (std::size_t y{0}; y < fast_area->changes.size(); y++)
+    {
+      const auto& fast = fast_area->changes[y];
+      const auto& general = general_area->changes[y];
+      CPPUNIT_ASSERT ( fast.getXMin() == general.getXMin() );
+      CPPUNIT_ASSERT ( fast.getXMax() == general.getXMax() );
+      CPPUNIT_ASSERT ( fast.trans_count == general.trans_count );
+      CPPUNIT_ASSERT ( fast.getSpanCount() == general.getSpanCount() );
+
+      for (std::size_t n{0}; n < fast.getSpanCount(); n++)
+      {
+        CPPUNIT_ASSERT ( fast.getSpan(n).xmin == general.getSpan(n).xmin );
+        CPPUNIT_ASSERT ( fast.getSpan(n).xmax == general.getSpan(n).xmax );
+      }
+    }
+  };
+
+  p_fvterm.setColor (finalcut::FColor::Black, finalcut::FColor::LightGray);
+  print_both (finalcut::FPoint{3, 1}, "Hello");
+  CPPUNIT_ASSERT ( fast_area->getFChar(2, 0).ch[0] == L'H' );
+  CPPUNIT_ASSERT ( fast_area->getFChar(6, 0).ch[0] == L'o' );
+  CPPUNIT_ASSERT ( fast_area->cursor.x == 8 );
+
+  // Line wrap at the right margin
+  print_both (finalcut::FPoint{12, 2}, "0123456789");
+  CPPUNIT_ASSERT ( fast_area->getFChar(14, 1).ch[0] == L'3' );
+  CPPUNIT_ASSERT ( fast_area->getFChar(0, 2).ch[0] == L'4' );
+  CPPUNIT_ASSERT ( fast_area->cursor.x == 7 );
+  CPPUNIT_ASSERT ( fast_area->cursor.y == 3 );
+
+  // Unchanged characters between the changes
+  print_both (finalcut::FPoint{3, 1}, "HeLlo");
+  print_both (finalcut::FPoint{1, 4}, "a----------b");
+  print_both (finalcut::FPoint{1, 4}, "x----------y");
+
+  // Transparent characters
+  p_fvterm.setTransparent();
+  print_both (finalcut::FPoint{2, 3}, "    ");
+  p_fvterm.unsetTransparent();
+  print_both (finalcut::FPoint{1, 3}, "abc");
+
+  // Printing beyond the end of the area
+  print_both (finalcut::FPoint{10, 4}, "The end of the area");
+  CPPUNIT_ASSERT ( fast_area->cursor.y == 4 );
+
+  // A cursor outside the area
+  print_both (finalcut::FPoint{16, 5}, "invisible");
+
+  // Strings with other characters use the general path
+  print_both (finalcut::FPoint{1, 1}, L"Gr\u00f6\u00dfe\tx");
+  CPPUNIT_ASSERT ( fast_area->getFChar(0, 0).ch[0] == L'G' );
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::getFVTermAreaTest()
 {
@@ -3,7 +3,7 @@
 *                                                                      *
 * This file is part of the FINAL CUT widget toolkit                    *
 *                                                                      *
-* Copyright 2022-2023 Markus Gans                                      *
+* Copyright 2022-2026 Markus Gans                                      *
 *                                                                      *
 * FINAL CUT is free software; you can redistribute it and/or modify    *
 * it under the terms of the GNU Lesser General Public License as       *
@@ -995,6 +995,18 @@ void FWidgetTest::acceleratorTest()
   CPPUNIT_ASSERT ( wdgt.getAcceleratorList().size() == 1 );
   wdgt.delAccelerator(&root_wdgt);
   CPPUNIT_ASSERT ( wdgt.getAcceleratorList().size() == 0 );
+
+  // Deleting a container removes the accelerators of its children
+  finalcut::FWidget window{&root_wdgt};
+  window.setFlags().type.window_widget = true;
+  auto group = new finalcut::FButtonGroup{&window};
+  auto button = new finalcut::FButton{group};
+  button->setText("&Ok");
+  CPPUNIT_ASSERT ( window.getAcceleratorList().size() == 3 );  // o, O, Meta-o
+  CPPUNIT_ASSERT ( window.getAcceleratorList()[0].object == button );
+  delete group;
+  CPPUNIT_ASSERT ( window.numOfChildren() == 0 );
+  CPPUNIT_ASSERT ( window.getAcceleratorList().empty() );
 }
 
 //----------------------------------------------------------------------
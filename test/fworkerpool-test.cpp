@@ -0,0 +1,264 @@
+/***********************************************************************
+* fworkerpool-test.cpp - FWorkerPool unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FWorkerPoolTest
+//----------------------------------------------------------------------
+
+class FWorkerPoolTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FWorkerPoolTest() = default;
+
+  protected:
+    void classNameTest();
+    void threadCountTest();
+    void submitTest();
+    void parallelForTest();
+    void serialFallbackTest();
+    void exceptionTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FWorkerPoolTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (threadCountTest);
+    CPPUNIT_TEST (submitTest);
+    CPPUNIT_TEST (parallelForTest);
+    CPPUNIT_TEST (serialFallbackTest);
+    CPPUNIT_TEST (exceptionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::classNameTest()
+{
+  const finalcut::FWorkerPool pool{1};
+  const finalcut::FString& classname = pool.getClassName();
+  CPPUNIT_ASSERT ( classname == "FWorkerPool" );
+}
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::threadCountTest()
+{
+  const finalcut::FWorkerPool pool1{1};
+  CPPUNIT_ASSERT ( pool1.getThreadCount() == 1 );
+  CPPUNIT_ASSERT ( pool1.isIdle() );
+
+  const finalcut::FWorkerPool pool4{4};
+  CPPUNIT_ASSERT ( pool4.getThreadCount() == 4 );
+
+  // 0 = number of hardware threads
+  const finalcut::FWorkerPool pool0{0};
+  CPPUNIT_ASSERT ( pool0.getThreadCount()
+                   == finalcut::FWorkerPool::getHardwareConcurrency() );
+  CPPUNIT_ASSERT ( pool0.getThreadCount() >= 1 );
+
+  // The shared pool leaves one hardware thread to the caller
+  const auto shared_pool = finalcut::FWorkerPool::getSharedPool();
+  CPPUNIT_ASSERT ( shared_pool == finalcut::FWorkerPool::getSharedPool() );
+
+  if ( finalcut::FWorkerPool::getHardwareConcurrency() < 2 )
+    CPPUNIT_ASSERT ( shared_pool == nullptr );
+  else
+    CPPUNIT_ASSERT ( shared_pool->getThreadCount()
+                     == finalcut::FWorkerPool::getHardwareConcurrency() - 1 );
+}
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::submitTest()
+{
+  finalcut::FWorkerPool pool{3};
+  std::atomic<int> counter{0};
+
+  for (int i{0}; i < 100; i++)
+    pool.submit ([&counter] () { counter++; });
+
+  pool.submit ({});  // An empty task is ignored
+  pool.wait();
+  CPPUNIT_ASSERT ( counter == 100 );
+  CPPUNIT_ASSERT ( pool.isIdle() );
+}
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::parallelForTest()
+{
+  finalcut::FWorkerPool pool{4};
+  std::vector<int> values(1000, 0);
+  std::atomic<int> calls{0};
+
+  pool.parallelFor ( 0, values.size(), 10
+                   , [&values, &calls] (std::size_t first, std::size_t last)
+                     {
+                       calls++;
+
+                       for (auto i = first; i < last; i++)
+                         values[i] = int(i);
+                     } );
+
+  // Five bands for four threads and the calling thread
+  CPPUNIT_ASSERT ( calls == 5 );
+
+  for (std::size_t i{0}; i < values.size(); i++)
+    CPPUNIT_ASSERT ( values[i] == int(i) );
+
+  // Partial range
+  std::fill (values.begin(), values.end(), -1);
+  pool.parallelFor ( 100, 203, 1
+                   , [&values] (std::size_t first, std::size_t last)
+                     {
+                       for (auto i = first; i < last; i++)
+                         values[i] = 1;
+                     } );
+  CPPUNIT_ASSERT ( std::accumulate(values.begin(), values.end(), 0)
+                   == 103 - (1000 - 103) );
+  CPPUNIT_ASSERT ( values[99] == -1 );
+  CPPUNIT_ASSERT ( values[100] == 1 );
+  CPPUNIT_ASSERT ( values[202] == 1 );
+  CPPUNIT_ASSERT ( values[203] == -1 );
+}
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::serialFallbackTest()
+{
+  finalcut::FWorkerPool pool{4};
+  int calls{0};
+  std::size_t from{99};
+  std::size_t to{99};
+
+  // The range is smaller than two minimum chunks
+  pool.parallelFor ( 5, 20, 8
+                   , [&calls, &from, &to] (std::size_t first, std::size_t last)
+                     {
+                       calls++;
+                       from = first;
+                       to = last;
+                     } );
+  CPPUNIT_ASSERT ( calls == 2 );
+
+  calls = 0;
+  pool.parallelFor ( 5, 12, 8
+                   , [&calls, &from, &to] (std::size_t first, std::size_t last)
+                     {
+                       calls++;
+                       from = first;
+                       to = last;
+                     } );
+  CPPUNIT_ASSERT ( calls == 1 );
+  CPPUNIT_ASSERT ( from == 5 );
+  CPPUNIT_ASSERT ( to == 12 );
+
+  // Empty range
+  calls = 0;
+  pool.parallelFor ( 7, 7, 1
+                   , [&calls] (std::size_t, std::size_t) { calls++; } );
+  CPPUNIT_ASSERT ( calls == 0 );
+
+  // A single worker thread shares the range with the calling thread
+  finalcut::FWorkerPool single{1};
+  single.parallelFor ( 0, 1000, 1
+                     , [&calls] (std::size_t, std::size_t) { calls++; } );
+  CPPUNIT_ASSERT ( calls == 2 );
+}
+
+//----------------------------------------------------------------------
+void FWorkerPoolTest::exceptionTest()
+{
+  finalcut::FWorkerPool pool{4};
+  std::vector<int> values(500, 0);
+  const auto fill_and_throw = [&values] (std::size_t throw_at)
+  {
+    return [&values, throw_at] (std::size_t first, std::size_t last)
+    {
+      for (auto i = first; i < last; i++)
+        values[i] = 1;
+
+      if ( first <= throw_at && throw_at < last )
+        throw std::runtime_error("band error");
+    };
+  };
+
+  // Exception in the first band (calling thread)
+  bool caught{false};
+
+  try
+  {
+    pool.parallelFor (0, values.size(), 1, fill_and_throw(0));
+  }
+  catch (const std::runtime_error&)
+  {
+    caught = true;
+  }
+
+  CPPUNIT_ASSERT ( caught );
+  // All other bands were completed before the exception was rethrown
+  CPPUNIT_ASSERT ( std::accumulate(values.begin(), values.end(), 0) == 500 );
+  CPPUNIT_ASSERT ( pool.isIdle() );
+
+  // Exception in the last band (worker thread)
+  std::fill (values.begin(), values.end(), 0);
+  caught = false;
+
+  try
+  {
+    pool.parallelFor (0, values.size(), 1, fill_and_throw(499));
+  }
+  catch (const std::runtime_error&)
+  {
+    caught = true;
+  }
+
+  CPPUNIT_ASSERT ( caught );
+  CPPUNIT_ASSERT ( std::accumulate(values.begin(), values.end(), 0) == 500 );
+  CPPUNIT_ASSERT ( pool.isIdle() );
+
+  // The pool remains usable
+  std::atomic<int> calls{0};
+  pool.parallelFor ( 0, values.size(), 1
+                   , [&calls] (std::size_t, std::size_t) { calls++; } );
+  CPPUNIT_ASSERT ( calls == 5 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FWorkerPoolTest);
+
+// The general unit test main part
+#include <main-test.inc>